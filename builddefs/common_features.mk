@@ -21,6 +21,7 @@ QUANTUM_SRC += \
     $(QUANTUM_DIR)/action_layer.c \
     $(QUANTUM_DIR)/action_tapping.c \
     $(QUANTUM_DIR)/action_util.c \
+    $(QUANTUM_DIR)/deadline.c \
     $(QUANTUM_DIR)/eeconfig.c \
     $(QUANTUM_DIR)/keyboard.c \
     $(QUANTUM_DIR)/keymap_common.c \
@@ -40,6 +41,11 @@ else
     include $(PLATFORM_PATH)/$(PLATFORM_KEY)/printf.mk
 endif
 
+ifeq ($(strip $(TOKENIZED_PRINT_ENABLE)), yes)
+    OPT_DEFS += -DTOKENIZED_PRINT_ENABLE
+    QUANTUM_SRC += $(QUANTUM_DIR)/logging/print_tokenized.c
+endif
+
 ifeq ($(strip $(DEBUG_MATRIX_SCAN_RATE_ENABLE)), yes)
     OPT_DEFS += -DDEBUG_MATRIX_SCAN_RATE
     CONSOLE_ENABLE = yes
@@ -75,6 +81,12 @@ ifeq ($(strip $(AUDIO_ENABLE)), yes)
     SRC += $(PLATFORM_PATH)/$(PLATFORM_KEY)/$(DRIVER_DIR)/audio_$(strip $(AUDIO_DRIVER)).c
     SRC += $(QUANTUM_DIR)/audio/voices.c
     SRC += $(QUANTUM_DIR)/audio/luts.c
+    ifeq ($(strip $(AUDIO_DRIVER)), dac_additive)
+        AUDIO_SYNTH_ENABLE := yes
+    endif
+    ifeq ($(strip $(AUDIO_SYNTH_ENABLE)), yes)
+        SRC += $(QUANTUM_DIR)/audio/synth.c
+    endif
 endif
 
 ifeq ($(strip $(SEQUENCER_ENABLE)), yes)
@@ -87,6 +99,7 @@ ifeq ($(strip $(MIDI_ENABLE)), yes)
     COMMON_VPATH += $(QUANTUM_PATH)/midi
     SRC += $(QUANTUM_DIR)/midi/midi.c
     SRC += $(QUANTUM_DIR)/midi/midi_device.c
+    SRC += $(QUANTUM_DIR)/midi/midi_tx_queue.c
     SRC += $(QUANTUM_DIR)/midi/qmk_midi.c
     SRC += $(QUANTUM_DIR)/midi/sysex_tools.c
     SRC += $(QUANTUM_DIR)/midi/bytequeue/bytequeue.c
@@ -287,6 +300,7 @@ ifneq ($(strip $(FLASH_DRIVER)), none)
     else
         OPT_DEFS += -DFLASH_ENABLE -DFLASH_DRIVER -DFLASH_DRIVER_$(strip $(shell echo $(FLASH_DRIVER) | tr '[:lower:]' '[:upper:]'))
 		COMMON_VPATH += $(DRIVER_PATH)/flash
+        SRC += flash.c
         ifeq ($(strip $(FLASH_DRIVER)),spi)
             SRC += flash_spi.c
             SPI_DRIVER_REQUIRED = yes
@@ -659,6 +673,26 @@ ifneq ($(strip $(CUSTOM_MATRIX)), yes)
     ifneq ($(strip $(CUSTOM_MATRIX)), lite)
         # Include the standard or split matrix code if needed
         QUANTUM_SRC += $(QUANTUM_DIR)/matrix.c
+
+        VALID_MATRIX_IO_EXPANDER_TYPES := mcp23018 pca9555
+        ifneq ($(strip $(MATRIX_IO_EXPANDER)),)
+            ifeq ($(filter $(MATRIX_IO_EXPANDER),$(VALID_MATRIX_IO_EXPANDER_TYPES)),)
+                $(call CATASTROPHIC_ERROR,Invalid MATRIX_IO_EXPANDER,MATRIX_IO_EXPANDER="$(MATRIX_IO_EXPANDER)" is not a valid I/O expander)
+            endif
+            OPT_DEFS += -DMATRIX_IO_EXPANDER -DMATRIX_IO_EXPANDER_$(strip $(shell echo $(MATRIX_IO_EXPANDER) | tr '[:lower:]' '[:upper:]'))
+            COMMON_VPATH += $(DRIVER_PATH)/gpio
+            SRC += $(strip $(MATRIX_IO_EXPANDER)).c
+            I2C_DRIVER_REQUIRED = yes
+        endif
+
+        VALID_MATRIX_SHIFT_REGISTER_TYPES := 74hc595 74hc165
+        ifneq ($(strip $(MATRIX_SHIFT_REGISTER)),)
+            ifeq ($(filter $(MATRIX_SHIFT_REGISTER),$(VALID_MATRIX_SHIFT_REGISTER_TYPES)),)
+                $(call CATASTROPHIC_ERROR,Invalid MATRIX_SHIFT_REGISTER,MATRIX_SHIFT_REGISTER="$(MATRIX_SHIFT_REGISTER)" is not a valid shift register)
+            endif
+            OPT_DEFS += -DMATRIX_SHIFT_REGISTER -DMATRIX_SHIFT_REGISTER_$(strip $(shell echo $(MATRIX_SHIFT_REGISTER) | tr '[:lower:]' '[:upper:]'))
+            SPI_DRIVER_REQUIRED = yes
+        endif
     endif
 endif
 
@@ -913,7 +947,7 @@ endif
 
 ENCODER_ENABLE ?= no
 ENCODER_DRIVER ?= quadrature
-VALID_ENCODER_DRIVER_TYPES := quadrature custom
+VALID_ENCODER_DRIVER_TYPES := quadrature timer vendor custom
 ifeq ($(strip $(ENCODER_ENABLE)), yes)
     ifeq ($(filter $(ENCODER_DRIVER),$(VALID_ENCODER_DRIVER_TYPES)),)
         $(call CATASTROPHIC_ERROR,Invalid ENCODER_DRIVER,ENCODER_DRIVER="$(ENCODER_DRIVER)" is not a valid encoder driver)
@@ -929,6 +963,11 @@ ifeq ($(strip $(ENCODER_ENABLE)), yes)
         SRC += encoder_$(strip $(ENCODER_DRIVER)).c
     endif
 
+    # Hardware decoders fall back to the quadrature driver for encoders they can't handle
+    ifneq ($(filter $(strip $(ENCODER_DRIVER)),timer vendor),)
+        SRC += encoder_quadrature.c
+    endif
+
     ifeq ($(strip $(ENCODER_MAP_ENABLE)), yes)
         OPT_DEFS += -DENCODER_MAP_ENABLE
     endif
@@ -1001,6 +1040,13 @@ endif
 ifeq ($(strip $(I2C_DRIVER_REQUIRED)), yes)
     OPT_DEFS += -DHAL_USE_I2C=TRUE
     QUANTUM_LIB_SRC += i2c_master.c
+
+    ifeq ($(strip $(I2C_SCHEDULER_ENABLE)), yes)
+        ifneq ($(strip $(PLATFORM_KEY)), chibios)
+            $(call CATASTROPHIC_ERROR,Invalid I2C_SCHEDULER_ENABLE,The I2C scheduler is only available on ChibiOS)
+        endif
+        OPT_DEFS += -DI2C_SCHEDULER_ENABLE
+    endif
 endif
 
 ifeq ($(strip $(SPI_DRIVER_REQUIRED)), yes)
@@ -32,6 +32,10 @@ extern volatile bool isLeftHand;
 __attribute__((weak)) void    encoder_quadrature_init_pin(uint8_t index, bool pad_b);
 __attribute__((weak)) uint8_t encoder_quadrature_read_pin(uint8_t index, bool pad_b);
 
+// Hardware decoding, provided by the timer and vendor encoder drivers. Encoders they don't claim are decoded in software.
+__attribute__((weak)) bool    encoder_quadrature_hardware_init(uint8_t index, pin_t pad_a, pin_t pad_b);
+__attribute__((weak)) int16_t encoder_quadrature_hardware_read(uint8_t index);
+
 #ifdef ENCODER_DEFAULT_PIN_API_IMPL
 
 static pin_t encoders_pad_a[NUM_ENCODERS_MAX_PER_SIDE] = ENCODER_A_PINS;
@@ -56,6 +60,14 @@ __attribute__((weak)) uint8_t encoder_quadrature_read_pin(uint8_t index, bool pa
     return 0;
 }
 
+__attribute__((weak)) bool encoder_quadrature_hardware_init(uint8_t index, pin_t pad_a, pin_t pad_b) {
+    return false;
+}
+
+__attribute__((weak)) int16_t encoder_quadrature_hardware_read(uint8_t index) {
+    return 0;
+}
+
 #endif // ENCODER_DEFAULT_PIN_API_IMPL
 
 #ifdef ENCODER_RESOLUTIONS
@@ -72,7 +84,10 @@ static uint8_t encoder_resolutions[NUM_ENCODERS] = ENCODER_RESOLUTIONS;
 static int8_t encoder_LUT[] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0};
 
 static uint8_t encoder_state[NUM_ENCODERS]  = {0};
-static int8_t  encoder_pulses[NUM_ENCODERS] = {0};
+static int16_t encoder_pulses[NUM_ENCODERS] = {0};
+#ifdef ENCODER_DEFAULT_PIN_API_IMPL
+static bool encoder_hardware[NUM_ENCODERS_MAX_PER_SIDE] = {0};
+#endif
 
 // encoder counts
 static uint8_t thisCount;
@@ -92,8 +107,11 @@ __attribute__((weak)) void encoder_quadrature_post_init_kb(void) {
 void encoder_quadrature_post_init(void) {
 #ifdef ENCODER_DEFAULT_PIN_API_IMPL
     for (uint8_t i = 0; i < thisCount; i++) {
-        encoder_quadrature_init_pin(i, false);
-        encoder_quadrature_init_pin(i, true);
+        encoder_hardware[i] = encoder_quadrature_hardware_init(i, encoders_pad_a[i], encoders_pad_b[i]);
+        if (!encoder_hardware[i]) {
+            encoder_quadrature_init_pin(i, false);
+            encoder_quadrature_init_pin(i, true);
+        }
     }
     encoder_wait_pullup_charge();
     for (uint8_t i = 0; i < thisCount; i++) {
@@ -158,6 +176,14 @@ void encoder_driver_init(void) {
     encoder_quadrature_post_init();
 }
 
+static uint8_t encoder_resolution(uint8_t index) {
+#ifdef ENCODER_RESOLUTIONS
+    return encoder_resolutions[index];
+#else
+    return ENCODER_RESOLUTION;
+#endif
+}
+
 static void encoder_handle_state_change(uint8_t index, uint8_t state) {
     uint8_t i = index;
 
@@ -165,11 +191,7 @@ static void encoder_handle_state_change(uint8_t index, uint8_t state) {
     index += thisHand;
 #endif
 
-#ifdef ENCODER_RESOLUTIONS
-    const uint8_t resolution = encoder_resolutions[index];
-#else
-    const uint8_t resolution = ENCODER_RESOLUTION;
-#endif
+    const uint8_t resolution = encoder_resolution(index);
 
     encoder_pulses[i] += encoder_LUT[state & 0xF];
 
@@ -206,8 +228,36 @@ void encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t
     }
 }
 
+#ifdef ENCODER_DEFAULT_PIN_API_IMPL
+static void encoder_handle_hardware_pulses(uint8_t index, int16_t pulses) {
+    uint8_t i = index;
+
+#    ifdef SPLIT_KEYBOARD
+    index += thisHand;
+#    endif
+
+    const uint8_t resolution = encoder_resolution(index);
+
+    // Pulses stay counted until the event queue has room for them, so nothing is lost if the main loop stalls
+    int32_t total = encoder_pulses[i] + pulses;
+    while (total >= resolution && encoder_queue_event(index, ENCODER_COUNTER_CLOCKWISE)) {
+        total -= resolution;
+    }
+    while (total <= -resolution && encoder_queue_event(index, ENCODER_CLOCKWISE)) {
+        total += resolution;
+    }
+    encoder_pulses[i] = MAX(INT16_MIN, MIN(total, INT16_MAX));
+}
+#endif // ENCODER_DEFAULT_PIN_API_IMPL
+
 __attribute__((weak)) void encoder_driver_task(void) {
     for (uint8_t i = 0; i < thisCount; i++) {
+#ifdef ENCODER_DEFAULT_PIN_API_IMPL
+        if (encoder_hardware[i]) {
+            encoder_handle_hardware_pulses(i, encoder_quadrature_hardware_read(i));
+            continue;
+        }
+#endif // ENCODER_DEFAULT_PIN_API_IMPL
         encoder_quadrature_handle_read(i, encoder_quadrature_read_pin(i, false), encoder_quadrature_read_pin(i, true));
     }
 }
@@ -0,0 +1,12 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "flash.h"
+
+void flash_init_once(void) {
+    static bool is_initialised = false;
+    if (!is_initialised) {
+        is_initialised = true;
+        flash_init();
+    }
+}
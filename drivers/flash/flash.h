@@ -34,6 +34,14 @@ typedef int16_t flash_status_t;
  */
 void flash_init(void);
 
+/**
+ * @brief Initializes the flash driver, unless this has already been done.
+ *
+ * For features which read from flash on first use rather than at startup. All such features share the one flag, so
+ * the flash driver is only initialized once however many of them are enabled.
+ */
+void flash_init_once(void);
+
 /**
  * @brief Checks if the flash is busy.
  *
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 
 /**
  * \file
@@ -138,4 +139,88 @@ i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* dat
  */
 i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout);
 
+#if defined(I2C_SCHEDULER_ENABLE) || defined(__DOXYGEN__)
+
+/**
+ * \defgroup i2c_scheduler I2C Transaction Scheduler
+ *
+ * \brief Queues I2C transactions by priority and runs them in the background.
+ *
+ * The blocking functions above are queued at `I2C_PRIORITY_NORMAL` and wait for their own transaction to complete.
+ * \{
+ */
+
+/**
+ * \brief Returned by i2c_transaction_status() while a transaction is queued or in progress.
+ */
+#    define I2C_STATUS_PENDING (1)
+
+typedef enum i2c_priority_t {
+    I2C_PRIORITY_HIGH,   ///< Latency sensitive transfers, such as reading matrix port expanders
+    I2C_PRIORITY_NORMAL, ///< Blocking API calls
+    I2C_PRIORITY_LOW,    ///< Bulk transfers which can wait, such as LED driver flushes
+} i2c_priority_t;
+
+typedef struct i2c_transaction_t i2c_transaction_t;
+
+typedef void (*i2c_transaction_callback_t)(i2c_transaction_t* transaction);
+
+/**
+ * \brief A queued I2C transfer. The caller owns the storage, which must stay valid until the transaction completes.
+ *
+ * If `reg_length` is non-zero the register address is sent first, followed by `tx_data` for a register write, or
+ * followed by a repeated start and reading into `rx_data` for a register read.
+ */
+struct i2c_transaction_t {
+    uint8_t                    address;    ///< The 7-bit I2C address of the device, shifted left by one like the blocking API.
+    uint8_t                    priority;   ///< One of i2c_priority_t; transactions of equal priority run in the order they were submitted.
+    uint8_t                    reg[2];     ///< Register address, big endian for 16-bit addresses.
+    uint8_t                    reg_length; ///< Number of bytes in `reg` to send, 0 for none.
+    const uint8_t*             tx_data;    ///< Data to transmit, may be `NULL` if `tx_length` is 0.
+    uint16_t                   tx_length;  ///< Number of bytes to transmit.
+    uint8_t*                   rx_data;    ///< Buffer to receive into, may be `NULL` if `rx_length` is 0.
+    uint16_t                   rx_length;  ///< Number of bytes to receive.
+    uint16_t                   timeout;    ///< The time in milliseconds to wait for a response from the target device.
+    i2c_transaction_callback_t callback;   ///< Called from i2c_scheduler_task() once the transaction completes, may be `NULL`.
+    void*                      context;    ///< Free for use by the callback.
+
+    // Managed by the scheduler
+    volatile i2c_status_t status;
+    volatile bool         busy;
+    void*                 waiter;
+    i2c_transaction_t*    next;
+};
+
+/**
+ * \brief Queue a transaction to run in the background.
+ *
+ * \param transaction The transaction to queue. It must not be modified until it has completed.
+ *
+ * \return `false` if the transaction is still queued, in progress, or waiting for its callback to run.
+ */
+bool i2c_transaction_submit(i2c_transaction_t* transaction);
+
+/**
+ * \brief Check whether a transaction has completed.
+ *
+ * \return `I2C_STATUS_PENDING` until the transaction completes, then the status of the transfer.
+ */
+i2c_status_t i2c_transaction_status(const i2c_transaction_t* transaction);
+
+/**
+ * \brief Wait for a transaction to complete.
+ *
+ * \return The status of the transfer, or `I2C_STATUS_SUCCESS` if the transaction was never submitted.
+ */
+i2c_status_t i2c_transaction_wait(i2c_transaction_t* transaction);
+
+/**
+ * \brief Run the callbacks of any completed transactions. Called from the main loop.
+ */
+void i2c_scheduler_task(void);
+
+/** \} */
+
+#endif // defined(I2C_SCHEDULER_ENABLE) || defined(__DOXYGEN__)
+
 /** \} */
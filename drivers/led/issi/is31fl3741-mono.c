@@ -18,6 +18,7 @@
  */
 
 #include "is31fl3741-mono.h"
+#include <string.h>
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
@@ -92,7 +93,60 @@ is31fl3741_driver_t driver_buffers[IS31FL3741_DRIVER_COUNT] = {{
     .scaling_buffer_dirty = false,
 }};
 
+#ifdef I2C_SCHEDULER_ENABLE
+// PWM flushes are queued at low priority so they don't hold up other I2C devices on the bus. Each one is the write
+// lock and page select for both PWM pages, 6 transfers of 30 bytes to page 0 and 9 transfers of 19 bytes to page 1.
+#    define IS31FL3741_PWM_TRANSACTION_COUNT (2 + 6 + 2 + 9)
+
+static i2c_transaction_t  pwm_transactions[IS31FL3741_DRIVER_COUNT][IS31FL3741_PWM_TRANSACTION_COUNT];
+static i2c_transaction_t *pwm_flush_last[IS31FL3741_DRIVER_COUNT];
+static const uint8_t      write_lock_magic = IS31FL3741_COMMAND_WRITE_LOCK_MAGIC;
+static const uint8_t      pwm_pages[]      = {IS31FL3741_COMMAND_PWM_0, IS31FL3741_COMMAND_PWM_1};
+
+// Copy of the PWM buffers taken when a flush is queued, so LEDs set while it goes out don't tear the frame
+static uint8_t pwm_transmit_buffers[IS31FL3741_DRIVER_COUNT][IS31FL3741_PWM_0_REGISTER_COUNT + IS31FL3741_PWM_1_REGISTER_COUNT];
+
+static bool is31fl3741_queue_write(i2c_transaction_t *transaction, uint8_t index, uint8_t reg, const uint8_t *data, uint8_t length) {
+    // The scheduler links queued transactions together, so they can't be filled in again until they complete
+    if (i2c_transaction_status(transaction) == I2C_STATUS_PENDING) {
+        return false;
+    }
+
+    *transaction = (i2c_transaction_t){
+        .address    = i2c_addresses[index] << 1,
+        .priority   = I2C_PRIORITY_LOW,
+        .reg        = {reg},
+        .reg_length = 1,
+        .tx_data    = data,
+        .tx_length  = length,
+        .timeout    = IS31FL3741_I2C_TIMEOUT,
+    };
+    if (!i2c_transaction_submit(transaction)) {
+        return false;
+    }
+
+    pwm_flush_last[index] = transaction;
+    return true;
+}
+
+static bool is31fl3741_pwm_flush_pending(uint8_t index) {
+    // Transactions of the same priority complete in order, so the flush is done once the last one queued is
+    return pwm_flush_last[index] && i2c_transaction_status(pwm_flush_last[index]) == I2C_STATUS_PENDING;
+}
+
+static void is31fl3741_pwm_flush_wait(uint8_t index) {
+    if (pwm_flush_last[index]) {
+        i2c_transaction_wait(pwm_flush_last[index]);
+    }
+}
+#endif // I2C_SCHEDULER_ENABLE
+
 void is31fl3741_write_register(uint8_t index, uint8_t reg, uint8_t data) {
+#ifdef I2C_SCHEDULER_ENABLE
+    // Don't change pages underneath a queued PWM flush
+    is31fl3741_pwm_flush_wait(index);
+#endif
+
 #if IS31FL3741_I2C_PERSISTENCE > 0
     for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
         if (i2c_write_register(i2c_addresses[index] << 1, reg, &data, 1, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
@@ -108,6 +162,35 @@ void is31fl3741_select_page(uint8_t index, uint8_t page) {
 }
 
 void is31fl3741_write_pwm_buffer(uint8_t index) {
+#ifdef I2C_SCHEDULER_ENABLE
+    // The previous flush still owns the transactions and the transmit buffer
+    is31fl3741_pwm_flush_wait(index);
+
+    uint8_t *transmit_buffer = pwm_transmit_buffers[index];
+    memcpy(transmit_buffer, driver_buffers[index].pwm_buffer_0, IS31FL3741_PWM_0_REGISTER_COUNT);
+    memcpy(transmit_buffer + IS31FL3741_PWM_0_REGISTER_COUNT, driver_buffers[index].pwm_buffer_1, IS31FL3741_PWM_1_REGISTER_COUNT);
+
+    i2c_transaction_t *transaction = pwm_transactions[index];
+    bool               queued      = true;
+
+    // Queued transfers aren't retried, so IS31FL3741_I2C_PERSISTENCE doesn't apply
+    for (uint8_t page = 0; queued && page < ARRAY_SIZE(pwm_pages); page++) {
+        const uint8_t *buffer = page == 0 ? transmit_buffer : transmit_buffer + IS31FL3741_PWM_0_REGISTER_COUNT;
+        uint8_t        count  = page == 0 ? IS31FL3741_PWM_0_REGISTER_COUNT : IS31FL3741_PWM_1_REGISTER_COUNT;
+        uint8_t        chunk  = page == 0 ? 30 : 19;
+
+        queued = queued && is31fl3741_queue_write(transaction++, index, IS31FL3741_REG_COMMAND_WRITE_LOCK, &write_lock_magic, 1);
+        queued = queued && is31fl3741_queue_write(transaction++, index, IS31FL3741_REG_COMMAND, &pwm_pages[page], 1);
+        for (uint8_t i = 0; queued && i < count; i += chunk) {
+            queued = is31fl3741_queue_write(transaction++, index, i, buffer + i, chunk);
+        }
+    }
+
+    if (!queued) {
+        // Send the whole frame again on the next update
+        driver_buffers[index].pwm_buffer_dirty = true;
+    }
+#else
     is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
 
     // Transmit PWM0 registers in 6 transfers of 30 bytes.
@@ -137,6 +220,7 @@ void is31fl3741_write_pwm_buffer(uint8_t index) {
         i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT);
 #endif
     }
+#endif // I2C_SCHEDULER_ENABLE
 }
 
 void is31fl3741_init_drivers(void) {
@@ -240,10 +324,18 @@ void is31fl3741_set_led_control_register(uint8_t index, bool value) {
 }
 
 void is31fl3741_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3741_write_pwm_buffer(index);
+#ifdef I2C_SCHEDULER_ENABLE
+    // Still sending the previous frame, try again next time
+    if (is31fl3741_pwm_flush_pending(index)) {
+        return;
+    }
+#endif
 
+    if (driver_buffers[index].pwm_buffer_dirty) {
+        // Cleared first, as a flush which can't be queued marks the buffer dirty again
         driver_buffers[index].pwm_buffer_dirty = false;
+
+        is31fl3741_write_pwm_buffer(index);
     }
 }
 
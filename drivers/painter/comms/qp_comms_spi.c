@@ -5,6 +5,7 @@
 
 #    include "spi_master.h"
 #    include "qp_comms_spi.h"
+#    include "qp_draw.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base SPI support
@@ -35,9 +36,17 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
     const uint8_t *p               = (const uint8_t *)data;
     const uint32_t max_msg_length  = 1024;
 
+    spi_status_t (*transmit)(const uint8_t *data, uint16_t length) = spi_transmit;
+#    if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    // The pixdata buffers aren't rewritten until after the next send has started, so they can be left in flight
+    if (qp_internal_is_pixdata_buffer(data)) {
+        transmit = spi_transmit_async;
+    }
+#    endif
+
     while (bytes_remaining > 0) {
         uint32_t bytes_this_loop = QP_MIN(bytes_remaining, max_msg_length);
-        spi_transmit(p, bytes_this_loop);
+        transmit(p, bytes_this_loop);
         p += bytes_this_loop;
         bytes_remaining -= bytes_this_loop;
     }
@@ -93,6 +102,7 @@ bool qp_comms_spi_dc_reset_init(painter_device_t device) {
 uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *data, uint32_t byte_count) {
     painter_driver_t *              driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    spi_transmit_wait();
     gpio_write_pin_high(comms_config->dc_pin);
     return qp_comms_spi_send_data(device, data, byte_count);
 }
@@ -100,6 +110,7 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
 void qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *              driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    spi_transmit_wait();
     gpio_write_pin_low(comms_config->dc_pin);
     spi_write(cmd);
 }
@@ -21,6 +21,23 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_TILE_SIZE
+/**
+ * @def This controls the size, in pixels, of the square tiles used to track which areas of a surface have been drawn to.
+ *      Only dirty tiles are transferred when drawing the surface to a display, with neighbouring tiles merged into larger
+ *      rectangles. Must be a power of two. Set to 0 to only track a single bounding box, saving RAM.
+ */
+#    define SURFACE_DIRTY_TILE_SIZE 16
+#endif
+
+#ifndef SURFACE_DIRTY_TILE_ROWS
+/**
+ * @def This controls the number of rows of dirty tiles tracked per surface, each requiring 4 bytes of RAM. Surfaces
+ *      taller than this many tiles fold the remaining rows into the last one.
+ */
+#    define SURFACE_DIRTY_TILE_ROWS 16
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -64,4 +81,24 @@ painter_device_t qp_make_mono1bpp_surface(uint16_t panel_width, uint16_t panel_h
  */
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
 
+/**
+ * Helper method to composite a stack of equally-sized surfaces and draw the result to the target device.
+ *
+ * Each pixel is taken from the highest layer that doesn't match the transparent color, falling back to the bottom
+ * layer. Only the areas dirty in any of the layers are drawn. After successful completion, the dirty areas of all
+ * layers are reset.
+ *
+ * @param layers[in] the surfaces to composite, bottom-most first
+ * @param layer_count[in] the number of surfaces in `layers`
+ * @param target[in] the target device to copy into
+ * @param x[in] the x-location of the original position of the framebuffers
+ * @param y[in] the y-location of the original position of the framebuffers
+ * @param hue_transparent[in] the hue of the transparent color, with 0-360 mapped to 0-255
+ * @param sat_transparent[in] the saturation of the transparent color, with 0-100% mapped to 0-255
+ * @param val_transparent[in] the value of the transparent color, with 0-100% mapped to 0-255
+ * @param entire_surface[in] whether the entire surface should be drawn, instead of just the dirty areas
+ * @return whether the draw operation completed successfully
+ */
+bool qp_surface_draw_layers(painter_device_t *layers, uint8_t layer_count, painter_device_t target, uint16_t x, uint16_t y, uint8_t hue_transparent, uint8_t sat_transparent, uint8_t val_transparent, bool entire_surface);
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
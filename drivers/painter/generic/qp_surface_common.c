@@ -47,6 +47,99 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
         dirty->b        = y;
         dirty->is_dirty = true;
     }
+
+#if SURFACE_DIRTY_TILE_SIZE > 0
+    // Maintain dirty tiles
+    uint16_t col = QP_MIN(x / SURFACE_DIRTY_TILE_SIZE, SURFACE_DIRTY_TILE_COLUMNS - 1);
+    uint16_t row = QP_MIN(y / SURFACE_DIRTY_TILE_SIZE, SURFACE_DIRTY_TILE_ROWS - 1);
+    dirty->tiles[row] |= (1UL << col);
+    dirty->is_dirty = true;
+#endif
+}
+
+void qp_surface_mark_all_dirty(surface_dirty_data_t *dirty, uint16_t width, uint16_t height) {
+    dirty->l        = 0;
+    dirty->t        = 0;
+    dirty->r        = width - 1;
+    dirty->b        = height - 1;
+    dirty->is_dirty = true;
+#if SURFACE_DIRTY_TILE_SIZE > 0
+    memset(dirty->tiles, 0xFF, sizeof(dirty->tiles));
+#endif
+}
+
+void qp_surface_reset_dirty(surface_dirty_data_t *dirty) {
+    dirty->l = dirty->t = UINT16_MAX;
+    dirty->r = dirty->b = 0;
+    dirty->is_dirty     = false;
+#if SURFACE_DIRTY_TILE_SIZE > 0
+    memset(dirty->tiles, 0, sizeof(dirty->tiles));
+#endif
+}
+
+// Merges the dirty areas of `src` into `dst`
+static void qp_surface_merge_dirty(surface_dirty_data_t *dst, const surface_dirty_data_t *src) {
+    if (!src->is_dirty) {
+        return;
+    }
+    dst->l        = QP_MIN(dst->l, src->l);
+    dst->t        = QP_MIN(dst->t, src->t);
+    dst->r        = QP_MAX(dst->r, src->r);
+    dst->b        = QP_MAX(dst->b, src->b);
+    dst->is_dirty = true;
+#if SURFACE_DIRTY_TILE_SIZE > 0
+    for (uint8_t row = 0; row < SURFACE_DIRTY_TILE_ROWS; ++row) {
+        dst->tiles[row] |= src->tiles[row];
+    }
+#endif
+}
+
+typedef bool (*surface_dirty_rect_callback_t)(void *cb_arg, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
+
+// Invokes the callback for each rectangle of the surface needing to be transferred
+static bool qp_surface_for_each_dirty_rect(const surface_dirty_data_t *dirty, uint16_t width, uint16_t height, bool entire_surface, surface_dirty_rect_callback_t callback, void *cb_arg) {
+    if (entire_surface) {
+        return callback(cb_arg, 0, 0, width - 1, height - 1);
+    }
+
+#if SURFACE_DIRTY_TILE_SIZE > 0
+    // Work on a copy of the tile map, as tiles are consumed as they're merged into rectangles
+    uint32_t tiles[SURFACE_DIRTY_TILE_ROWS];
+    memcpy(tiles, dirty->tiles, sizeof(tiles));
+
+    for (uint8_t row = 0; row < SURFACE_DIRTY_TILE_ROWS; ++row) {
+        while (tiles[row]) {
+            // Find the next horizontal run of dirty tiles
+            uint8_t  first = __builtin_ctzl(tiles[row]);
+            uint32_t rest  = (uint32_t)~(tiles[row] >> first);
+            uint8_t  count = rest ? __builtin_ctzl(rest) : (SURFACE_DIRTY_TILE_COLUMNS - first);
+            uint32_t mask  = ((count == 32) ? UINT32_MAX : ((1UL << count) - 1)) << first;
+
+            // Extend the run downwards for as long as the same tiles are dirty in the following rows
+            uint8_t last_row = row;
+            tiles[row] &= ~mask;
+            while (last_row + 1 < SURFACE_DIRTY_TILE_ROWS && (tiles[last_row + 1] & mask) == mask) {
+                tiles[++last_row] &= ~mask;
+            }
+
+            // Convert to pixel coordinates, with the last row/column extending to the edge of the surface, clamped to the dirty bounding box
+            uint16_t l = QP_MAX(first * SURFACE_DIRTY_TILE_SIZE, dirty->l);
+            uint16_t t = QP_MAX(row * SURFACE_DIRTY_TILE_SIZE, dirty->t);
+            uint16_t r = QP_MIN((first + count == SURFACE_DIRTY_TILE_COLUMNS) ? (width - 1) : ((first + count) * SURFACE_DIRTY_TILE_SIZE - 1), dirty->r);
+            uint16_t b = QP_MIN((last_row == SURFACE_DIRTY_TILE_ROWS - 1) ? (height - 1) : ((last_row + 1) * SURFACE_DIRTY_TILE_SIZE - 1), dirty->b);
+            if (l > r || t > b) {
+                continue;
+            }
+
+            if (!callback(cb_arg, l, t, r, b)) {
+                return false;
+            }
+        }
+    }
+    return true;
+#else
+    return callback(cb_arg, dirty->l, dirty->t, dirty->r, dirty->b);
+#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,13 +149,7 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     painter_driver_t *        driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
     memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
-
-    surface->dirty.l        = 0;
-    surface->dirty.t        = 0;
-    surface->dirty.r        = surface->base.panel_width - 1;
-    surface->dirty.b        = surface->base.panel_height - 1;
-    surface->dirty.is_dirty = true;
-
+    qp_surface_mark_all_dirty(&surface->dirty, surface->base.panel_width, surface->base.panel_height);
     return true;
 }
 
@@ -80,9 +167,7 @@ bool qp_surface_clear(painter_device_t device) {
 bool qp_surface_flush(painter_device_t device) {
     painter_driver_t *        driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
-    surface->dirty.l = surface->dirty.t = UINT16_MAX;
-    surface->dirty.r = surface->dirty.b = 0;
-    surface->dirty.is_dirty             = false;
+    qp_surface_reset_dirty(&surface->dirty);
     return true;
 }
 
@@ -105,6 +190,19 @@ bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, u
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Drawing routine to copy out the dirty region and send it to another device
 
+typedef struct surface_draw_args_t {
+    painter_driver_t *surface_driver;
+    painter_driver_t *target_driver;
+    uint16_t          x;
+    uint16_t          y;
+} surface_draw_args_t;
+
+static bool qp_surface_draw_rect(void *cb_arg, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    surface_draw_args_t             *args   = (surface_draw_args_t *)cb_arg;
+    surface_painter_driver_vtable_t *vtable = (surface_painter_driver_vtable_t *)args->surface_driver->driver_vtable;
+    return vtable->target_pixdata_transfer(args->surface_driver, args->target_driver, args->x, args->y, l, t, r, b);
+}
+
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface) {
     painter_driver_t *        surface_driver = (painter_driver_t *)surface;
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
@@ -122,9 +220,9 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
         return false;
     }
 
-    // Offload to the pixdata transfer function
-    surface_painter_driver_vtable_t *vtable = (surface_painter_driver_vtable_t *)surface_driver->driver_vtable;
-    bool                             ok     = vtable->target_pixdata_transfer(surface_driver, target_driver, x, y, entire_surface);
+    // Offload each dirty area to the pixdata transfer function
+    surface_draw_args_t args = {.surface_driver = surface_driver, .target_driver = target_driver, .x = x, .y = y};
+    bool                ok   = qp_surface_for_each_dirty_rect(&surface_handle->dirty, surface_driver->panel_width, surface_driver->panel_height, entire_surface, qp_surface_draw_rect, &args);
     if (!ok) {
         qp_dprintf("qp_surface_draw: fail (could not transfer pixel data)\n");
         return false;
@@ -139,3 +237,84 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
     qp_dprintf("qp_surface_draw: ok\n");
     return true;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Drawing routine to composite the dirty regions of several surfaces and send the result to another device
+
+typedef struct surface_draw_layers_args_t {
+    painter_driver_t **layer_drivers;
+    uint8_t            layer_count;
+    painter_driver_t * target_driver;
+    uint16_t           x;
+    uint16_t           y;
+    qp_pixel_t         transparent;
+} surface_draw_layers_args_t;
+
+static bool qp_surface_draw_layers_rect(void *cb_arg, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    surface_draw_layers_args_t *     args   = (surface_draw_layers_args_t *)cb_arg;
+    surface_painter_driver_vtable_t *vtable = (surface_painter_driver_vtable_t *)args->layer_drivers[0]->driver_vtable;
+    return vtable->layers_pixdata_transfer(args->layer_drivers, args->layer_count, args->target_driver, args->x, args->y, l, t, r, b, &args->transparent);
+}
+
+bool qp_surface_draw_layers(painter_device_t *layers, uint8_t layer_count, painter_device_t target, uint16_t x, uint16_t y, uint8_t hue_transparent, uint8_t sat_transparent, uint8_t val_transparent, bool entire_surface) {
+    if (layer_count == 0) {
+        qp_dprintf("qp_surface_draw_layers: fail (no layers)\n");
+        return false;
+    }
+
+    painter_driver_t **              layer_drivers = (painter_driver_t **)layers;
+    painter_driver_t *               bottom_driver = layer_drivers[0];
+    painter_driver_t *               target_driver = (painter_driver_t *)target;
+    surface_painter_driver_vtable_t *vtable        = (surface_painter_driver_vtable_t *)bottom_driver->driver_vtable;
+
+    // If we have incompatible bit depths, drop out
+    if (bottom_driver->native_bits_per_pixel != target_driver->native_bits_per_pixel) {
+        qp_dprintf("qp_surface_draw_layers: fail (incompatible bpp: surface=%d, target=%d)\n", (int)bottom_driver->native_bits_per_pixel, (int)target_driver->native_bits_per_pixel);
+        return false;
+    }
+
+    if (!vtable->layers_pixdata_transfer) {
+        qp_dprintf("qp_surface_draw_layers: fail (compositing not supported by surface type)\n");
+        return false;
+    }
+
+    // All layers must be the same type and size, and the dirty areas of all of them need to be redrawn
+    surface_dirty_data_t dirty;
+    qp_surface_reset_dirty(&dirty);
+    for (uint8_t i = 0; i < layer_count; ++i) {
+        if (layer_drivers[i]->driver_vtable != bottom_driver->driver_vtable || layer_drivers[i]->panel_width != bottom_driver->panel_width || layer_drivers[i]->panel_height != bottom_driver->panel_height) {
+            qp_dprintf("qp_surface_draw_layers: fail (layer %d does not match the bottom layer)\n", (int)i);
+            return false;
+        }
+        qp_surface_merge_dirty(&dirty, &((surface_painter_device_t *)layer_drivers[i])->dirty);
+    }
+
+    // If we're not dirty... we're done.
+    if (!dirty.is_dirty) {
+        qp_dprintf("qp_surface_draw_layers: ok (not dirty, skipping)\n");
+        return true;
+    }
+
+    // Convert the transparent color to the native format of the layers
+    surface_draw_layers_args_t args = {.layer_drivers = layer_drivers, .layer_count = layer_count, .target_driver = target_driver, .x = x, .y = y, .transparent = {.hsv888 = {.h = hue_transparent, .s = sat_transparent, .v = val_transparent}}};
+    if (!vtable->base.palette_convert((painter_device_t)bottom_driver, 1, &args.transparent)) {
+        qp_dprintf("qp_surface_draw_layers: fail (could not convert transparent color)\n");
+        return false;
+    }
+
+    // Offload each dirty area to the pixdata transfer function
+    if (!qp_surface_for_each_dirty_rect(&dirty, bottom_driver->panel_width, bottom_driver->panel_height, entire_surface, qp_surface_draw_layers_rect, &args)) {
+        qp_dprintf("qp_surface_draw_layers: fail (could not transfer pixel data)\n");
+        return false;
+    }
+
+    // Clear the dirty info for all the layers
+    for (uint8_t i = 0; i < layer_count; ++i) {
+        if (!qp_flush(layers[i])) {
+            qp_dprintf("qp_surface_draw_layers: fail (could not flush layer %d)\n", (int)i);
+            return false;
+        }
+    }
+    qp_dprintf("qp_surface_draw_layers: ok\n");
+    return true;
+}
@@ -13,15 +13,26 @@
 typedef struct surface_painter_driver_vtable_t {
     painter_driver_vtable_t base; // must be first, so it can be cast to/from the painter_driver_vtable_t* type
 
-    bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface);
+    // Transfers the region [l,t]-[r,b] of the surface to the target, offset by [x,y]
+    bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
+
+    // Transfers the region [l,t]-[r,b] of the stacked layers to the target, offset by [x,y] -- higher layers take precedence unless the pixel matches the transparent color. NULL if unsupported.
+    bool (*layers_pixdata_transfer)(painter_driver_t **layer_drivers, uint8_t layer_count, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b, const qp_pixel_t *transparent);
 } surface_painter_driver_vtable_t;
 
+// Number of tile columns tracked in the dirty map, one bit each
+#define SURFACE_DIRTY_TILE_COLUMNS 32
+
 typedef struct surface_dirty_data_t {
     bool     is_dirty;
     uint16_t l;
     uint16_t t;
     uint16_t r;
     uint16_t b;
+#    if SURFACE_DIRTY_TILE_SIZE > 0
+    // Bitmap of dirty tiles within the bounding box, one word per row of tiles. Tiles past the last row/column absorb the remainder of the surface.
+    uint32_t tiles[SURFACE_DIRTY_TILE_ROWS];
+#    endif
 } surface_dirty_data_t;
 
 typedef struct surface_viewport_data_t {
@@ -89,6 +100,8 @@ bool qp_surface_flush(painter_device_t device);
 bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
+void qp_surface_mark_all_dirty(surface_dirty_data_t *dirty, uint16_t width, uint16_t height);
+void qp_surface_reset_dirty(surface_dirty_data_t *dirty);
 
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
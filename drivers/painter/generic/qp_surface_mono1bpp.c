@@ -84,7 +84,7 @@ static bool qp_surface_append_pixels_mono1bpp(painter_device_t device, uint8_t *
     return true;
 }
 
-static bool mono1bpp_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+static bool mono1bpp_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
     return false; // Not yet supported.
 }
 
@@ -106,6 +106,7 @@ const surface_painter_driver_vtable_t mono1bpp_surface_driver_vtable = {
             .append_pixdata  = qp_surface_append_pixdata_mono1bpp,
         },
     .target_pixdata_transfer = mono1bpp_target_pixdata_transfer,
+    .layers_pixdata_transfer = NULL,
 };
 
 SURFACE_FACTORY_FUNCTION_IMPL(qp_make_mono1bpp_surface, mono1bpp_surface_driver_vtable, 1);
@@ -68,40 +68,49 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
-    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
-
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
+static bool rgb565_layers_pixdata_transfer(painter_driver_t **layer_drivers, uint8_t layer_count, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b, const qp_pixel_t *transparent) {
+    surface_painter_device_t *bottom_handle = (surface_painter_device_t *)layer_drivers[0];
+    uint16_t                  width         = bottom_handle->base.panel_width;
 
     // Set the target drawing area
     bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
     if (!ok) {
-        qp_dprintf("rgb565_target_pixdata_transfer: fail (could not set target viewport)\n");
+        qp_dprintf("rgb565_layers_pixdata_transfer: fail (could not set target viewport)\n");
         return false;
     }
 
     // Housekeeping of the amount of pixels to transfer
-    uint32_t  total_pixel_count = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / surface_driver->native_bits_per_pixel;
+    uint32_t  total_pixel_count = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / bottom_handle->base.native_bits_per_pixel;
     uint32_t  pixel_counter     = 0;
     uint16_t *target_buffer     = (uint16_t *)qp_internal_global_pixdata_buffer;
 
     // Fill the global pixdata area so that we can start transferring to the panel
-    for (uint16_t y = t; y <= b; ++y) {
-        for (uint16_t x = l; x <= r; ++x) {
+    for (uint16_t py = t; py <= b; ++py) {
+        for (uint16_t px = l; px <= r; ++px) {
+            // Take the pixel from the highest layer that isn't transparent, falling back to the bottom layer
+            uint32_t offset = py * width + px;
+            uint16_t pixel  = bottom_handle->u16buffer[offset];
+            for (uint8_t i = layer_count - 1; i > 0; --i) {
+                uint16_t layer_pixel = ((surface_painter_device_t *)layer_drivers[i])->u16buffer[offset];
+                if (layer_pixel != transparent->rgb565) {
+                    pixel = layer_pixel;
+                    break;
+                }
+            }
+
             // Update the target buffer
-            target_buffer[pixel_counter++] = surface_handle->u16buffer[y * surface_handle->base.panel_width + x];
+            target_buffer[pixel_counter++] = pixel;
 
             // If we've accumulated enough data, send it
             if (pixel_counter == total_pixel_count) {
                 ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
                 if (!ok) {
-                    qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+                    qp_dprintf("rgb565_layers_pixdata_transfer: fail (could not stream pixdata to target)\n");
                     return false;
                 }
-                // Reset the counter
+                // Reset the counter, filling the other buffer while this one is sent if double-buffered
+                qp_internal_swap_pixdata_buffer();
+                target_buffer = (uint16_t *)qp_internal_global_pixdata_buffer;
                 pixel_counter = 0;
             }
         }
@@ -111,14 +120,20 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     if (pixel_counter > 0) {
         ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
         if (!ok) {
-            qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+            qp_dprintf("rgb565_layers_pixdata_transfer: fail (could not stream pixdata to target)\n");
             return false;
         }
+        qp_internal_swap_pixdata_buffer();
     }
 
     return true;
 }
 
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    // A single layer never needs to check for transparency
+    return rgb565_layers_pixdata_transfer(&surface_driver, 1, target_driver, x, y, l, t, r, b, NULL);
+}
+
 static bool qp_surface_append_pixdata_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
     target_buffer[pixdata_offset] = pixdata_byte;
     return true;
@@ -138,6 +153,7 @@ const surface_painter_driver_vtable_t rgb565_surface_driver_vtable = {
             .append_pixdata  = qp_surface_append_pixdata_rgb565,
         },
     .target_pixdata_transfer = rgb565_target_pixdata_transfer,
+    .layers_pixdata_transfer = rgb565_layers_pixdata_transfer,
 };
 
 SURFACE_FACTORY_FUNCTION_IMPL(qp_make_rgb565_surface, rgb565_surface_driver_vtable, 16);
@@ -25,6 +25,8 @@
 void soft_serial_initiator_init(void);
 // target is interrupt accept side
 void soft_serial_target_init(void);
+// target has updated its side of the shared memory
+void soft_serial_target_sync(void);
 
 bool soft_serial_transaction(int sstd_index);
 
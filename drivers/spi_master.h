@@ -93,6 +93,23 @@ spi_status_t spi_read(void);
  */
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+/**
+ * \brief Start sending multiple bytes to the selected SPI device, returning before the transfer has completed where the platform supports it.
+ *
+ * \param data A pointer to the data to write from. The data must remain valid and unmodified until `spi_transmit_wait()` has been called.
+ * \param length The number of bytes to write. Take care not to overrun the length of `data`.
+ *
+ * \return `SPI_STATUS_ERROR` if the transfer could not be started, otherwise `SPI_STATUS_SUCCESS`.
+ */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+/**
+ * \brief Wait for any transfer started by `spi_transmit_async()` to complete. All other SPI operations wait implicitly.
+ *
+ * \return `SPI_STATUS_TIMEOUT` if the timeout period elapses, `SPI_STATUS_ERROR` if some other error occurs, otherwise `SPI_STATUS_SUCCESS`.
+ */
+spi_status_t spi_transmit_wait(void);
+
 /**
  * \brief Receive multiple bytes from the selected SPI device.
  *
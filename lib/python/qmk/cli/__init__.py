@@ -37,6 +37,7 @@ subcommands = [
     'qmk.cli.cd',
     'qmk.cli.chibios.confmigrate',
     'qmk.cli.clean',
+    'qmk.cli.console_decode',
     'qmk.cli.compile',
     'qmk.cli.docs',
     'qmk.cli.doctor',
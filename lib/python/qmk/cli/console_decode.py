@@ -0,0 +1,81 @@
+"""Decode tokenized console output.
+"""
+import sys
+
+from argcomplete.completers import FilesCompleter
+from milc import cli
+
+from qmk.path import normpath
+from qmk.tokenized_print import ElfStrings, TokenizedPrintDecoder
+
+CONSOLE_USAGE_PAGE = 0xFF31
+CONSOLE_USAGE = 0x0074
+
+
+def _find_console(device):
+    """Returns the HID path of the first QMK console, optionally matching a VID:PID.
+    """
+    import hid
+
+    for info in hid.enumerate():
+        if info['usage_page'] != CONSOLE_USAGE_PAGE or info['usage'] != CONSOLE_USAGE:
+            continue
+        if device and f"{info['vendor_id']:04x}:{info['product_id']:04x}" != device.lower():
+            continue
+        return info['path']
+
+    return None
+
+
+def _read_console(path):
+    """Yields console reports as they arrive from the keyboard.
+    """
+    import hid
+
+    console = hid.Device(path=path)
+    try:
+        while True:
+            report = console.read(64, timeout=1000)
+            if report:
+                yield report
+    finally:
+        console.close()
+
+
+@cli.argument('-e', '--elf', arg_only=True, required=True, type=normpath, completer=FilesCompleter('.elf'), help='The ELF file of the firmware running on the keyboard.')
+@cli.argument('-d', '--device', help='Only read from the console of the keyboard with this VID:PID.')
+@cli.argument('input', nargs='?', arg_only=True, completer=FilesCompleter(), help='A file containing raw console output to decode, or - for stdin. Reads from the keyboard when omitted.')
+@cli.subcommand('Decode the output of firmware built with TOKENIZED_PRINT_ENABLE.')
+def console_decode(cli):
+    """Decode tokenized console output.
+
+    Format strings are looked up in the firmware's ELF file, which must come from the same build that is running on the keyboard.
+    """
+    if not cli.args.elf.exists():
+        cli.log.error('ELF file %s does not exist.', cli.args.elf)
+        return False
+
+    decoder = TokenizedPrintDecoder(ElfStrings(cli.args.elf.read_bytes()))
+
+    if cli.args.input:
+        if cli.args.input == '-':
+            data = sys.stdin.buffer.read()
+        else:
+            data = normpath(cli.args.input).read_bytes()
+        sys.stdout.write(decoder.feed(data))
+        return True
+
+    path = _find_console(cli.config.console_decode.device)
+    if not path:
+        cli.log.error('No QMK console found.')
+        return False
+
+    cli.log.info('Reading from {fg_cyan}%s{fg_reset}, press Ctrl-C to stop.', path.decode(errors='replace') if isinstance(path, bytes) else path)
+    try:
+        for report in _read_console(path):
+            sys.stdout.write(decoder.feed(report))
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+
+    return True
@@ -24,10 +24,13 @@ Example:
   lenght        -> length
   ouput         -> output
   widht         -> width
+Passing --automaton emits a dense Aho-Corasick automaton instead of the trie,
+optionally with --binary to place the automaton in external SPI flash.
 For full documentation, see QMK Docs
 """
 
 import textwrap
+from collections import deque
 from typing import Any, Dict, Iterator, List, Tuple
 
 from milc import cli
@@ -49,6 +52,10 @@ TYPO_CHARS = dict([
 ] + [(chr(c), c + KC_A - ord('a')) for c in range(ord('a'),
                                                   ord('z') + 1)])  # Characters a-z.
 
+# Input symbol order of the automaton transition rows, must match
+# `autocorrect_automaton_symbol()` in process_autocorrect.c.
+AUTOMATON_SYMBOLS = [chr(c) for c in range(ord('a'), ord('z') + 1)] + ["'", ':']
+
 
 def parse_file(file_name: str) -> List[Tuple[str, str]]:
     """Parses autocorrections dictionary file.
@@ -80,6 +87,9 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
 
     autocorrections = []
     typos = set()
+    # Every substring of an accepted typo, mapped to the typo it came from. This
+    # keeps the substring check linear in the dictionary size.
+    typo_substrings = {}
     for line_number, typo, correction in parse_file_lines(file_name):
         if typo in typos:
             cli.log.warning('{fg_red}Error:%d:{fg_reset} Ignoring duplicate typo: "{fg_cyan}%s{fg_reset}"', line_number, typo)
@@ -89,10 +99,10 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
         if not (all([c in TYPO_CHARS for c in typo])):
             cli.log.error('{fg_red}Error:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" has characters other than a-z, \' and :.', line_number, typo)
             maybe_exit(1)
-        for other_typo in typos:
-            if typo in other_typo or other_typo in typo:
-                cli.log.error('{fg_red}Error:%d:{fg_reset} Typos may not be substrings of one another, otherwise the longer typo would never trigger: "{fg_cyan}%s{fg_reset}" vs. "{fg_cyan}%s{fg_reset}".', line_number, typo, other_typo)
-                maybe_exit(1)
+        other_typo = typo_substrings.get(typo) or next((sub for sub in substrings(typo) if sub in typos), None)
+        if other_typo:
+            cli.log.error('{fg_red}Error:%d:{fg_reset} Typos may not be substrings of one another, otherwise the longer typo would never trigger: "{fg_cyan}%s{fg_reset}" vs. "{fg_cyan}%s{fg_reset}".', line_number, typo, other_typo)
+            maybe_exit(1)
         if len(typo) < 5:
             cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} It is suggested that typos are at least 5 characters long to avoid false triggers: "{fg_cyan}%s{fg_reset}"', line_number, typo)
         if len(typo) > 127:
@@ -103,10 +113,19 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
 
         autocorrections.append((typo, correction))
         typos.add(typo)
+        for sub in substrings(typo):
+            typo_substrings.setdefault(sub, typo)
 
     return autocorrections
 
 
+def substrings(word: str) -> Iterator[str]:
+    """Yields every non-empty substring of `word`, including `word` itself."""
+    for start in range(len(word)):
+        for end in range(start + 1, len(word) + 1):
+            yield word[start:end]
+
+
 def make_trie(autocorrections: List[Tuple[str, str]]) -> Dict[str, Any]:
     """Makes a trie from the the typos, writing in reverse.
   Args:
@@ -179,16 +198,7 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     def traverse(trie_node):
         if 'LEAF' in trie_node:  # Handle a leaf trie node.
             typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
+            data = make_correction(typo, correction)
 
             entry = {'data': data, 'links': [], 'byte_offset': 0}
             table.append(entry)
@@ -241,6 +251,104 @@ def encode_link(link: Dict[str, Any]) -> List[int]:
     return [byte_offset & 255, byte_offset >> 8]
 
 
+def make_correction(typo: str, correction: str) -> List[int]:
+    """Encodes the backspace count and replacement text for a typo.
+
+  The record layout is shared by the trie leaves and the automaton outputs.
+  """
+    word_boundary_ending = typo[-1] == ':'
+    typo = typo.strip(':')
+    i = 0
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    assert 0 <= backspaces <= 63
+    return [backspaces + 128] + list(bytes(correction[i:], 'ascii')) + [0]
+
+
+def make_automaton(autocorrections: List[Tuple[str, str]]) -> Tuple[List[int], int, int, int]:
+    """Builds a dense Aho-Corasick automaton over the typos.
+
+  Unlike the trie, which is walked backwards over the typed buffer on every
+  keypress, the automaton carries a single state forward, so each keystroke
+  costs exactly one table lookup.
+
+  Layout: one row per state, each row holding `word_size` little endian words.
+  The first word is the byte offset of the state's correction record (0 if
+  the state does not complete a typo), followed by one word per symbol of
+  `AUTOMATON_SYMBOLS` holding the next state. The top bit of a next state word
+  is set when that state completes a typo, so the common, non-matching case
+  never reads the output word. Correction records follow the rows.
+  Args:
+    autocorrections: List of (typo, correction) tuples.
+  Returns:
+    Tuple of (data bytes, state count, word size, start state). The start
+    state is the state after a word break, which the runtime begins from.
+  """
+    goto = [{}]
+    output = [None]
+    for typo, correction in autocorrections:
+        state = 0
+        for c in typo:
+            if c not in goto[state]:
+                goto[state][c] = len(goto)
+                goto.append({})
+                output.append(None)
+            state = goto[state][c]
+        output[state] = (typo, correction)
+
+    # Breadth-first completion of the goto function into a full transition
+    # table, following failure links for missing edges.
+    num_states = len(goto)
+    delta = [[0] * len(AUTOMATON_SYMBOLS) for _ in range(num_states)]
+    fail = [0] * num_states
+    queue = deque()
+    for i, c in enumerate(AUTOMATON_SYMBOLS):
+        if c in goto[0]:
+            delta[0][i] = goto[0][c]
+            queue.append(goto[0][c])
+    while queue:
+        state = queue.popleft()
+        if output[state] is None:
+            output[state] = output[fail[state]]
+        for i, c in enumerate(AUTOMATON_SYMBOLS):
+            if c in goto[state]:
+                child = goto[state][c]
+                fail[child] = delta[fail[state]][i]
+                delta[state][i] = child
+                queue.append(child)
+            else:
+                delta[state][i] = delta[fail[state]][i]
+
+    records = {}
+    corrections = []
+    for typo, correction in autocorrections:
+        records[typo] = len(corrections)
+        corrections += make_correction(typo, correction)
+
+    row_words = 1 + len(AUTOMATON_SYMBOLS)
+    for word_size in (2, 3, 4):
+        table_size = num_states * row_words * word_size
+        if num_states < (1 << (8 * word_size - 1)) and table_size + len(corrections) < (1 << (8 * word_size)):
+            break
+    else:
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection automaton exceeds 4GB.')
+        maybe_exit(1)
+
+    def encode_word(value: int) -> List[int]:
+        return [(value >> (8 * i)) & 255 for i in range(word_size)]
+
+    terminal = 1 << (8 * word_size - 1)
+    data = []
+    for state in range(num_states):
+        data += encode_word(table_size + records[output[state][0]] if output[state] else 0)
+        for next_state in delta[state]:
+            data += encode_word(next_state | (terminal if output[next_state] else 0))
+
+    start_state = delta[0][AUTOMATON_SYMBOLS.index(':')]
+    return data + corrections, num_states, word_size, start_state
+
+
 def typo_len(e: Tuple[str, str]) -> int:
     return len(e[0])
 
@@ -254,11 +362,16 @@ def to_hex(b: int) -> str:
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('-a', '--automaton', arg_only=True, action='store_true', help="Generate a streaming Aho-Corasick automaton instead of a trie")
+@cli.argument('-b', '--binary', arg_only=True, type=normpath, help='Write the automaton to this file for external flash instead of embedding it (implies --automaton)')
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
-    trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    if cli.args.automaton or cli.args.binary:
+        data, num_states, word_size, start_state = make_automaton(autocorrections)
+    else:
+        trie = make_trie(autocorrections)
+        data = serialize_trie(autocorrections, trie)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -282,10 +395,22 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
+    if cli.args.automaton or cli.args.binary:
+        autocorrect_data_h_lines.append('')
+        autocorrect_data_h_lines.append('#define AUTOCORRECT_AUTOMATON')
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_AUTOMATON_STATES {num_states}')
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_AUTOMATON_WORD_SIZE {word_size}')
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_AUTOMATON_START {start_state}')
     autocorrect_data_h_lines.append('')
-    autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
-    autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
-    autocorrect_data_h_lines.append('};')
+    if cli.args.binary:
+        cli.args.binary.parent.mkdir(parents=True, exist_ok=True)
+        cli.args.binary.write_bytes(bytes(data))
+        autocorrect_data_h_lines.append(f'// Automaton image written to {cli.args.binary.name}, flash it at AUTOCORRECT_AUTOMATON_FLASH_ADDRESS.')
+        autocorrect_data_h_lines.append('#define AUTOCORRECT_AUTOMATON_EXTERNAL_FLASH')
+    else:
+        autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
+        autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
+        autocorrect_data_h_lines.append('};')
 
     # Show the results
     dump_lines(cli.args.output, autocorrect_data_h_lines, cli.args.quiet)
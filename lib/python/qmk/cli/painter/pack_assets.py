@@ -0,0 +1,38 @@
+"""Packs QGF/QFF files into a single image for external flash.
+"""
+import struct
+from qmk.path import normpath
+from milc import cli
+
+QP_FLASH_ASSET_INDEX_MAGIC = 0x49415051  # "QPAI"
+
+
+@cli.argument('-o', '--output', required=True, help='Specify output flash image path.')
+@cli.argument('inputs', nargs='+', arg_only=True, help='QGF/QFF files to pack, in asset ID order.')
+@cli.subcommand('Packs Quantum Painter images and fonts into a flash image with an asset index')
+def painter_pack_assets(cli):
+    """Packs raw QGF/QFF files (as generated with `--raw`) behind an asset index, so they can be written to external flash and loaded with `qp_load_image_flash_asset()`/`qp_load_font_flash_asset()`.
+
+    Asset IDs are assigned in the order the files are supplied, starting at 0.
+    """
+    assets = []
+    for input_file in cli.args.inputs:
+        input_file = normpath(input_file)
+        if not input_file.exists():
+            cli.log.error('Input file %s does not exist!', input_file)
+            return False
+        assets.append(input_file.read_bytes())
+
+    # Index header, followed by an (offset, length) entry per asset, with offsets relative to the start of the index
+    index = struct.pack('<IHH', QP_FLASH_ASSET_INDEX_MAGIC, len(assets), 0)
+    offset = len(index) + 8 * len(assets)
+    for asset in assets:
+        index += struct.pack('<II', offset, len(asset))
+        offset += len(asset)
+
+    output_file = normpath(cli.args.output)
+    output_file.write_bytes(index + b''.join(assets))
+
+    for asset_id, input_file in enumerate(cli.args.inputs):
+        cli.log.info('Asset %d: %s', asset_id, input_file)
+    cli.log.info('Wrote %d assets (%d bytes) to %s', len(assets), offset, output_file)
@@ -817,6 +817,9 @@ def _matrix_size(info_data):
         elif 'cols' in info_data['matrix_pins'] and 'rows' in info_data['matrix_pins']:
             info_data['matrix_size']['cols'] = len(info_data['matrix_pins']['cols'])
             info_data['matrix_size']['rows'] = len(info_data['matrix_pins']['rows'])
+        elif 'cols' in info_data['matrix_pins'].get('io_expander', {}) and 'rows' in info_data['matrix_pins'].get('io_expander', {}):
+            info_data['matrix_size']['cols'] = len(info_data['matrix_pins']['io_expander']['cols'])
+            info_data['matrix_size']['rows'] = len(info_data['matrix_pins']['io_expander']['rows'])
 
         # Assumption of split common
         if 'split' in info_data:
@@ -850,6 +853,12 @@ def _check_matrix(info_data):
         elif 'cols' in info_data['matrix_pins'] and 'rows' in info_data['matrix_pins']:
             col_count = len(info_data['matrix_pins']['cols'])
             row_count = len(info_data['matrix_pins']['rows'])
+        elif 'io_expander' in info_data['matrix_pins']:
+            col_count = len(info_data['matrix_pins']['io_expander'].get('cols', []))
+            row_count = len(info_data['matrix_pins']['io_expander'].get('rows', []))
+        elif 'shift_register' in info_data['matrix_pins']:
+            # Only one side of the matrix is connected to MCU pins, the other is driven by the shift registers
+            return
         elif 'cols' not in info_data['matrix_pins'] and 'rows' not in info_data['matrix_pins']:
             # This case caters for custom matrix implementations where normal rows/cols are specified
             return
@@ -122,10 +122,15 @@ def _render_image_metadata(metadata):
             if not v["delta"]:
                 continue
 
+            # Empty delta frames aren't drawn at all
+            if v["delta_rect"] is None:
+                deltas.append(f"// Frame {i:3d}: unchanged")
+                continue
+
             # Unpack rect's coords
             l, t, r, b = v["delta_rect"]
 
-            delta_px = (r - l) * (b - t)
+            delta_px = (r - l + 1) * (b - t + 1)
             px = size["width"] * size["height"]
 
             # FIXME: May need need more chars here too
@@ -8,7 +8,7 @@
 import functools
 from colorsys import rgb_to_hsv
 from types import FunctionType
-from PIL import Image, ImageFile, ImageChops
+from PIL import Image, ImageFile, ImageChops, ImageOps
 from PIL._binary import o8, o16le as o16, o32le as o32
 import qmk.painter
 
@@ -260,55 +260,78 @@ def _for_all_frames(x: FunctionType, /, images):
             frame_num += 1
 
 
-def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwargs):
-    # Convert the original frame so we can do comparisons
-    converted = qmk.painter.convert_requested_format(frame, format_)
+def _encode_image(image, *, use_rle, format_):
+    # Convert the frame to the requested format
+    converted = qmk.painter.convert_requested_format(image, format_)
     graphic_data = qmk.painter.convert_image_bytes(converted, format_)
 
-    # Convert the raw data to RLE-encoded if requested
+    # Convert the raw data to RLE-encoded if requested, and if it's actually smaller
     raw_data = graphic_data[1]
     if use_rle:
-        rle_data = qmk.painter.compress_bytes_qmk_rle(graphic_data[1])
-    use_raw_this_frame = not use_rle or len(raw_data) <= len(rle_data)
-    image_data = raw_data if use_raw_this_frame else rle_data
+        rle_data = qmk.painter.compress_bytes_qmk_rle(raw_data)
+    use_raw = not use_rle or len(raw_data) <= len(rle_data)
+    return graphic_data, raw_data if use_raw else rle_data, use_raw
+
+
+def _displayed_pixels(frame, format_):
+    # Work out what the display will actually show for this frame, so that differences which disappear when converting
+    # to the output format don't inflate a delta frame's bounding box
+    image_format = format_["image_format"]
+    if image_format == 'IMAGE_FORMAT_GRAYSCALE':
+        maxval = format_["num_colors"] - 1
+        return ImageOps.grayscale(frame).point(lambda v: qmk.painter.rescale_byte(v, maxval))
+    elif image_format == 'IMAGE_FORMAT_RGB565':
+        return frame.point([v & 0xF8 for v in range(256)] + [v & 0xFC for v in range(256)] + [v & 0xF8 for v in range(256)])
+
+    # Palettes are generated per-frame, so only the source pixels can be compared
+    return frame
+
+
+def _changed_bbox(frame, last_frame, format_):
+    diff = ImageChops.difference(_displayed_pixels(frame, format_), _displayed_pixels(last_frame, format_))
+    return diff.getbbox()
+
 
-    # Work out if a delta frame is smaller than injecting it directly
+def _fold_unchanged_frames(frames, format_):
+    # Frames identical to their predecessor are merged into its delay, so they never get drawn
+    folded = []
+    for frame in frames:
+        if folded and _changed_bbox(frame, folded[-1], format_) is None:
+            delay = folded[-1].info.get('duration', 1000) + frame.info.get('duration', 1000)
+            # Delays are 16-bit, so longer pauses still need an (empty) frame of their own
+            if delay <= 0xFFFF:
+                folded[-1].info['duration'] = delay
+                continue
+        folded.append(frame)
+    return folded
+
+
+def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwargs):
+    # Encode the whole frame
+    graphic_data, image_data, use_raw_this_frame = _encode_image(frame, use_rle=use_rle, format_=format_)
+
+    # Work out if only part of the frame needs to be redrawn
     use_delta_this_frame = False
     bbox = None
     if use_deltas and last_frame is not None:
-        # If we want to use deltas, then find the difference
-        diff = ImageChops.difference(frame, last_frame)
-
-        # Get the bounding box of those differences
-        bbox = diff.getbbox()
-
-        # If we have a valid bounding box...
-        if bbox:
-            # ...create the delta frame by cropping the original.
-            delta_frame = frame.crop(bbox)
-
-            # Convert the delta frame to the requested format
-            delta_converted = qmk.painter.convert_requested_format(delta_frame, format_)
-            delta_graphic_data = qmk.painter.convert_image_bytes(delta_converted, format_)
-
-            # Work out how large the delta frame is going to be with compression etc.
-            delta_raw_data = delta_graphic_data[1]
-            if use_rle:
-                delta_rle_data = qmk.painter.compress_bytes_qmk_rle(delta_graphic_data[1])
-            delta_use_raw_this_frame = not use_rle or len(delta_raw_data) <= len(delta_rle_data)
-            delta_image_data = delta_raw_data if delta_use_raw_this_frame else delta_rle_data
-
-            # If the size of the delta frame (plus delta descriptor) is smaller than the original, use that instead
-            # This ensures that if a non-delta is overall smaller in size, we use that in preference due to flash
-            # sizing constraints.
-            if (len(delta_image_data) + QGFFrameDeltaDescriptorV1.length) < len(image_data):
-                # Copy across all the delta equivalents so that the rest of the processing acts on those
-                graphic_data = delta_graphic_data
-                raw_data = delta_raw_data
-                rle_data = delta_rle_data
-                use_raw_this_frame = delta_use_raw_this_frame
-                image_data = delta_image_data
-                use_delta_this_frame = True
+        # Get the bounding box of the pixels which actually change on the display
+        bbox = _changed_bbox(frame, last_frame, format_)
+
+        if bbox is None:
+            # Nothing changed at all -- a delta frame without any data is skipped entirely at runtime
+            image_data = []
+            use_raw_this_frame = True
+            use_delta_this_frame = True
+            bbox = (0, 0, 1, 1)
+
+        elif bbox != (0, 0, *frame.size):
+            # Drawing time on the display is proportional to the area drawn, so prefer the delta frame whenever it
+            # covers less than the whole image, even if the encoded data happens to be a few bytes larger
+            delta_graphic_data, delta_image_data, delta_use_raw_this_frame = _encode_image(frame.crop(bbox), use_rle=use_rle, format_=format_)
+            graphic_data = delta_graphic_data
+            image_data = delta_image_data
+            use_raw_this_frame = delta_use_raw_this_frame
+            use_delta_this_frame = True
 
         # Default to whole image
         bbox = bbox or [0, 0, *frame.size]
@@ -383,7 +406,7 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
             delta_descriptor.top,
             delta_descriptor.right,
             delta_descriptor.bottom,
-        ]})
+        ] if len(image_data) > 0 else None})
     metadata.append(frame_metadata)
 
     # Write out the data for this frame to the output
@@ -412,19 +435,26 @@ def _save(im, fp, _filename):
     append_images = list(encoderinfo.get("append_images", []))
     for_all_frames = functools.partial(_for_all_frames, images=[im, *append_images])
 
-    # Collect all the frame sizes
-    frame_sizes = []
-    for_all_frames(lambda _idx, frame, _last_frame: frame_sizes.append(frame.size))
+    # Collect all the frames
+    frames = []
+    for_all_frames(lambda _idx, frame, _last_frame: frames.append(frame))
 
     # Make sure all frames are the same size
+    frame_sizes = [frame.size for frame in frames]
     if len(set(frame_sizes)) != 1:
         raise ValueError("Mismatching sizes on frames")
 
+    # Drop any frames which don't change anything
+    format_ = encoderinfo["qmk_format"]
+    use_deltas = encoderinfo.get("use_deltas", True)
+    if use_deltas:
+        frames = _fold_unchanged_frames(frames, format_)
+
     # Write out the initial graphics descriptor (and write a dummy value), so that we can come back and fill in the
     # correct values once we've written all the frames to the output
     graphics_descriptor_location = fp.tell()
     graphics_descriptor = QGFGraphicsDescriptor()
-    graphics_descriptor.frame_count = len(frame_sizes)
+    graphics_descriptor.frame_count = len(frames)
     graphics_descriptor.image_size = frame_sizes[0]
     vprint(f'{"Graphics descriptor block":26s} {fp.tell():5d}d / {fp.tell():04X}h')
     graphics_descriptor.write(fp)
@@ -437,8 +467,11 @@ def _save(im, fp, _filename):
     frame_offsets.write(fp)
 
     # Iterate over each if the input frames, writing it to the output in the process
-    write_frame = functools.partial(_write_frame, format_=encoderinfo["qmk_format"], fp=fp, use_deltas=encoderinfo.get("use_deltas", True), use_rle=encoderinfo.get("use_rle", True), frame_offsets=frame_offsets, metadata=metadata)
-    for_all_frames(write_frame)
+    write_frame = functools.partial(_write_frame, format_=format_, fp=fp, use_deltas=use_deltas, use_rle=encoderinfo.get("use_rle", True), frame_offsets=frame_offsets, metadata=metadata)
+    last_frame = None
+    for idx, frame in enumerate(frames):
+        write_frame(idx, frame, last_frame)
+        last_frame = frame
 
     # Go back and update the graphics descriptor now that we can determine the final file size
     graphics_descriptor.total_file_size = fp.tell()
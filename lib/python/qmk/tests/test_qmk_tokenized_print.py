@@ -0,0 +1,77 @@
+import struct
+
+from qmk.tokenized_print import ElfStrings, TokenizedPrintDecoder
+
+RODATA_ADDRESS = 0x08000000
+
+
+def _elf(rodata):
+    """Builds a minimal 32-bit ELF file with a single allocated section.
+    """
+    header_size = 52
+    section_size = 40
+    shoff = header_size + len(rodata)
+
+    header = bytearray(header_size)
+    header[:6] = b'\x7fELF\x01\x01'
+    struct.pack_into('<I', header, 0x20, shoff)
+    struct.pack_into('<HH', header, 0x2E, section_size, 2)
+
+    null_section = bytes(section_size)
+    rodata_section = struct.pack('<IIIIIIIIII', 0, 1, 0x2, RODATA_ADDRESS, header_size, len(rodata), 0, 0, 1, 0)
+
+    return bytes(header) + rodata + null_section + rodata_section
+
+
+def _varint(value):
+    value += 1
+    encoded = bytearray()
+    while value > 0x7F:
+        encoded.append((value & 0x7F) | 0x80)
+        value >>= 7
+    encoded.append(value)
+    return bytes(encoded)
+
+
+def _signed(value):
+    return _varint(((value << 1) ^ (value >> 31)) & 0xFFFFFFFF)
+
+
+def _string(value):
+    return _varint(len(value)) + value
+
+
+def _decoder(*format_strings):
+    rodata = b''.join(f.encode() + b'\0' for f in format_strings)
+    return TokenizedPrintDecoder(ElfStrings(_elf(rodata)))
+
+
+def test_plain_text():
+    decoder = _decoder('unused')
+    assert decoder.feed(b'hello\n\0\0\0') == 'hello\n'
+
+
+def test_record():
+    decoder = _decoder('row %02X: %d %u %s%%\n')
+    record = b'\xff' + _varint(RODATA_ADDRESS) + _varint(0x1F) + _signed(-42) + _varint(0) + _string(b'ok')
+    assert decoder.feed(record) == 'row 1F: -42 0 ok%\n'
+
+
+def test_second_format_string():
+    decoder = _decoder('first\n', 'width %*d|%-4c|%08b\n')
+    record = b'\xff' + _varint(RODATA_ADDRESS + len('first\n') + 1) + _signed(5) + _signed(7) + _varint(ord('x')) + _varint(5)
+    assert decoder.feed(record) == 'width     7|x   |00000101\n'
+
+
+def test_split_and_padded():
+    decoder = _decoder('%lu then %ld\n')
+    stream = b'before ' + b'\xff' + _varint(RODATA_ADDRESS) + _varint(0xFFFFFFFF) + _signed(-2147483648) + b'after\n'
+    output = ''
+    for i in range(0, len(stream), 3):
+        output += decoder.feed(stream[i:i + 3] + b'\0\0')
+    assert output == 'before 4294967295 then -2147483648\nafter\n'
+
+
+def test_unknown_format_string():
+    decoder = _decoder('known\n')
+    assert decoder.feed(b'\xff' + _varint(0x1234)) == '<unknown format string 0x00001234>\n'
@@ -0,0 +1,195 @@
+"""Decoding of tokenized console output.
+
+With TOKENIZED_PRINT_ENABLE, the keyboard sends a binary record for each print instead of formatted text. See quantum/logging/print_tokenized.h for the record layout.
+"""
+import codecs
+import re
+import struct
+
+MARKER = 0xFF
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+# Everything between the '%' and the conversion character which the keyboard skips over
+FORMAT_SPEC = re.compile(r'%([-+ #0-9.*hlz]*)(.?)', re.DOTALL)
+
+
+class NeedMoreData(Exception):
+    """Raised when a record has not been completely received yet.
+    """
+
+
+class ElfStrings:
+    """Reads the strings a firmware's format string addresses point at.
+    """
+    def __init__(self, data):
+        if data[:4] != b'\x7fELF':
+            raise ValueError('Not an ELF file')
+
+        is_64 = data[4] == 2
+        endian = '<' if data[5] == 1 else '>'
+
+        if is_64:
+            shoff, = struct.unpack_from(endian + 'Q', data, 0x28)
+            shentsize, shnum = struct.unpack_from(endian + 'HH', data, 0x3A)
+            section_format = endian + 'IIQQQQ'
+        else:
+            shoff, = struct.unpack_from(endian + 'I', data, 0x20)
+            shentsize, shnum = struct.unpack_from(endian + 'HH', data, 0x2E)
+            section_format = endian + 'IIIIII'
+
+        self.data = data
+        self.sections = []
+        for i in range(shnum):
+            _, sh_type, flags, addr, offset, size = struct.unpack_from(section_format, data, shoff + i * shentsize)
+            if flags & SHF_ALLOC and sh_type != SHT_NOBITS and size:
+                self.sections.append((addr, offset, size))
+
+    def string_at(self, address):
+        """Returns the NUL terminated string at the given address, or None if it is not within the firmware.
+        """
+        for addr, offset, size in self.sections:
+            if addr <= address < addr + size:
+                start = offset + address - addr
+                end = self.data.find(b'\0', start, offset + size)
+                if end < 0:
+                    return None
+                return self.data[start:end].decode('utf-8', errors='replace')
+
+        return None
+
+
+class _Reader:
+    """Reads the values of a record, skipping the zero padding added by the console endpoint.
+    """
+    def __init__(self, buffer, position):
+        self.buffer = buffer
+        self.position = position
+
+    def byte(self):
+        while True:
+            if self.position >= len(self.buffer):
+                raise NeedMoreData()
+            value = self.buffer[self.position]
+            self.position += 1
+            if value:
+                return value
+
+    def varint(self):
+        value = shift = 0
+        while True:
+            group = self.byte()
+            value |= (group & 0x7F) << shift
+            shift += 7
+            if not group & 0x80:
+                return value - 1
+
+    def signed(self):
+        value = self.varint()
+        return (value >> 1) ^ -(value & 1)
+
+    def string(self):
+        length = self.varint()
+        return bytes(self.byte() for _ in range(length)).decode('utf-8', errors='replace')
+
+
+def _format_value(flags, width, precision, conversion, value):
+    """Formats a single value the way the keyboard's printf would have.
+    """
+    spec = '%' + flags.replace('*', '')
+    if width is not None:
+        spec += str(width)
+    if precision is not None:
+        spec += '.' + str(precision)
+
+    if conversion in 'diu':
+        return (spec + 'd') % value
+    if conversion in 'xXo':
+        return (spec + conversion) % value
+    if conversion == 'b':
+        digits = format(value, 'b')
+        if '0' in flags and '-' not in flags:
+            digits = digits.rjust(width or 0, '0')
+        return (spec + 's') % digits
+    if conversion == 'c':
+        return (spec + 's') % chr(value)
+    if conversion == 'p':
+        return '0x%08x' % value
+    return (spec + 's') % value
+
+
+def _decode_record(reader, strings):
+    """Decodes a single record, with the reader positioned after its marker.
+    """
+    token = reader.varint()
+    format_string = strings.string_at(token)
+    if format_string is None:
+        return f'<unknown format string 0x{token:08x}>\n'
+
+    output = []
+    position = 0
+    for spec in FORMAT_SPEC.finditer(format_string):
+        output.append(format_string[position:spec.start()])
+        position = spec.end()
+
+        modifiers, conversion = spec.groups()
+        width_spec, _, precision_spec = modifiers.partition('.')
+        flags = re.match(r'[-+ #0]*', width_spec).group(0)
+        width_spec = width_spec[len(flags):].rstrip('hlz')
+        precision_spec = precision_spec.rstrip('hlz')
+
+        # Arguments are consumed in the order the keyboard reads them
+        width = reader.signed() if width_spec == '*' else int(width_spec) if width_spec else None
+        precision = reader.signed() if precision_spec == '*' else int(precision_spec or 0) if '.' in modifiers else None
+        if width is not None and width < 0:
+            flags += '-'
+            width = -width
+        if precision is not None and precision < 0:
+            precision = None
+
+        if conversion and conversion in 'di':
+            output.append(_format_value(flags, width, precision, conversion, reader.signed()))
+        elif conversion and conversion in 'uxXobcp':
+            output.append(_format_value(flags, width, precision, conversion, reader.varint()))
+        elif conversion and conversion in 'sS':
+            output.append(_format_value(flags, width, precision, 's', reader.string()))
+        elif conversion == '%':
+            output.append('%')
+        else:
+            output.append(spec.group(0))
+
+    output.append(format_string[position:])
+    return ''.join(output)
+
+
+class TokenizedPrintDecoder:
+    """Turns a stream of console output, possibly mixing text and tokenized records, back into text.
+    """
+    def __init__(self, strings):
+        self.strings = strings
+        self.buffer = bytearray()
+        self.text = codecs.getincrementaldecoder('utf-8')(errors='replace')
+
+    def feed(self, data):
+        """Adds received console output, returning whatever text could be decoded so far.
+        """
+        self.buffer += data
+        output = []
+
+        while self.buffer:
+            marker = self.buffer.find(MARKER)
+            if marker != 0:
+                text = bytes(self.buffer if marker < 0 else self.buffer[:marker])
+                output.append(self.text.decode(text.replace(b'\0', b'')))
+                del self.buffer[:len(text)]
+                continue
+
+            reader = _Reader(self.buffer, 1)
+            try:
+                output.append(_decode_record(reader, self.strings))
+            except NeedMoreData:
+                break
+            del self.buffer[:reader.position]
+
+        return ''.join(output)
@@ -171,6 +171,15 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    // No DMA available, transmit synchronously
+    return spi_transmit(data, length);
+}
+
+spi_status_t spi_transmit_wait(void) {
+    return SPI_STATUS_SUCCESS;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spi_status_t status;
 
@@ -125,6 +125,14 @@ inline uint32_t timer_read32(void) {
     return t;
 }
 
+/** \brief timer read in microseconds
+ *
+ * Only has millisecond resolution, as timer_count is all there is to go on.
+ */
+uint32_t timer_read_us(void) {
+    return timer_read32() * 1000;
+}
+
 // excecuted once per 1ms.(excess for just timer count?)
 #ifndef __AVR_ATmega32A__
 #    define TIMER_INTERRUPT_VECTOR TIMER0_COMPA_vect
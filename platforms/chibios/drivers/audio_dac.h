@@ -145,6 +145,6 @@
 #endif
 
 /**
- *user overridable sample generation/processing
+ * user overridable sample generation/processing, filling one half of the DMA buffer per call
  */
-uint16_t dac_value_generate(void);
+void dac_values_generate(uint16_t *samples, uint16_t count);
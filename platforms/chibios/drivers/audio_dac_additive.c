@@ -16,8 +16,8 @@
  */
 
 #include "audio.h"
+#include "synth.h"
 #include "gpio.h"
-#include <math.h>
 #include "util.h"
 
 // Need to disable GCC's "tautological-compare" warning for this file, as it causes issues when running `KEEP_INTERMEDIATES=yes`. Corresponding pop at the end of the file.
@@ -29,9 +29,10 @@
 
   which utilizes the dac unit many STM32 are equipped with, to output a modulated waveform from samples stored in the dac_buffer_* array who are passed to the hardware through DMA
 
-  it is also possible to have a custom sample-LUT by implementing/overriding 'dac_value_generate'
+  it is also possible to have a custom sample-LUT by implementing/overriding 'dac_values_generate'
 
-  this driver allows for multiple simultaneous tones to be played through one single channel by doing additive wave-synthesis
+  this driver allows for multiple simultaneous tones to be played through one single channel by doing additive wave-synthesis,
+  using the fixed-point synthesizer in quantum/audio/synth.c so no floating point maths happens per sample
 */
 
 #if !defined(AUDIO_PIN)
@@ -90,21 +91,28 @@ static const dacsample_t dac_buffer_trapezoid[] = {
 
 static dacsample_t dac_buffer[AUDIO_DAC_BUFFER_SIZE];
 
-/* keep track of the sample position for for each frequency */
-static float dac_if[AUDIO_MAX_SIMULTANEOUS_TONES] = {0.0};
+#if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
+#    define dac_wavetable dac_buffer_sine
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
+#    define dac_wavetable dac_buffer_triangle
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
+#    define dac_wavetable dac_buffer_trapezoid
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
+#    define dac_wavetable dac_buffer_square
+#endif
 
-static float   active_tones_snapshot[AUDIO_MAX_SIMULTANEOUS_TONES] = {0};
-static uint8_t active_tones_snapshot_length                        = 0;
+STATIC_ASSERT((ARRAY_SIZE(dac_wavetable) & (ARRAY_SIZE(dac_wavetable) - 1)) == 0, "AUDIO_DAC: the wavetable length must be a power of two");
+
+/* the gpt timer runs with 3*AUDIO_DAC_SAMPLE_RATE and the DAC is triggered twice per conversion, so samples are
+ * actually consumed at 3/2 of AUDIO_DAC_SAMPLE_RATE (as measured with an oscilloscope)
+ */
+#define AUDIO_DAC_EFFECTIVE_SAMPLE_RATE (AUDIO_DAC_SAMPLE_RATE * 3 / 2)
 
 typedef enum {
     OUTPUT_SHOULD_START,
     OUTPUT_RUN_NORMALLY,
-    // path 1: wait for zero, then change/update active tones
-    OUTPUT_TONES_CHANGED,
-    OUTPUT_REACHED_ZERO_BEFORE_TONE_CHANGE,
-    // path 2: hardware should stop, wait for zero then turn output off = stop the timer
+    // hardware should stop: fade out all tones, then turn output off = stop the timer
     OUTPUT_SHOULD_STOP,
-    OUTPUT_REACHED_ZERO_BEFORE_OFF,
     OUTPUT_OFF,
     OUTPUT_OFF_1,
     OUTPUT_OFF_2, // trailing off: giving the DAC two more conversion cycles until the AUDIO_DAC_OFF_VALUE reaches the output, then turn the timer off, which leaves the output at that level
@@ -113,74 +121,32 @@ typedef enum {
 output_states_t state = OUTPUT_OFF_2;
 
 /**
- * Generation of the waveform being passed to the callback. Declared weak so users
+ * Generation of the waveform being passed to the DAC, one half of the DMA buffer at a time. Declared weak so users
  * can override it with their own wave-forms/noises.
  */
-__attribute__((weak)) uint16_t dac_value_generate(void) {
-    // DAC is running/asking for values but snapshot length is zero -> must be playing a pause
-    if (active_tones_snapshot_length == 0) {
-        return AUDIO_DAC_OFF_VALUE;
-    }
-
+__attribute__((weak)) void dac_values_generate(uint16_t *samples, uint16_t count) {
     /* doing additive wave synthesis over all currently playing tones = adding up
-     * sine-wave-samples for each frequency, scaled by the number of active tones
+     * wavetable-samples for each frequency, scaled by the number of active tones
      */
-    uint_fast16_t value     = 0;
-    float         frequency = 0.0f;
-
-#if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_sine);
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_triangle);
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_trapezoid);
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_square);
-#endif
+    audio_synth_render(samples, count);
+}
 
-    for (size_t i = 0; i < active_tones_snapshot_length; i++) {
-        /* Note: a user implementation does not have to rely on the active_tones_snapshot, but
+/**
+ * Hands the currently active tones over to the synthesizer, which fades between the old and new set of tones.
+ */
+static void dac_update_tones(void) {
+    uint32_t frequencies[AUDIO_MAX_SIMULTANEOUS_TONES];
+    uint8_t  count        = 0;
+    uint8_t  active_tones = MIN(AUDIO_MAX_SIMULTANEOUS_TONES, audio_get_number_of_active_tones());
+    for (uint8_t i = 0; i < active_tones; i++) {
+        /* Note: a user implementation does not have to rely on the synthesizer, but
          * could directly query the active frequencies through audio_get_processed_frequency */
-        frequency = active_tones_snapshot[i];
-
-        float new_dac_if = dac_if[i];
-        new_dac_if += frequency * ((float)wavetable_length / AUDIO_DAC_SAMPLE_RATE * 2.0f / 3.0f);
-        /*Note: the 2/3 are necessary to get the correct frequencies on the
-         *      DAC output (as measured with an oscilloscope), since the gpt
-         *      timer runs with 3*AUDIO_DAC_SAMPLE_RATE; and the DAC callback
-         *      is called twice per conversion.*/
-
-        while (new_dac_if >= wavetable_length)
-            new_dac_if -= wavetable_length;
-        dac_if[i] = new_dac_if;
-
-        // Wavetable generation/lookup
-        size_t dac_i = (size_t)new_dac_if;
-
-#if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
-        value += dac_buffer_sine[dac_i] / active_tones_snapshot_length;
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
-        value += dac_buffer_triangle[dac_i] / active_tones_snapshot_length;
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
-        value += dac_buffer_trapezoid[dac_i] / active_tones_snapshot_length;
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
-        value += dac_buffer_square[dac_i] / active_tones_snapshot_length;
-#endif
-        /*
-        // SINE
-        value += dac_buffer_sine[dac_i] / active_tones_snapshot_length / 3;
-        // TRIANGLE
-        value += dac_buffer_triangle[dac_i] / active_tones_snapshot_length / 3;
-        // SQUARE
-        value += dac_buffer_square[dac_i] / active_tones_snapshot_length / 3;
-        //NOTE: combination of these three wave-forms is more exemplary - and doesn't sound particularly good :-P
-        */
-
-        // STAIRS (mostly usefully as test-pattern)
-        // value_avg = dac_buffer_staircase[dac_i] / active_tones_snapshot_length;
+        float freq = audio_get_processed_frequency(i);
+        if (freq > 0) { // disregard 'rest' notes, with valid frequency 0.0f; which would only lower the resulting waveform volume during the additive synthesis step
+            frequencies[count++] = AUDIO_SYNTH_FREQUENCY(freq);
+        }
     }
-
-    return value;
+    audio_synth_set_tones(frequencies, count);
 }
 
 /**
@@ -196,70 +162,29 @@ static void dac_end(DACDriver *dacp) {
         sample_p += AUDIO_DAC_BUFFER_SIZE / 2; // 'half_index'
     }
 
-    for (uint8_t s = 0; s < AUDIO_DAC_BUFFER_SIZE / 2; s++) {
-        if (OUTPUT_OFF <= state) {
-            sample_p[s] = AUDIO_DAC_OFF_VALUE;
-            continue;
-        } else {
-            sample_p[s] = dac_value_generate();
-        }
-
-        /* zero crossing (or approach, whereas zero == DAC_OFF_VALUE, which can be configured to anything from 0 to DAC_SAMPLE_MAX)
-         * ============================*=*========================== AUDIO_DAC_SAMPLE_MAX
-         *                          *       *
-         *                        *           *
-         * ---------------------------------------------------------
-         *                     *                 *                  } AUDIO_DAC_SAMPLE_MAX/100
-         * --------------------------------------------------------- AUDIO_DAC_OFF_VALUE
-         *                  *                       *               } AUDIO_DAC_SAMPLE_MAX/100
-         * ---------------------------------------------------------
-         *               *
-         * *           *
-         *   *       *
-         * =====*=*================================================= 0x0
-         */
-        if (((sample_p[s] + (AUDIO_DAC_SAMPLE_MAX / 100)) > AUDIO_DAC_OFF_VALUE) && // value approaches from below
-            (sample_p[s] < (AUDIO_DAC_OFF_VALUE + (AUDIO_DAC_SAMPLE_MAX / 100)))    // or above
-        ) {
-            if ((OUTPUT_SHOULD_START == state) && (active_tones_snapshot_length > 0)) {
-                state = OUTPUT_RUN_NORMALLY;
-            } else if (OUTPUT_TONES_CHANGED == state) {
-                state = OUTPUT_REACHED_ZERO_BEFORE_TONE_CHANGE;
-            } else if (OUTPUT_SHOULD_STOP == state) {
-                state = OUTPUT_REACHED_ZERO_BEFORE_OFF;
-            }
-        }
+    if (OUTPUT_SHOULD_START == state) {
+        dac_update_tones();
+        state = OUTPUT_RUN_NORMALLY;
+    }
 
-        // still 'ramping up', reset the output to OFF_VALUE until the generated values reach that value, to do a smooth handover
-        if (OUTPUT_SHOULD_START == state) {
+    if (OUTPUT_OFF <= state) {
+        for (uint16_t s = 0; s < AUDIO_DAC_BUFFER_SIZE / 2; s++) {
             sample_p[s] = AUDIO_DAC_OFF_VALUE;
         }
+    } else {
+        dac_values_generate(sample_p, AUDIO_DAC_BUFFER_SIZE / 2);
+    }
 
-        if ((OUTPUT_SHOULD_START == state) || (OUTPUT_REACHED_ZERO_BEFORE_OFF == state) || (OUTPUT_REACHED_ZERO_BEFORE_TONE_CHANGE == state)) {
-            uint8_t active_tones         = MIN(AUDIO_MAX_SIMULTANEOUS_TONES, audio_get_number_of_active_tones());
-            active_tones_snapshot_length = 0;
-            // update the snapshot - once, and only on occasion that something changed;
-            // -> saves cpu cycles (?)
-            for (uint8_t i = 0; i < active_tones; i++) {
-                float freq = audio_get_processed_frequency(i);
-                if (freq > 0) { // disregard 'rest' notes, with valid frequency 0.0f; which would only lower the resulting waveform volume during the additive synthesis step
-                    active_tones_snapshot[active_tones_snapshot_length++] = freq;
-                }
-            }
-
-            if ((0 == active_tones_snapshot_length) && (OUTPUT_REACHED_ZERO_BEFORE_OFF == state)) {
-                state = OUTPUT_OFF;
-            }
-            if (OUTPUT_REACHED_ZERO_BEFORE_TONE_CHANGE == state) {
-                state = OUTPUT_RUN_NORMALLY;
-            }
-        }
+    // update audio internal state (note position, current_note, ...); changed tones are picked up by the next half of the buffer
+    if (audio_update_state() && (OUTPUT_RUN_NORMALLY == state)) {
+        dac_update_tones();
     }
 
-    // update audio internal state (note position, current_note, ...)
-    if (audio_update_state()) {
-        if (OUTPUT_SHOULD_STOP != state) {
-            state = OUTPUT_TONES_CHANGED;
+    // let all tones fade out before turning off, so the output ends up at AUDIO_DAC_OFF_VALUE without a click
+    if (OUTPUT_SHOULD_STOP == state) {
+        audio_synth_set_tones(NULL, 0);
+        if (audio_synth_is_silent()) {
+            state = OUTPUT_OFF;
         }
     }
 
@@ -347,6 +272,8 @@ void audio_driver_initialize_impl(void) {
     }
 #endif
 
+    audio_synth_init(dac_wavetable, ARRAY_SIZE(dac_wavetable), AUDIO_DAC_EFFECTIVE_SAMPLE_RATE, AUDIO_DAC_OFF_VALUE);
+
     gptStart(&GPTD6, &gpt6cfg1);
 }
 
@@ -357,12 +284,8 @@ void audio_driver_stop_impl(void) {
 void audio_driver_start_impl(void) {
     gptStartContinuous(&GPTD6, 2U);
 
-    for (uint8_t i = 0; i < AUDIO_MAX_SIMULTANEOUS_TONES; i++) {
-        dac_if[i]                = 0.0f;
-        active_tones_snapshot[i] = 0.0f;
-    }
-    active_tones_snapshot_length = 0;
-    state                        = OUTPUT_SHOULD_START;
+    // any tones still fading out from before are picked up by the synthesizer as it starts again
+    state = OUTPUT_SHOULD_START;
 }
 
 #pragma GCC diagnostic pop
@@ -0,0 +1,147 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Encoder Driver: decodes encoders with the quadrature encoder mode of the STM32 general purpose timers. The timer
+// counts every edge on both pads in hardware, so no pulses are missed while the main loop is busy. The A pad must be
+// connected to the timer's CH1 pin and the B pad to CH2, see your MCU's datasheet for which pins can be used. Encoders
+// without a timer are decoded in software by the quadrature driver.
+
+#include <hal.h>
+#include "encoder.h"
+#include "gpio.h"
+
+#if !defined(MCU_STM32)
+#    error Timer encoder driver is only available for STM32 MCUs!
+#endif
+
+#ifndef ENCODER_TIMERS
+#    error ENCODER_TIMERS must be defined to use the timer encoder driver
+#endif
+
+// Input capture filter applied to both pads, 0 (off) to 15 (8 samples at fDTS/32)
+#ifndef ENCODER_TIMER_FILTER
+#    define ENCODER_TIMER_FILTER 15
+#endif
+
+#if defined(USE_GPIOV1)
+#    define ENCODER_TIMER_PIN_MODE(pal_mode) ((void)(pal_mode), PAL_MODE_INPUT_PULLUP)
+#else
+#    define ENCODER_TIMER_PIN_MODE(pal_mode) PAL_MODE_ALTERNATE(pal_mode) | PAL_STM32_PUPDR_PULLUP
+#endif
+
+extern volatile bool isLeftHand;
+
+static uint8_t      encoder_timer_numbers[NUM_ENCODERS_MAX_PER_SIDE] = ENCODER_TIMERS;
+static stm32_tim_t *encoder_timers[NUM_ENCODERS_MAX_PER_SIDE]        = {0};
+static uint16_t     encoder_timer_counts[NUM_ENCODERS_MAX_PER_SIDE]  = {0};
+
+#ifdef ENCODER_TIMER_PAL_MODES
+static uint8_t encoder_timer_pal_modes[NUM_ENCODERS_MAX_PER_SIDE] = ENCODER_TIMER_PAL_MODES;
+#elif defined(ENCODER_TIMER_PAL_MODES_RIGHT)
+#    error ENCODER_TIMER_PAL_MODES_RIGHT requires ENCODER_TIMER_PAL_MODES
+#else
+/**
+ * @brief The alternate function of a timer's CH1/CH2 pins, which is the same for every pin of the timer on most STM32
+ * families. Others, such as the F0, L0 and G0, need ENCODER_TIMER_PAL_MODES.
+ */
+static uint8_t encoder_timer_default_pal_mode(uint8_t timer) {
+    switch (timer) {
+        case 1:
+        case 2:
+            return 1;
+        case 8:
+            return 3;
+        default:
+            return 2;
+    }
+}
+#endif
+
+static stm32_tim_t *encoder_timer_enable(uint8_t timer) {
+    switch (timer) {
+#if STM32_HAS_TIM1
+        case 1:
+            rccEnableTIM1(true);
+            return STM32_TIM1;
+#endif
+#if STM32_HAS_TIM2
+        case 2:
+            rccEnableTIM2(true);
+            return STM32_TIM2;
+#endif
+#if STM32_HAS_TIM3
+        case 3:
+            rccEnableTIM3(true);
+            return STM32_TIM3;
+#endif
+#if STM32_HAS_TIM4
+        case 4:
+            rccEnableTIM4(true);
+            return STM32_TIM4;
+#endif
+#if STM32_HAS_TIM5
+        case 5:
+            rccEnableTIM5(true);
+            return STM32_TIM5;
+#endif
+#if STM32_HAS_TIM8
+        case 8:
+            rccEnableTIM8(true);
+            return STM32_TIM8;
+#endif
+        default:
+            return NULL;
+    }
+}
+
+bool encoder_quadrature_hardware_init(uint8_t index, pin_t pad_a, pin_t pad_b) {
+#if defined(SPLIT_KEYBOARD) && defined(ENCODER_TIMERS_RIGHT)
+    if (!isLeftHand) {
+        const uint8_t encoder_timer_numbers_right[] = ENCODER_TIMERS_RIGHT;
+        encoder_timer_numbers[index]                = encoder_timer_numbers_right[index];
+    }
+#endif // defined(SPLIT_KEYBOARD) && defined(ENCODER_TIMERS_RIGHT)
+#if defined(SPLIT_KEYBOARD) && defined(ENCODER_TIMER_PAL_MODES_RIGHT)
+    if (!isLeftHand) {
+        const uint8_t encoder_timer_pal_modes_right[] = ENCODER_TIMER_PAL_MODES_RIGHT;
+        encoder_timer_pal_modes[index]                = encoder_timer_pal_modes_right[index];
+    }
+#endif // defined(SPLIT_KEYBOARD) && defined(ENCODER_TIMER_PAL_MODES_RIGHT)
+
+    stm32_tim_t *tim = encoder_timer_enable(encoder_timer_numbers[index]);
+    if (tim == NULL || pad_a == NO_PIN || pad_b == NO_PIN) {
+        return false;
+    }
+
+#ifdef ENCODER_TIMER_PAL_MODES
+    uint8_t pal_mode = encoder_timer_pal_modes[index];
+#else
+    uint8_t pal_mode = encoder_timer_default_pal_mode(encoder_timer_numbers[index]);
+#endif
+    palSetLineMode(pad_a, ENCODER_TIMER_PIN_MODE(pal_mode));
+    palSetLineMode(pad_b, ENCODER_TIMER_PIN_MODE(pal_mode));
+
+    // Encoder mode 3 counts both edges of both inputs, matching the software decoder's pulses
+    tim->CR1   = 0;
+    tim->SMCR  = STM32_TIM_SMCR_SMS(3);
+    tim->CCMR1 = STM32_TIM_CCMR1_CC1S(1) | STM32_TIM_CCMR1_IC1F(ENCODER_TIMER_FILTER) | STM32_TIM_CCMR1_CC2S(1) | STM32_TIM_CCMR1_IC2F(ENCODER_TIMER_FILTER);
+    tim->CCER  = 0;
+    tim->PSC   = 0;
+    tim->ARR   = 0xFFFF;
+    tim->CNT   = 0;
+    tim->EGR   = STM32_TIM_EGR_UG;
+    tim->CR1   = STM32_TIM_CR1_CEN;
+
+    encoder_timers[index]       = tim;
+    encoder_timer_counts[index] = 0;
+    return true;
+}
+
+int16_t encoder_quadrature_hardware_read(uint8_t index) {
+    uint16_t count              = encoder_timers[index]->CNT;
+    int16_t  delta              = (int16_t)(count - encoder_timer_counts[index]);
+    encoder_timer_counts[index] = count;
+
+    // The timer counts up when A leads B, which the software decoder treats as negative
+    return -delta;
+}
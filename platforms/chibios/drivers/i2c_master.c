@@ -31,6 +31,7 @@
 #include "chibios_config.h"
 #include <ch.h>
 #include <hal.h>
+#include <string.h>
 
 #ifndef I2C_DRIVER
 #    define I2C_DRIVER I2CD1
@@ -148,34 +149,202 @@ __attribute__((weak)) void i2c_init(void) {
     }
 }
 
-i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+/**
+ * @brief Runs a single transfer on the I2C peripheral: a write, optionally
+ * followed by a read after a repeated start, or just a read.
+ */
+static i2c_status_t i2c_execute(uint8_t address, const uint8_t* tx_data, uint16_t tx_length, uint8_t* rx_data, uint16_t rx_length, uint16_t timeout) {
     i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
+    msg_t status;
+    if (tx_length > 0) {
+        status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), tx_data, tx_length, rx_data, rx_length, TIME_MS2I(timeout));
+    } else {
+        status = i2cMasterReceiveTimeout(&I2C_DRIVER, (address >> 1), rx_data, rx_length, TIME_MS2I(timeout));
+    }
     return i2c_epilogue(status);
 }
 
+#ifdef I2C_SCHEDULER_ENABLE
+
+#    ifndef I2C_SCHEDULER_THREAD_PRIORITY
+#        define I2C_SCHEDULER_THREAD_PRIORITY (NORMALPRIO + 1)
+#    endif
+
+// Largest register write which can be queued, including the register address
+#    ifndef I2C_SCHEDULER_BUFFER_SIZE
+#        define I2C_SCHEDULER_BUFFER_SIZE 64
+#    endif
+
+static THD_WORKING_AREA(waI2CSchedulerThread, 256);
+static thread_t*          i2c_scheduler_thread = NULL;
+static SEMAPHORE_DECL(i2c_scheduler_pending, 0);
+static i2c_transaction_t* i2c_queue_head     = NULL;
+static i2c_transaction_t* i2c_completed_head = NULL;
+static i2c_transaction_t* i2c_completed_tail = NULL;
+static uint8_t            i2c_scheduler_buffer[I2C_SCHEDULER_BUFFER_SIZE];
+
+static i2c_status_t i2c_scheduler_execute(i2c_transaction_t* transaction) {
+    const uint8_t* tx_data   = transaction->tx_data;
+    uint16_t       tx_length = transaction->tx_length;
+
+    if (transaction->reg_length > 0) {
+        if (tx_length == 0) {
+            // Register read, or write with no data
+            tx_data   = transaction->reg;
+            tx_length = transaction->reg_length;
+        } else {
+            // Register write, which has to go out as a single transfer
+            if (transaction->reg_length + tx_length > sizeof(i2c_scheduler_buffer)) {
+                return I2C_STATUS_ERROR;
+            }
+            memcpy(i2c_scheduler_buffer, transaction->reg, transaction->reg_length);
+            memcpy(i2c_scheduler_buffer + transaction->reg_length, transaction->tx_data, tx_length);
+            tx_data = i2c_scheduler_buffer;
+            tx_length += transaction->reg_length;
+        }
+    }
+
+    return i2c_execute(transaction->address, tx_data, tx_length, transaction->rx_data, transaction->rx_length, transaction->timeout);
+}
+
+static THD_FUNCTION(I2CSchedulerThread, arg) {
+    (void)arg;
+    chRegSetThreadName("i2c_scheduler");
+
+    while (true) {
+        chSemWait(&i2c_scheduler_pending);
+
+        chSysLock();
+        i2c_transaction_t* transaction = i2c_queue_head;
+        i2c_queue_head                 = transaction->next;
+        chSysUnlock();
+
+        i2c_status_t status = i2c_scheduler_execute(transaction);
+
+        chSysLock();
+        transaction->status = status;
+        transaction->next   = NULL;
+        if (transaction->callback) {
+            // Callbacks run from the main loop, the transaction stays busy until then
+            if (i2c_completed_tail) {
+                i2c_completed_tail->next = transaction;
+            } else {
+                i2c_completed_head = transaction;
+            }
+            i2c_completed_tail = transaction;
+        } else {
+            transaction->busy = false;
+        }
+        chThdResumeI((thread_reference_t*)&transaction->waiter, MSG_OK);
+        chSchRescheduleS();
+        chSysUnlock();
+    }
+}
+
+bool i2c_transaction_submit(i2c_transaction_t* transaction) {
+    if (transaction->busy) {
+        return false;
+    }
+
+    if (i2c_scheduler_thread == NULL) {
+        i2c_scheduler_thread = chThdCreateStatic(waI2CSchedulerThread, sizeof(waI2CSchedulerThread), I2C_SCHEDULER_THREAD_PRIORITY, I2CSchedulerThread, NULL);
+    }
+
+    transaction->status = I2C_STATUS_PENDING;
+    transaction->busy   = true;
+    transaction->waiter = NULL;
+
+    chSysLock();
+    // Insert after everything of equal or higher priority
+    i2c_transaction_t** link = &i2c_queue_head;
+    while (*link && (*link)->priority <= transaction->priority) {
+        link = &(*link)->next;
+    }
+    transaction->next = *link;
+    *link             = transaction;
+    chSemSignalI(&i2c_scheduler_pending);
+    chSchRescheduleS();
+    chSysUnlock();
+
+    return true;
+}
+
+i2c_status_t i2c_transaction_status(const i2c_transaction_t* transaction) {
+    return transaction->status;
+}
+
+i2c_status_t i2c_transaction_wait(i2c_transaction_t* transaction) {
+    chSysLock();
+    if (transaction->status == I2C_STATUS_PENDING) {
+        chThdSuspendS((thread_reference_t*)&transaction->waiter);
+    }
+    chSysUnlock();
+    return transaction->status;
+}
+
+void i2c_scheduler_task(void) {
+    while (true) {
+        chSysLock();
+        i2c_transaction_t* transaction = i2c_completed_head;
+        if (transaction) {
+            i2c_completed_head = transaction->next;
+            if (i2c_completed_head == NULL) {
+                i2c_completed_tail = NULL;
+            }
+        }
+        chSysUnlock();
+
+        if (transaction == NULL) {
+            break;
+        }
+
+        // Cleared first so the callback can resubmit the transaction
+        transaction->busy = false;
+        transaction->callback(transaction);
+    }
+}
+
+static i2c_status_t i2c_transfer(uint8_t address, const uint8_t* tx_data, uint16_t tx_length, uint8_t* rx_data, uint16_t rx_length, uint16_t timeout) {
+    i2c_transaction_t transaction = {
+        .address   = address,
+        .priority  = I2C_PRIORITY_NORMAL,
+        .tx_data   = tx_data,
+        .tx_length = tx_length,
+        .rx_data   = rx_data,
+        .rx_length = rx_length,
+        .timeout   = timeout,
+    };
+    i2c_transaction_submit(&transaction);
+    return i2c_transaction_wait(&transaction);
+}
+
+#else // I2C_SCHEDULER_ENABLE
+
+static i2c_status_t i2c_transfer(uint8_t address, const uint8_t* tx_data, uint16_t tx_length, uint8_t* rx_data, uint16_t rx_length, uint16_t timeout) {
+    return i2c_execute(address, tx_data, tx_length, rx_data, rx_length, timeout);
+}
+
+#endif // I2C_SCHEDULER_ENABLE
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    return i2c_transfer(address, data, length, NULL, 0, timeout);
+}
+
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (address >> 1), data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    return i2c_transfer(address, NULL, 0, data, length, timeout);
 }
 
 i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-
     uint8_t complete_packet[length + 1];
     for (uint16_t i = 0; i < length; i++) {
         complete_packet[i + 1] = data[i];
     }
     complete_packet[0] = regaddr;
 
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), complete_packet, length + 1, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    return i2c_transfer(devaddr, complete_packet, length + 1, NULL, 0, timeout);
 }
 
 i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-
     uint8_t complete_packet[length + 2];
     for (uint16_t i = 0; i < length; i++) {
         complete_packet[i + 2] = data[i];
@@ -183,21 +352,16 @@ i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8
     complete_packet[0] = regaddr >> 8;
     complete_packet[1] = regaddr & 0xFF;
 
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), complete_packet, length + 2, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    return i2c_transfer(devaddr, complete_packet, length + 2, NULL, 0, timeout);
 }
 
 i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    return i2c_transfer(devaddr, &regaddr, 1, data, length, timeout);
 }
 
 i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
     uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
-    msg_t   status             = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), register_packet, 2, data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    return i2c_transfer(devaddr, register_packet, 2, data, length, timeout);
 }
 
 __attribute__((weak)) i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout) {
@@ -7,6 +7,477 @@
 #include "serial_protocol.h"
 #include "synchronization_util.h"
 
+#if defined(SERIAL_USART_STREAMING)
+
+#    include <string.h>
+
+#    include "crc.h"
+#    include "compiler_support.h"
+#    include "serial_usart.h"
+#    include "util.h"
+
+#    if !defined(SERIAL_USART_FULL_DUPLEX)
+#        error "SERIAL_USART_STREAMING requires SERIAL_USART_FULL_DUPLEX"
+#    endif
+
+#    ifndef SERIAL_USART_STREAMING_KEEPALIVE
+#        define SERIAL_USART_STREAMING_KEEPALIVE 5
+#    endif
+
+#    ifndef SERIAL_USART_STREAMING_RETRY
+#        define SERIAL_USART_STREAMING_RETRY 2
+#    endif
+
+/*
+ * Streaming protocol
+ *
+ * Both halves continuously exchange self-contained frames in both directions:
+ *
+ *   | sync | id | sequence | length | payload[length] | crc8 |
+ *
+ * The master sends the initiator2target buffer of a transaction, which the
+ * slave answers with a frame carrying the same sequence number and the
+ * target2initiator buffer. Transactions which only write state don't wait for
+ * that answer, they are re-sent until it arrives instead. Transactions which
+ * only read slave state are pushed by the slave as soon as that state changes,
+ * so the master already holds the latest copy when it asks for it. There is no
+ * handshake between frames, and a corrupted frame is simply skipped by
+ * searching for the next sync byte.
+ */
+
+#    define SERIAL_STREAM_SYNC 0xA5
+#    define SERIAL_STREAM_PUSH 0x80
+#    define SERIAL_STREAM_HEADER_SIZE 4
+
+STATIC_ASSERT(NUM_TOTAL_TRANSACTIONS <= SERIAL_STREAM_PUSH, "Too many transactions for the streaming protocol");
+
+typedef struct PACKED {
+    uint8_t sync;
+    uint8_t id;
+    uint8_t sequence;
+    uint8_t length;
+    uint8_t payload[UINT8_MAX + 1]; // payload followed by crc8
+} serial_stream_frame_t;
+
+static MUTEX_DECL(stream_tx_mutex);
+static serial_stream_frame_t stream_tx_frame;
+static serial_stream_frame_t stream_rx_frame;
+
+/**
+ * @brief Check if the slave streams the target2initiator buffer of a
+ * transaction to the master on its own.
+ */
+static bool stream_is_pushed(uint8_t transaction_id) {
+#    if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+    /* RPC responses are only valid after the RPC executed, so have to be requested. */
+    if (transaction_id == GET_RPC_RESP_DATA) {
+        return false;
+    }
+#    endif
+    split_transaction_desc_t* transaction = &split_transaction_table[transaction_id];
+    return transaction->target2initiator_buffer_size && !transaction->initiator2target_buffer_size && !transaction->slave_callback;
+}
+
+/**
+ * @brief Check if a transaction only writes state to the slave.
+ */
+static bool stream_is_write_only(uint8_t transaction_id) {
+    split_transaction_desc_t* transaction = &split_transaction_table[transaction_id];
+    return transaction->initiator2target_buffer_size && !transaction->target2initiator_buffer_size && !transaction->slave_callback;
+}
+
+/**
+ * @brief Fill the transmit frame. Has to be called with stream_tx_mutex held.
+ */
+static void stream_build_frame(uint8_t id, uint8_t sequence, const uint8_t* payload, uint8_t length) {
+    stream_tx_frame.sync     = SERIAL_STREAM_SYNC;
+    stream_tx_frame.id       = id;
+    stream_tx_frame.sequence = sequence;
+    stream_tx_frame.length   = length;
+    memcpy(stream_tx_frame.payload, payload, length);
+    stream_tx_frame.payload[length] = crc8(&stream_tx_frame, SERIAL_STREAM_HEADER_SIZE + length);
+}
+
+/**
+ * @brief Send the transmit frame. Has to be called with stream_tx_mutex held.
+ */
+static bool stream_send_frame(void) {
+    return serial_transport_send((const uint8_t*)&stream_tx_frame, SERIAL_STREAM_HEADER_SIZE + stream_tx_frame.length + 1);
+}
+
+/**
+ * @brief Receive the next valid frame, skipping anything that isn't one.
+ *
+ * @param expected_length Returns the payload length for a given frame id, frames of any other length are dropped.
+ */
+static bool stream_receive_frame(int16_t (*expected_length)(uint8_t id)) {
+    serial_stream_frame_t* frame = &stream_rx_frame;
+
+    do {
+        if (unlikely(!serial_transport_receive_blocking(&frame->sync, sizeof(frame->sync)))) {
+            return false;
+        }
+    } while (frame->sync != SERIAL_STREAM_SYNC);
+
+    if (unlikely(!serial_transport_receive(&frame->id, SERIAL_STREAM_HEADER_SIZE - 1))) {
+        return false;
+    }
+
+    if (unlikely((frame->id & ~SERIAL_STREAM_PUSH) >= NUM_TOTAL_TRANSACTIONS || frame->length != expected_length(frame->id))) {
+        serial_dprintf("SPLIT: dropping malformed frame\n");
+        return false;
+    }
+
+    if (unlikely(!serial_transport_receive(frame->payload, frame->length + 1))) {
+        return false;
+    }
+
+    if (unlikely(frame->payload[frame->length] != crc8(frame, SERIAL_STREAM_HEADER_SIZE + frame->length))) {
+        serial_dprintf("SPLIT: dropping corrupted frame\n");
+        return false;
+    }
+
+    return true;
+}
+
+/* ------------------------------------------------------------------------- */
+/* Slave                                                                     */
+
+static BSEMAPHORE_DECL(stream_push_semaphore, true);
+static uint8_t stream_push_sequence = 0;
+static uint8_t stream_push_checksum[NUM_TOTAL_TRANSACTIONS];
+
+static int16_t stream_slave_expected_length(uint8_t id) {
+    /* Only the slave pushes state. */
+    return (id & SERIAL_STREAM_PUSH) ? -1 : split_transaction_table[id].initiator2target_buffer_size;
+}
+
+/**
+ * @brief Apply a frame sent by the master and answer it with the
+ * target2initiator buffer of the transaction.
+ */
+static void stream_react_to_frame(void) {
+    uint8_t                   transaction_id = stream_rx_frame.id;
+    split_transaction_desc_t* transaction    = &split_transaction_table[transaction_id];
+
+    chMtxLock(&stream_tx_mutex);
+
+    split_shared_memory_lock();
+    memcpy(split_trans_initiator2target_buffer(transaction), stream_rx_frame.payload, stream_rx_frame.length);
+    if (transaction->slave_callback) {
+        transaction->slave_callback(transaction->initiator2target_buffer_size, split_trans_initiator2target_buffer(transaction), transaction->target2initiator_buffer_size, split_trans_target2initiator_buffer(transaction));
+    }
+    stream_build_frame(transaction_id, stream_rx_frame.sequence, split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size);
+    split_shared_memory_unlock();
+
+    if (unlikely(!stream_send_frame())) {
+        serial_dprintf("SPLIT: sending response failed\n");
+    }
+
+    chMtxUnlock(&stream_tx_mutex);
+}
+
+/**
+ * @brief Push every piece of slave state which changed since it was last
+ * pushed, or all of it if the master hasn't heard from us for a while.
+ */
+static void stream_push_state(bool everything) {
+    for (uint8_t transaction_id = 0; transaction_id < NUM_TOTAL_TRANSACTIONS; transaction_id++) {
+        if (!stream_is_pushed(transaction_id)) {
+            continue;
+        }
+
+        split_transaction_desc_t* transaction = &split_transaction_table[transaction_id];
+
+        chMtxLock(&stream_tx_mutex);
+
+        split_shared_memory_lock();
+        uint8_t checksum = crc8(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size);
+        bool    changed  = checksum != stream_push_checksum[transaction_id];
+        if (changed || everything) {
+            stream_build_frame(transaction_id | SERIAL_STREAM_PUSH, stream_push_sequence++, split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size);
+        }
+        split_shared_memory_unlock();
+
+        if ((changed || everything) && likely(stream_send_frame())) {
+            stream_push_checksum[transaction_id] = checksum;
+        }
+
+        chMtxUnlock(&stream_tx_mutex);
+    }
+}
+
+/**
+ * @brief This thread runs on the slave and applies frames sent by the master.
+ */
+static THD_WORKING_AREA(waSlaveThread, 1024);
+static THD_FUNCTION(SlaveThread, arg) {
+    (void)arg;
+    chRegSetThreadName("split_protocol_rx");
+
+    while (true) {
+        /* Frames are self-contained, so a failed one only needs to be skipped. */
+        if (likely(stream_receive_frame(stream_slave_expected_length))) {
+            stream_react_to_frame();
+        }
+    }
+}
+
+/**
+ * @brief This thread runs on the slave and pushes state changes to the master,
+ * and doubles as keep-alive if nothing changes.
+ */
+static THD_WORKING_AREA(waSlavePushThread, 256);
+static THD_FUNCTION(SlavePushThread, arg) {
+    (void)arg;
+    chRegSetThreadName("split_protocol_tx");
+
+    systime_t last_keepalive = chVTGetSystemTimeX();
+
+    while (true) {
+        chBSemWaitTimeout(&stream_push_semaphore, TIME_MS2I(SERIAL_USART_STREAMING_KEEPALIVE));
+
+        bool everything = chVTTimeElapsedSinceX(last_keepalive) >= TIME_MS2I(SERIAL_USART_STREAMING_KEEPALIVE);
+        if (everything) {
+            last_keepalive = chVTGetSystemTimeX();
+        }
+
+        stream_push_state(everything);
+    }
+}
+
+/**
+ * @brief Slave specific initializations.
+ */
+void soft_serial_target_init(void) {
+    serial_transport_driver_slave_init();
+
+    /* Start transport threads. */
+    chThdCreateStatic(waSlaveThread, sizeof(waSlaveThread), HIGHPRIO, SlaveThread, NULL);
+    chThdCreateStatic(waSlavePushThread, sizeof(waSlavePushThread), HIGHPRIO - 1, SlavePushThread, NULL);
+}
+
+/**
+ * @brief Push any slave state which changed during this iteration of the main
+ * loop right away.
+ */
+void soft_serial_target_sync(void) {
+    chBSemSignal(&stream_push_semaphore);
+}
+
+/* ------------------------------------------------------------------------- */
+/* Master                                                                    */
+
+static BSEMAPHORE_DECL(stream_response_semaphore, true);
+static volatile uint8_t   stream_awaited_id       = 0xFF;
+static volatile uint8_t   stream_awaited_sequence = 0;
+static volatile systime_t stream_last_rx          = 0;
+static volatile bool      stream_link_up          = false;
+static uint8_t            stream_sequence         = 0;
+
+static volatile bool stream_pushed[NUM_TOTAL_TRANSACTIONS];
+static volatile bool stream_pending[NUM_TOTAL_TRANSACTIONS];
+static uint8_t       stream_pending_sequence[NUM_TOTAL_TRANSACTIONS];
+static systime_t     stream_pending_time[NUM_TOTAL_TRANSACTIONS];
+
+static int16_t stream_master_expected_length(uint8_t id) {
+    return split_transaction_table[id & ~SERIAL_STREAM_PUSH].target2initiator_buffer_size;
+}
+
+/**
+ * @brief Check if a valid frame was received from the slave recently, as it
+ * sends at least one every keep-alive period.
+ */
+static bool stream_is_link_up(void) {
+    return stream_link_up && chVTTimeElapsedSinceX(stream_last_rx) < TIME_MS2I(SERIAL_USART_TIMEOUT);
+}
+
+/**
+ * @brief Store a response or pushed state sent by the slave.
+ */
+static void stream_apply_frame(void) {
+    bool                      pushed         = stream_rx_frame.id & SERIAL_STREAM_PUSH;
+    uint8_t                   transaction_id = stream_rx_frame.id & ~SERIAL_STREAM_PUSH;
+    split_transaction_desc_t* transaction    = &split_transaction_table[transaction_id];
+
+    split_shared_memory_lock();
+    memcpy(split_trans_target2initiator_buffer(transaction), stream_rx_frame.payload, stream_rx_frame.length);
+    split_shared_memory_unlock();
+
+    chSysLock();
+    stream_last_rx = chVTGetSystemTimeX();
+    stream_link_up = true;
+    if (pushed) {
+        stream_pushed[transaction_id] = true;
+    } else {
+        if (stream_pending[transaction_id] && stream_pending_sequence[transaction_id] == stream_rx_frame.sequence) {
+            stream_pending[transaction_id] = false;
+        }
+        if (stream_awaited_id == transaction_id && stream_awaited_sequence == stream_rx_frame.sequence) {
+            stream_awaited_id = 0xFF;
+            chBSemSignalI(&stream_response_semaphore);
+        }
+    }
+    chSysUnlock();
+}
+
+/**
+ * @brief This thread runs on the master and stores the frames sent by the
+ * slave as they arrive.
+ */
+static THD_WORKING_AREA(waMasterThread, 256);
+static THD_FUNCTION(MasterThread, arg) {
+    (void)arg;
+    chRegSetThreadName("split_protocol_rx");
+
+    while (true) {
+        if (likely(stream_receive_frame(stream_master_expected_length))) {
+            stream_apply_frame();
+        }
+    }
+}
+
+/**
+ * @brief Master specific initializations.
+ */
+void soft_serial_initiator_init(void) {
+    serial_transport_driver_master_init();
+
+    /* Start transport thread. */
+    chThdCreateStatic(waMasterThread, sizeof(waMasterThread), HIGHPRIO, MasterThread, NULL);
+}
+
+/**
+ * @brief Send the initiator2target buffer of a transaction to the slave.
+ */
+static bool stream_send_transaction(uint8_t transaction_id, uint8_t sequence) {
+    split_transaction_desc_t* transaction = &split_transaction_table[transaction_id];
+
+    chMtxLock(&stream_tx_mutex);
+
+    split_shared_memory_lock();
+    stream_build_frame(transaction_id, sequence, split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size);
+    split_shared_memory_unlock();
+
+    bool success = stream_send_frame();
+
+    chMtxUnlock(&stream_tx_mutex);
+
+    if (unlikely(!success)) {
+        serial_dprintf("SPLIT: sending frame failed\n");
+    }
+    return success;
+}
+
+/**
+ * @brief Send a write-only transaction without waiting for its acknowledgement.
+ */
+static bool stream_post_transaction(uint8_t transaction_id) {
+    uint8_t sequence = stream_sequence++;
+
+    chSysLock();
+    stream_pending_sequence[transaction_id] = sequence;
+    stream_pending_time[transaction_id]     = chVTGetSystemTimeX();
+    stream_pending[transaction_id]          = true;
+    chSysUnlock();
+
+    return stream_send_transaction(transaction_id, sequence);
+}
+
+/**
+ * @brief Re-send the current state of every write-only transaction that the
+ * slave hasn't acknowledged in time.
+ *
+ * @return The number of transactions still waiting for an acknowledgement.
+ */
+static uint8_t stream_retry_pending(void) {
+    uint8_t pending = 0;
+    for (uint8_t transaction_id = 0; transaction_id < NUM_TOTAL_TRANSACTIONS; transaction_id++) {
+        if (!stream_pending[transaction_id]) {
+            continue;
+        }
+        /* Everything is sent again periodically once the slave is back. */
+        if (!stream_is_link_up()) {
+            stream_pending[transaction_id] = false;
+            continue;
+        }
+        if (chVTTimeElapsedSinceX(stream_pending_time[transaction_id]) >= TIME_MS2I(SERIAL_USART_STREAMING_RETRY)) {
+            serial_dprintf("SPLIT: retrying transaction %d\n", transaction_id);
+            stream_post_transaction(transaction_id);
+        }
+        pending++;
+    }
+    return pending;
+}
+
+/**
+ * @brief Send a transaction and wait for the slave's response.
+ */
+static bool stream_request_transaction(uint8_t transaction_id) {
+    /* Responses can depend on previous writes, e.g. for RPCs, so those have to land first. */
+    systime_t start = chVTGetSystemTimeX();
+    while (stream_retry_pending()) {
+        if (chVTTimeElapsedSinceX(start) >= TIME_MS2I(SERIAL_USART_TIMEOUT)) {
+            serial_dprintf("SPLIT: flushing writes failed\n");
+            return false;
+        }
+        chThdSleep(1);
+    }
+
+    uint8_t sequence = stream_sequence++;
+
+    chSysLock();
+    chBSemResetI(&stream_response_semaphore, true);
+    stream_awaited_sequence = sequence;
+    stream_awaited_id       = transaction_id;
+    chSysUnlock();
+
+    if (unlikely(!stream_send_transaction(transaction_id, sequence))) {
+        stream_awaited_id = 0xFF;
+        return false;
+    }
+
+    if (unlikely(chBSemWaitTimeout(&stream_response_semaphore, TIME_MS2I(SERIAL_USART_TIMEOUT)) != MSG_OK)) {
+        stream_awaited_id = 0xFF;
+        serial_dprintf("SPLIT: receiving response failed\n");
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Start transaction from the master half to the slave half.
+ *
+ * @param index Transaction Table index of the transaction to start.
+ * @return bool Indicates success of transaction.
+ */
+bool soft_serial_transaction(int index) {
+    uint8_t transaction_id = (uint8_t)index;
+
+    /* Sanity check that we are actually starting a valid transaction. */
+    if (unlikely(transaction_id >= NUM_TOTAL_TRANSACTIONS)) {
+        serial_dprintf("SPLIT: illegal transaction id\n");
+        return false;
+    }
+
+    stream_retry_pending();
+
+    /* The slave keeps us up to date by itself, so the latest state is already in shared memory. */
+    if (stream_is_pushed(transaction_id) && stream_pushed[transaction_id] && stream_is_link_up()) {
+        return true;
+    }
+
+    /* Writes are acknowledged in the background and re-sent until they are. */
+    if (stream_is_write_only(transaction_id) && stream_is_link_up()) {
+        return stream_post_transaction(transaction_id);
+    }
+
+    return stream_request_transaction(transaction_id);
+}
+
+#else // SERIAL_USART_STREAMING
+
 static inline bool initiate_transaction(uint8_t transaction_id);
 static inline bool react_to_transaction(void);
 
@@ -156,3 +627,5 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     return true;
 }
+
+#endif // SERIAL_USART_STREAMING
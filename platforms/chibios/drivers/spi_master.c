@@ -436,7 +436,18 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
     return spi_start_extended(&start_config);
 }
 
+spi_status_t spi_transmit_wait(void) {
+    osalSysLock();
+    if (SPI_DRIVER.state == SPI_ACTIVE) {
+        _spi_wait_s(&SPI_DRIVER);
+    }
+    osalSysUnlock();
+    return SPI_STATUS_SUCCESS;
+}
+
 spi_status_t spi_write(uint8_t data) {
+    spi_transmit_wait();
+
     uint8_t rxData;
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
@@ -444,6 +455,8 @@ spi_status_t spi_write(uint8_t data) {
 }
 
 spi_status_t spi_read(void) {
+    spi_transmit_wait();
+
     uint8_t data = 0;
     spiReceive(&SPI_DRIVER, 1, &data);
 
@@ -451,17 +464,28 @@ spi_status_t spi_read(void) {
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_transmit_wait();
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spi_transmit_wait();
+    osalSysLock();
+    spiStartSendI(&SPI_DRIVER, length, data);
+    osalSysUnlock();
+    return SPI_STATUS_SUCCESS;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_transmit_wait();
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
     if (spiStarted) {
+        spi_transmit_wait();
         spi_unselect();
         spiStop(&SPI_DRIVER);
         spiStarted = false;
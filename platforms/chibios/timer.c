@@ -118,3 +118,13 @@ uint32_t timer_read32(void) {
 
     return (uint32_t)TIME_I2MS(ticks) + ms_offset_copy;
 }
+
+uint32_t timer_read_us(void) {
+    syssts_t sts            = chSysGetStatusAndLockX();
+    uint32_t ticks          = get_system_time_ticks() - ticks_offset;
+    uint32_t ms_offset_copy = ms_offset;
+    chSysRestoreStatusX(sts);
+
+    // Shares its base with timer_read32(), so the milliseconds of both agree until this wraps around
+    return (uint32_t)TIME_I2US(ticks) + ms_offset_copy * 1000;
+}
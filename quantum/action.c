@@ -143,6 +143,10 @@ void action_exec(keyevent_t event) {
         dprintln();
     }
 #endif
+
+#ifndef NO_ACTION_ONESHOT
+    oneshot_schedule_timeout();
+#endif
 }
 
 #ifdef SWAP_HANDS_ENABLE
@@ -5,6 +5,7 @@
 #include "action_layer.h"
 #include "action_tapping.h"
 #include "action_util.h"
+#include "deadline.h"
 #include "keycode.h"
 #include "quantum_keycodes.h"
 #include "timer.h"
@@ -121,6 +122,7 @@ static void waiting_buffer_clear(void);
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
 static void waiting_buffer_scan_tap(void);
+static void tapping_schedule_deadline(void);
 static void debug_tapping_key(void);
 static void debug_waiting_buffer(void);
 
@@ -167,6 +169,8 @@ void action_tapping_process(keyrecord_t record) {
         }
 #    endif // FLOW_TAP_TERM
     }
+
+    tapping_schedule_deadline();
 }
 
 /* Some conditionally defined helper macros to keep process_tapping more
@@ -856,6 +860,7 @@ void flow_tap_update_last_event(keyrecord_t *record) {
     flow_tap_prev_keycode = keycode;
     flow_tap_prev_time    = record->event.time;
     flow_tap_expired      = false;
+    tapping_schedule_deadline();
 }
 
 static bool flow_tap_key_if_within_term(keyrecord_t *record, uint16_t prev_time) {
@@ -911,6 +916,52 @@ __attribute__((weak)) uint16_t get_flow_tap_term(uint16_t keycode, keyrecord_t *
 }
 #    endif // FLOW_TAP_TERM
 
+/** \brief Schedules the next tick event that can change the tapping state.
+ *
+ * Tick events only matter once the tapping term of the tapping key runs out,
+ * so rather than processing one every millisecond, the tick is scheduled for
+ * exactly that moment. The global and dynamic tapping terms only change on key
+ * events, which reschedule the tick, but get_tapping_term() can return a
+ * different term at any time, so with TAPPING_TERM_PER_KEY the term is checked
+ * on every tick as before.
+ */
+static void tapping_schedule_deadline(void) {
+    bool     scheduled = false;
+    uint16_t when      = 0;
+
+    if (IS_EVENT(tapping_key.event)) {
+#    if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT)) || defined(TAPPING_TERM_PER_KEY)
+        // Retro Shift can extend the tapping term depending on the event, and a per key term can change while the key is held, so keep ticking.
+        scheduled = true;
+        when      = tapping_key.event.time;
+#    else
+        const uint16_t term = GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key);
+
+        // A tapped key that is held past the tapping term only changes state on its release.
+        if (!tapping_key.event.pressed || tapping_key.tap.count == 0 || TIMER_DIFF_16(timer_read(), tapping_key.event.time) < term) {
+            scheduled = true;
+            when      = tapping_key.event.time + term;
+        }
+#    endif
+    }
+
+#    ifdef FLOW_TAP_TERM
+    if (!flow_tap_expired) {
+        const uint16_t flow_tap_when = flow_tap_prev_time + INT16_MAX / 2;
+        if (!scheduled || (int16_t)(flow_tap_when - when) < 0) {
+            scheduled = true;
+            when      = flow_tap_when;
+        }
+    }
+#    endif // FLOW_TAP_TERM
+
+    if (scheduled) {
+        deadline_set(DEADLINE_TAPPING, when);
+    } else {
+        deadline_clear(DEADLINE_TAPPING);
+    }
+}
+
 /** \brief Logs tapping key if ACTION_DEBUG is enabled. */
 static void debug_tapping_key(void) {
     ac_dprintf("TAPPING_KEY=");
@@ -19,6 +19,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "debug.h"
 #include "action_util.h"
 #include "action_layer.h"
+#include "deadline.h"
 #include "timer.h"
 #include "keycode_config.h"
 #include <string.h>
@@ -134,6 +135,7 @@ void set_oneshot_swaphands(void) {
     if (oneshot_layer_time != 0) {
         oneshot_layer_time = oneshot_swaphands_time;
     }
+    oneshot_schedule_timeout();
 #        endif
 }
 
@@ -175,6 +177,7 @@ void set_oneshot_layer(uint8_t layer, uint8_t state) {
         layer_on(layer);
 #    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
         oneshot_layer_time = timer_read();
+        oneshot_schedule_timeout();
 #    endif
         oneshot_layer_changed_kb(get_oneshot_layer());
     } else {
@@ -433,10 +436,11 @@ uint8_t get_oneshot_mods(void) {
 
 void add_oneshot_mods(uint8_t mods) {
     if ((oneshot_mods & mods) != mods) {
+        oneshot_mods |= mods;
 #    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
         oneshot_time = timer_read();
+        oneshot_schedule_timeout();
 #    endif
-        oneshot_mods |= mods;
         oneshot_mods_changed_kb(mods);
     }
 }
@@ -446,6 +450,7 @@ void del_oneshot_mods(uint8_t mods) {
         oneshot_mods &= ~mods;
 #    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
         oneshot_time = oneshot_mods ? timer_read() : 0;
+        oneshot_schedule_timeout();
 #    endif
         oneshot_mods_changed_kb(oneshot_mods);
     }
@@ -458,10 +463,11 @@ void del_oneshot_mods(uint8_t mods) {
 void set_oneshot_mods(uint8_t mods) {
     if (keymap_config.oneshot_enable) {
         if (oneshot_mods != mods) {
+            oneshot_mods = mods;
 #    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
             oneshot_time = timer_read();
+            oneshot_schedule_timeout();
 #    endif
-            oneshot_mods = mods;
             oneshot_mods_changed_kb(mods);
         }
     }
@@ -480,6 +486,40 @@ void clear_oneshot_mods(void) {
         oneshot_mods_changed_kb(oneshot_mods);
     }
 }
+
+/** \brief Schedules a tick event for the earliest one shot timeout
+ *
+ * Called whenever a one shot timer starts and after every action, so that
+ * action_exec() gets to check the timeouts exactly when they run out.
+ */
+void oneshot_schedule_timeout(void) {
+#    if (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
+    bool     scheduled = false;
+    uint16_t when      = 0;
+
+    if (oneshot_mods) {
+        scheduled = true;
+        when      = oneshot_time;
+    }
+    // A timed out layer that is still held only changes state on its release.
+    if ((get_oneshot_layer_state() & ONESHOT_OTHER_KEY_PRESSED) && !(get_oneshot_layer_state() & ONESHOT_TOGGLED) && (!scheduled || (int16_t)(oneshot_layer_time - when) < 0)) {
+        scheduled = true;
+        when      = oneshot_layer_time;
+    }
+#        ifdef SWAP_HANDS_ENABLE
+    if (swap_hands_oneshot == SHO_ACTIVE && (!scheduled || (int16_t)(oneshot_swaphands_time - when) < 0)) {
+        scheduled = true;
+        when      = oneshot_swaphands_time;
+    }
+#        endif
+
+    if (scheduled) {
+        deadline_set(DEADLINE_ONESHOT, when + ONESHOT_TIMEOUT);
+    } else {
+        deadline_clear(DEADLINE_ONESHOT);
+    }
+#    endif
+}
 #endif
 
 /** \brief Called when the one shot modifiers have been changed.
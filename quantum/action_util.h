@@ -82,6 +82,7 @@ bool    is_oneshot_layer_active(void);
 uint8_t get_oneshot_layer_state(void);
 bool    has_oneshot_layer_timed_out(void);
 bool    has_oneshot_swaphands_timed_out(void);
+void    oneshot_schedule_timeout(void);
 
 void oneshot_locked_mods_changed_user(uint8_t mods);
 void oneshot_locked_mods_changed_kb(uint8_t mods);
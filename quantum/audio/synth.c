@@ -0,0 +1,232 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "audio.h"
+#include "synth.h"
+#include "compiler_support.h"
+#include "util.h"
+
+// Envelope levels and mixer gain are Q1.15, so that a full-scale sample multiplied by either still fits in 32 bits
+#define SYNTH_UNITY 0x8000
+
+// Voices are rendered into a mix buffer this many samples at a time, keeping stack usage bounded
+#define SYNTH_RENDER_CHUNK_SIZE 32
+
+STATIC_ASSERT(AUDIO_SYNTH_MAX_VOICES <= 32, "AUDIO_SYNTH_MAX_VOICES must be 32 or less");
+
+typedef enum {
+    VOICE_IDLE,
+    VOICE_ATTACK,
+    VOICE_SUSTAIN,
+    VOICE_RELEASE,
+} synth_voice_stage_t;
+
+typedef struct synth_voice_t {
+    uint32_t frequency; // Q16.16, in Hz
+    uint32_t phase;     // Q16.16 position within the wavetable
+    uint32_t increment; // Q16.16 wavetable entries per sample
+    uint16_t envelope;  // Q1.15 current level
+    uint8_t  stage;     // see synth_voice_stage_t
+} synth_voice_t;
+
+static synth_voice_t   voices[AUDIO_SYNTH_MAX_VOICES];
+static const uint16_t *wavetable       = NULL;
+static uint32_t        phase_mask      = 0;
+static uint32_t        increment_scale = 0; // Q32 wavetable entries per sample, per Hz
+static int32_t         off_value       = 0;
+static int32_t         sample_max      = 0;
+static uint16_t        attack_step     = SYNTH_UNITY;
+static uint16_t        release_step    = SYNTH_UNITY;
+static uint16_t        gain            = SYNTH_UNITY;
+static uint16_t        gain_target     = SYNTH_UNITY;
+
+static uint16_t synth_ramp_step(uint32_t sample_rate, uint32_t ms) {
+    uint32_t ramp_samples = sample_rate * ms / 1000;
+    if (ramp_samples == 0) {
+        return SYNTH_UNITY;
+    }
+    return MAX(1, SYNTH_UNITY / ramp_samples);
+}
+
+void audio_synth_init(const uint16_t *table, uint16_t table_length, uint32_t sample_rate, uint16_t off) {
+    wavetable       = table;
+    phase_mask      = ((uint32_t)table_length << 16) - 1;
+    increment_scale = (uint32_t)(((uint64_t)table_length << 32) / sample_rate);
+    off_value       = off;
+    attack_step     = synth_ramp_step(sample_rate, AUDIO_SYNTH_ATTACK_MS);
+    release_step    = synth_ramp_step(sample_rate, AUDIO_SYNTH_RELEASE_MS);
+
+    // Output is clamped to the range of the wavetable
+    sample_max = off;
+    for (uint16_t i = 0; i < table_length; ++i) {
+        sample_max = MAX(sample_max, table[i]);
+    }
+
+    audio_synth_reset();
+}
+
+void audio_synth_reset(void) {
+    memset(voices, 0, sizeof(voices));
+    gain        = SYNTH_UNITY;
+    gain_target = SYNTH_UNITY;
+}
+
+static void synth_voice_tune(synth_voice_t *voice, uint32_t frequency) {
+    voice->frequency = frequency;
+    voice->increment = (uint32_t)(((uint64_t)frequency * increment_scale) >> 32);
+}
+
+static synth_voice_t *synth_allocate_voice(uint32_t claimed) {
+    // Prefer an idle voice, otherwise steal whichever fading voice is quietest
+    synth_voice_t *quietest = NULL;
+    for (uint8_t i = 0; i < AUDIO_SYNTH_MAX_VOICES; ++i) {
+        if (claimed & (1UL << i)) {
+            continue;
+        }
+        if (voices[i].stage == VOICE_IDLE) {
+            return &voices[i];
+        }
+        if (voices[i].stage == VOICE_RELEASE && (!quietest || voices[i].envelope < quietest->envelope)) {
+            quietest = &voices[i];
+        }
+    }
+    return quietest;
+}
+
+void audio_synth_set_tones(const uint32_t *frequencies, uint8_t count) {
+    uint32_t claimed  = 0; // voices which will be playing one of the supplied tones
+    uint32_t assigned = 0; // tones which have been given a voice
+
+    count = MIN(count, AUDIO_SYNTH_MAX_VOICES);
+
+    // Tones which are already playing keep their voice
+    for (uint8_t t = 0; t < count; ++t) {
+        for (uint8_t i = 0; i < AUDIO_SYNTH_MAX_VOICES; ++i) {
+            if (!(claimed & (1UL << i)) && (voices[i].stage == VOICE_ATTACK || voices[i].stage == VOICE_SUSTAIN) && voices[i].frequency == frequencies[t]) {
+                claimed |= 1UL << i;
+                assigned |= 1UL << t;
+                break;
+            }
+        }
+    }
+
+    // Voices whose tone went away are retuned to play new tones, continuing from their current phase
+    for (uint8_t t = 0; t < count; ++t) {
+        if (assigned & (1UL << t)) {
+            continue;
+        }
+        for (uint8_t i = 0; i < AUDIO_SYNTH_MAX_VOICES; ++i) {
+            if (!(claimed & (1UL << i)) && (voices[i].stage == VOICE_ATTACK || voices[i].stage == VOICE_SUSTAIN)) {
+                synth_voice_tune(&voices[i], frequencies[t]);
+                claimed |= 1UL << i;
+                assigned |= 1UL << t;
+                break;
+            }
+        }
+    }
+
+    // Any tones left over fade in on a new voice
+    for (uint8_t t = 0; t < count; ++t) {
+        if (assigned & (1UL << t)) {
+            continue;
+        }
+        synth_voice_t *voice = synth_allocate_voice(claimed);
+        if (!voice) {
+            break;
+        }
+        synth_voice_tune(voice, frequencies[t]);
+        voice->phase = 0;
+        voice->stage = VOICE_ATTACK;
+        claimed |= 1UL << (voice - voices);
+    }
+
+    // Everything else fades out
+    uint8_t held = 0;
+    for (uint8_t i = 0; i < AUDIO_SYNTH_MAX_VOICES; ++i) {
+        if (claimed & (1UL << i)) {
+            ++held;
+        } else if (voices[i].stage == VOICE_ATTACK || voices[i].stage == VOICE_SUSTAIN) {
+            voices[i].stage = VOICE_RELEASE;
+        }
+    }
+
+    // Mix the held tones at equal volume, fading voices keep the previous gain until they're done
+    if (held > 0) {
+        gain_target = SYNTH_UNITY / held;
+    }
+}
+
+bool audio_synth_is_silent(void) {
+    for (uint8_t i = 0; i < AUDIO_SYNTH_MAX_VOICES; ++i) {
+        if (voices[i].stage != VOICE_IDLE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void synth_render_voice(synth_voice_t *voice, int32_t *mix, uint16_t count) {
+    uint32_t phase     = voice->phase;
+    uint32_t increment = voice->increment;
+    int32_t  envelope  = voice->envelope;
+    int32_t  step      = 0;
+
+    if (voice->stage == VOICE_ATTACK) {
+        step = attack_step;
+    } else if (voice->stage == VOICE_RELEASE) {
+        step = -(int32_t)release_step;
+    }
+
+    for (uint16_t i = 0; i < count; ++i) {
+        int32_t sample = (int32_t)wavetable[phase >> 16] - off_value;
+        mix[i] += (sample * envelope) >> 15;
+        phase = (phase + increment) & phase_mask;
+
+        if (step != 0) {
+            envelope += step;
+            if (envelope >= SYNTH_UNITY) {
+                envelope     = SYNTH_UNITY;
+                step         = 0;
+                voice->stage = VOICE_SUSTAIN;
+            } else if (envelope <= 0) {
+                envelope     = 0;
+                voice->stage = VOICE_IDLE;
+                break;
+            }
+        }
+    }
+
+    voice->phase    = phase;
+    voice->envelope = envelope;
+}
+
+void audio_synth_render(uint16_t *samples, uint16_t count) {
+    int32_t mix[SYNTH_RENDER_CHUNK_SIZE];
+
+    while (count > 0) {
+        uint16_t chunk = MIN(count, SYNTH_RENDER_CHUNK_SIZE);
+        memset(mix, 0, chunk * sizeof(int32_t));
+
+        for (uint8_t i = 0; i < AUDIO_SYNTH_MAX_VOICES; ++i) {
+            if (voices[i].stage != VOICE_IDLE) {
+                synth_render_voice(&voices[i], mix, chunk);
+            }
+        }
+
+        for (uint16_t i = 0; i < chunk; ++i) {
+            // Ease the mixer gain towards its target, so changing the number of tones doesn't cause a jump in volume
+            if (gain < gain_target) {
+                gain = MIN(gain + release_step, gain_target);
+            } else if (gain > gain_target) {
+                gain = MAX(gain - release_step, gain_target);
+            }
+
+            int32_t value = off_value + ((MAX(-0xFFFF, MIN(mix[i], 0xFFFF)) * gain) >> 15);
+            samples[i]    = MAX(0, MIN(value, sample_max));
+        }
+
+        samples += chunk;
+        count -= chunk;
+    }
+}
@@ -0,0 +1,83 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Fixed-point wavetable synthesizer
+ *
+ * Renders any number of simultaneous tones from a single-cycle wavetable, using Q16.16 phase accumulators and
+ * integer-only per-sample maths so it can run inside an audio ISR on MCUs without an FPU. Each voice has a linear
+ * attack/release envelope, so tones can start, stop and change at any sample without clicking.
+ */
+
+/**
+ * The number of voices which can sound at once. Released tones keep their voice until they've faded out, so this
+ * defaults to twice the number of simultaneous tones the audio driver can play.
+ */
+#ifndef AUDIO_SYNTH_MAX_VOICES
+#    ifdef AUDIO_MAX_SIMULTANEOUS_TONES
+#        define AUDIO_SYNTH_MAX_VOICES (2 * (AUDIO_MAX_SIMULTANEOUS_TONES))
+#    else
+#        define AUDIO_SYNTH_MAX_VOICES 8
+#    endif
+#endif
+
+/**
+ * Time taken for a new tone to fade in, in milliseconds.
+ */
+#ifndef AUDIO_SYNTH_ATTACK_MS
+#    define AUDIO_SYNTH_ATTACK_MS 2
+#endif
+
+/**
+ * Time taken for a stopped tone to fade out, in milliseconds. This also controls how quickly the overall volume
+ * adjusts as the number of tones being mixed together changes.
+ */
+#ifndef AUDIO_SYNTH_RELEASE_MS
+#    define AUDIO_SYNTH_RELEASE_MS 8
+#endif
+
+/**
+ * Converts a frequency in Hz to the Q16.16 representation used by the synthesizer.
+ */
+#define AUDIO_SYNTH_FREQUENCY(hz) ((uint32_t)((hz) * 65536.0f))
+
+/**
+ * @brief Sets up the synthesizer and silences all voices
+ *
+ * @param[in] wavetable single cycle of the waveform to play, with a power-of-two number of entries
+ * @param[in] wavetable_length number of entries in the wavetable
+ * @param[in] sample_rate rate at which samples are rendered, in Hz
+ * @param[in] off_value sample value output while silent; tones fade in and out around this value
+ */
+void audio_synth_init(const uint16_t *wavetable, uint16_t wavetable_length, uint32_t sample_rate, uint16_t off_value);
+
+/**
+ * @brief Silences all voices immediately
+ */
+void audio_synth_reset(void);
+
+/**
+ * @brief Sets the tones which should currently be sounding
+ *
+ * @details Tones already playing keep their voice and phase. Voices whose frequency changed are retuned
+ *          without restarting their waveform, new tones fade in, and any voices no longer required fade out.
+ *
+ * @param[in] frequencies Q16.16 frequencies in Hz, see AUDIO_SYNTH_FREQUENCY
+ * @param[in] count number of entries in frequencies, may be zero to release all voices
+ */
+void audio_synth_set_tones(const uint32_t *frequencies, uint8_t count);
+
+/**
+ * @brief Checks whether all voices have finished fading out
+ */
+bool audio_synth_is_silent(void);
+
+/**
+ * @brief Renders a block of samples, such as one half of a DMA double buffer
+ */
+void audio_synth_render(uint16_t *samples, uint16_t count);
@@ -14,6 +14,7 @@
 
 #include <stdint.h>
 #include "caps_word.h"
+#include "deadline.h"
 #include "timer.h"
 #include "action.h"
 #include "action_util.h"
@@ -32,13 +33,14 @@ static bool caps_word_active = false;
 static uint16_t idle_timer = 0;
 
 void caps_word_task(void) {
-    if (caps_word_active && timer_expired(timer_read(), idle_timer)) {
+    if (caps_word_active && deadline_expired(DEADLINE_CAPS_WORD)) {
         caps_word_off();
     }
 }
 
 void caps_word_reset_idle_timer(void) {
     idle_timer = timer_read() + CAPS_WORD_IDLE_TIMEOUT;
+    deadline_set(DEADLINE_CAPS_WORD, idle_timer);
 }
 #else
 void caps_word_task(void) {}
@@ -68,6 +70,9 @@ void caps_word_off(void) {
 
     unregister_weak_mods(MOD_MASK_SHIFT); // Make sure weak shift is off.
     caps_word_active = false;
+#if CAPS_WORD_IDLE_TIMEOUT > 0
+    deadline_clear(DEADLINE_CAPS_WORD);
+#endif // CAPS_WORD_IDLE_TIMEOUT > 0
     caps_word_set_user(false);
 }
 
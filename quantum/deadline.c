@@ -0,0 +1,121 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "deadline.h"
+#include "timer.h"
+
+// Binary min-heap of the scheduled deadlines, so that the earliest one can be checked without looking at every feature.
+static uint16_t deadline_time[DEADLINE_COUNT];
+static uint8_t  deadline_heap[DEADLINE_COUNT];
+static uint8_t  deadline_position[DEADLINE_COUNT];
+static uint8_t  deadline_count = 0;
+
+#define DEADLINE_UNSCHEDULED 0xFF
+
+// Times wrap around, so deadlines are ordered by their signed distance rather than their value.
+#define DEADLINE_BEFORE(a, b) ((int16_t)(deadline_time[a] - deadline_time[b]) < 0)
+
+static void deadline_heap_store(uint8_t position, uint8_t id) {
+    deadline_heap[position] = id;
+    deadline_position[id]   = position;
+}
+
+static void deadline_sift_up(uint8_t position) {
+    uint8_t id = deadline_heap[position];
+
+    while (position > 0) {
+        uint8_t parent = (position - 1) / 2;
+        if (!DEADLINE_BEFORE(id, deadline_heap[parent])) {
+            break;
+        }
+        deadline_heap_store(position, deadline_heap[parent]);
+        position = parent;
+    }
+    deadline_heap_store(position, id);
+}
+
+static void deadline_sift_down(uint8_t position) {
+    uint8_t id = deadline_heap[position];
+
+    while (true) {
+        uint8_t child = position * 2 + 1;
+        if (child >= deadline_count) {
+            break;
+        }
+        if (child + 1 < deadline_count && DEADLINE_BEFORE(deadline_heap[child + 1], deadline_heap[child])) {
+            child++;
+        }
+        if (!DEADLINE_BEFORE(deadline_heap[child], id)) {
+            break;
+        }
+        deadline_heap_store(position, deadline_heap[child]);
+        position = child;
+    }
+    deadline_heap_store(position, id);
+}
+
+static inline bool deadline_scheduled(deadline_id_t id) {
+    return deadline_count > 0 && deadline_position[id] < deadline_count && deadline_heap[deadline_position[id]] == id;
+}
+
+void deadline_set(deadline_id_t id, uint16_t when) {
+    if (id >= DEADLINE_COUNT) {
+        return;
+    }
+
+    if (!deadline_scheduled(id)) {
+        deadline_time[id] = when;
+        deadline_heap_store(deadline_count++, id);
+        deadline_sift_up(deadline_count - 1);
+        return;
+    }
+
+    bool earlier      = (int16_t)(when - deadline_time[id]) < 0;
+    deadline_time[id] = when;
+    if (earlier) {
+        deadline_sift_up(deadline_position[id]);
+    } else {
+        deadline_sift_down(deadline_position[id]);
+    }
+}
+
+void deadline_clear(deadline_id_t id) {
+    if (id >= DEADLINE_COUNT || !deadline_scheduled(id)) {
+        return;
+    }
+
+    uint8_t position      = deadline_position[id];
+    uint8_t last          = deadline_heap[--deadline_count];
+    deadline_position[id] = DEADLINE_UNSCHEDULED;
+    if (position == deadline_count) {
+        return;
+    }
+
+    // Move the last entry into the hole and restore the heap order in whichever direction it is violated.
+    deadline_heap_store(position, last);
+    if (position > 0 && DEADLINE_BEFORE(last, deadline_heap[(position - 1) / 2])) {
+        deadline_sift_up(position);
+    } else {
+        deadline_sift_down(position);
+    }
+}
+
+bool deadline_is_set(deadline_id_t id) {
+    return id < DEADLINE_COUNT && deadline_scheduled(id);
+}
+
+bool deadline_expired(deadline_id_t id) {
+    return deadline_is_set(id) && timer_expired(timer_read(), deadline_time[id]);
+}
+
+bool deadline_next(uint16_t *when) {
+    if (deadline_count == 0) {
+        return false;
+    }
+    *when = deadline_time[deadline_heap[0]];
+    return true;
+}
+
+bool deadline_pending(void) {
+    return deadline_count > 0 && timer_expired(timer_read(), deadline_time[deadline_heap[0]]);
+}
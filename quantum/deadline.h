@@ -0,0 +1,64 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @enum Core features that schedule work for a point in time.
+ * @brief Each feature owns exactly one deadline, which it moves whenever its own timer changes.
+ */
+typedef enum deadline_id_t {
+    DEADLINE_TAPPING,
+    DEADLINE_ONESHOT,
+    DEADLINE_COMBO,
+    DEADLINE_TAP_DANCE,
+    DEADLINE_LEADER,
+    DEADLINE_CAPS_WORD,
+    DEADLINE_AUTO_SHIFT,
+    DEADLINE_COUNT,
+} deadline_id_t;
+
+/**
+ * Schedules the deadline of a feature, replacing any previously scheduled one.
+ *
+ * Deadlines are kept in the time-space of timer_read(), so all pending deadlines must lie within half the timer range of each other.
+ *
+ * @param id[in] the feature whose deadline is scheduled
+ * @param when[in] the timer_read() value at which the deadline expires
+ */
+void deadline_set(deadline_id_t id, uint16_t when);
+
+/**
+ * Cancels the deadline of a feature, if one is scheduled.
+ *
+ * @param id[in] the feature whose deadline is cancelled
+ */
+void deadline_clear(deadline_id_t id);
+
+/**
+ * @param id[in] the feature to check
+ * @return true if a deadline is scheduled for the feature
+ */
+bool deadline_is_set(deadline_id_t id);
+
+/**
+ * @param id[in] the feature to check
+ * @return true if a deadline is scheduled for the feature and has been reached
+ */
+bool deadline_expired(deadline_id_t id);
+
+/**
+ * Looks up the earliest scheduled deadline, without removing it.
+ *
+ * @param when[out] the timer_read() value of the earliest deadline
+ * @return true if any deadline is scheduled, otherwise false and `when` is left untouched
+ */
+bool deadline_next(uint16_t *when);
+
+/**
+ * @return true if the earliest scheduled deadline has been reached, meaning some feature has work to do
+ */
+bool deadline_pending(void);
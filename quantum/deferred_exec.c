@@ -12,30 +12,109 @@
 //------------------------------------
 // Helpers
 //
+// Each table doubles as a binary min-heap ordered by trigger time. The heap is a permutation of the table slots, held in
+// `heap_slot` (the slot at each heap position) and `heap_position` (the heap position of each slot): the first
+// `heap_count` positions hold the pending executors, the remaining positions hold the free slots. Both are stored as
+// offsets from their own index so that a zero-initialised table is the identity permutation with nothing pending.
+//
+// Tokens are allocated so that `(token - 1) % table_count` is the slot holding them, so lookups need no search.
+//
 
 static deferred_token current_token = 0;
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
-    }
-    for (int i = 0; i < table_count; ++i) {
-        if (table[i].token == token) {
-            return false;
+static inline size_t usable_count(size_t table_count) {
+    // Heap bookkeeping and tokens are both 8-bit
+    return table_count > UINT8_MAX ? UINT8_MAX : table_count;
+}
+
+static inline uint8_t slot_at(deferred_executor_t *table, uint8_t position) {
+    return (uint8_t)(position + table[position].heap_slot);
+}
+
+static inline uint8_t position_of(deferred_executor_t *table, uint8_t slot) {
+    return (uint8_t)(slot + table[slot].heap_position);
+}
+
+static inline void heap_store(deferred_executor_t *table, uint8_t position, uint8_t slot) {
+    table[position].heap_slot = (uint8_t)(slot - position);
+    table[slot].heap_position = (uint8_t)(position - slot);
+}
+
+static inline bool triggers_before(deferred_executor_t *table, uint8_t a, uint8_t b) {
+    return ((int32_t)TIMER_DIFF_32(table[a].trigger_time, table[b].trigger_time)) < 0;
+}
+
+static void heap_sift_up(deferred_executor_t *table, uint8_t position) {
+    uint8_t slot = slot_at(table, position);
+    while (position > 0) {
+        uint8_t parent = (position - 1) / 2;
+        if (!triggers_before(table, slot, slot_at(table, parent))) {
+            break;
         }
+        heap_store(table, position, slot_at(table, parent));
+        position = parent;
     }
-    return true;
+    heap_store(table, position, slot);
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
-    deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
-        ++current_token;
-        if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
-            return INVALID_DEFERRED_TOKEN;
+static void heap_sift_down(deferred_executor_t *table, uint8_t position) {
+    uint8_t count = table[0].heap_count;
+    uint8_t slot  = slot_at(table, position);
+    while (true) {
+        uint16_t child = position * 2 + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && triggers_before(table, slot_at(table, child + 1), slot_at(table, child))) {
+            ++child;
         }
+        if (!triggers_before(table, slot_at(table, child), slot)) {
+            break;
+        }
+        heap_store(table, position, slot_at(table, child));
+        position = child;
+    }
+    heap_store(table, position, slot);
+}
+
+static void heap_restore(deferred_executor_t *table, uint8_t position) {
+    if (position > 0 && triggers_before(table, slot_at(table, position), slot_at(table, (position - 1) / 2))) {
+        heap_sift_up(table, position);
+    } else {
+        heap_sift_down(table, position);
+    }
+}
+
+static void heap_remove(deferred_executor_t *table, uint8_t slot) {
+    uint8_t position = position_of(table, slot);
+    uint8_t last     = --table[0].heap_count;
+
+    // Swap the last pending executor into the hole, leaving the freed slot just past the pending ones
+    uint8_t last_slot = slot_at(table, last);
+    heap_store(table, position, last_slot);
+    heap_store(table, last, slot);
+    if (position != last) {
+        heap_restore(table, position);
     }
+
+    table[slot].token        = INVALID_DEFERRED_TOKEN;
+    table[slot].trigger_time = 0;
+    table[slot].callback     = NULL;
+    table[slot].cb_arg       = NULL;
+}
+
+static inline deferred_executor_t *find_entry(deferred_executor_t *table, size_t table_count, deferred_token token) {
+    deferred_executor_t *entry = &table[(token - 1) % table_count];
+    return entry->token == token ? entry : NULL;
+}
+
+static inline deferred_token allocate_token(size_t table_count, uint8_t slot) {
+    // The next token after the last one handed out that maps to the slot, so that recently cancelled tokens are not reused immediately
+    uint16_t token = current_token + 1 + (slot + table_count - current_token % table_count) % table_count;
+    if (token > UINT8_MAX) {
+        token = slot + 1;
+    }
+    current_token = (deferred_token)token;
     return current_token;
 }
 
@@ -48,28 +127,24 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
     if (!table || table_count == 0 || delay_ms == 0 || !callback) {
         return INVALID_DEFERRED_TOKEN;
     }
+    table_count = usable_count(table_count);
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
-
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // None available
+    uint8_t position = table[0].heap_count;
+    if (position >= table_count) {
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Claim the first free slot, which sits just past the pending executors
+    uint8_t              slot  = slot_at(table, position);
+    deferred_executor_t *entry = &table[slot];
+    entry->token               = allocate_token(table_count, slot);
+    entry->trigger_time        = timer_read32() + delay_ms;
+    entry->callback            = callback;
+    entry->cb_arg              = cb_arg;
+    table[0].heap_count++;
+    heap_sift_up(table, position);
+    return entry->token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -77,19 +152,18 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     if (!table || table_count == 0 || delay_ms == 0 || token == INVALID_DEFERRED_TOKEN) {
         return false;
     }
+    table_count = usable_count(table_count);
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    deferred_executor_t *entry = find_entry(table, table_count, token);
+    if (!entry) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    entry->trigger_time = timer_read32() + delay_ms;
+    heap_restore(table, position_of(table, entry - table));
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -97,22 +171,25 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     if (!table || table_count == 0 || token == INVALID_DEFERRED_TOKEN) {
         return false;
     }
+    table_count = usable_count(table_count);
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    deferred_executor_t *entry = find_entry(table, table_count, token);
+    if (!entry) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    heap_remove(table, entry - table);
+    return true;
+}
+
+bool deferred_exec_advanced_next(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time) {
+    if (!table || table_count == 0 || table[0].heap_count == 0) {
+        return false;
+    }
+    *trigger_time = table[slot_at(table, 0)].trigger_time;
+    return true;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
@@ -121,37 +198,78 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     // Throttle only once per millisecond
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
+        table_count          = usable_count(table_count);
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
-            deferred_token       curr_token = entry->token;
-
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+        // Nothing is due unless the earliest executor is
+        uint8_t pending = table[0].heap_count;
+        if (pending == 0 || ((int32_t)TIMER_DIFF_32(table[slot_at(table, 0)].trigger_time, now)) > 0) {
+            return;
+        }
 
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
+        // Gather the executors that are due before running any of them, so that each runs at most once per task even
+        // if it requeues itself for a time that has already passed. Due executors form a subtree at the top of the
+        // heap, which is walked breadth-first using the list itself as the queue. The list holds as many executors as
+        // the basic table; any more due in a larger table are left in the heap for an unthrottled follow-up task.
+        deferred_token due[MAX_DEFERRED_EXECUTORS];
+        uint8_t        due_count = 0;
+        bool           truncated = false;
+        due[due_count++]         = 0;
+        for (uint8_t i = 0; i < due_count; ++i) {
+            for (uint16_t child = due[i] * 2 + 1; child <= due[i] * 2 + 2U && child < pending; ++child) {
+                if (((int32_t)TIMER_DIFF_32(table[slot_at(table, child)].trigger_time, now)) <= 0) {
+                    if (due_count == sizeof(due) / sizeof(due[0])) {
+                        truncated = true;
+                        break;
+                    }
+                    due[due_count++] = (uint8_t)child;
                 }
+            }
+        }
 
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
-                }
+        // Swap the heap positions for tokens, which stay valid however the heap changes, ordered earliest first
+        for (uint8_t i = 0; i < due_count; ++i) {
+            deferred_executor_t *entry = &table[slot_at(table, due[i])];
+            uint8_t              j     = i;
+            while (j > 0 && ((int32_t)TIMER_DIFF_32(entry->trigger_time, find_entry(table, table_count, due[j - 1])->trigger_time)) < 0) {
+                due[j] = due[j - 1];
+                --j;
             }
+            due[j] = entry->token;
+        }
+
+        for (uint8_t i = 0; i < due_count; ++i) {
+            // Skip executors cancelled or extended by an earlier callback
+            deferred_executor_t *entry = find_entry(table, table_count, due[i]);
+            if (!entry || ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) > 0) {
+                continue;
+            }
+
+            // Invoke the callback and work work out if we should be requeued
+            deferred_token curr_token = entry->token;
+            uint32_t       delay_ms   = entry->callback(entry->trigger_time, entry->cb_arg);
+
+            // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
+            if (entry->token != curr_token) {
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                entry->trigger_time += delay_ms;
+                heap_sift_down(table, position_of(table, entry - table));
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                heap_remove(table, entry - table);
+            }
+        }
+
+        // Let the next task pick up whatever didn't fit, rather than waiting for the next millisecond
+        if (truncated) {
+            *last_execution_time = now - 1;
         }
     }
 }
@@ -172,6 +290,9 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
 bool cancel_deferred_exec(deferred_token token) {
     return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
 }
+bool deferred_exec_next(uint32_t *trigger_time) {
+    return deferred_exec_advanced_next(basic_executors, MAX_DEFERRED_EXECUTORS, trigger_time);
+}
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
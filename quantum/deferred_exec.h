@@ -60,6 +60,14 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms);
  */
 bool cancel_deferred_exec(deferred_token token);
 
+/**
+ * Retrieves the time at which the next deferred execution is due, allowing callers to decide how long they may sleep.
+ *
+ * @param trigger_time[out] the trigger time of the earliest pending executor -- equivalent time-space as timer_read32()
+ * @return true if an executor is pending and trigger_time was written, otherwise false
+ */
+bool deferred_exec_next(uint32_t *trigger_time);
+
 /**
  * Forward declaration for the main loop in order to execute any deferred executors. Should not be invoked by keyboard/user code.
  */
@@ -72,10 +80,14 @@ void deferred_exec_task(void);
 /**
  * @struct Structure for containing self-hosted deferred executor tables.
  * @brief Core-side code can use this to create their own tables without impacting on the use of users' ability to add deferred execution.
- *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in an array.
+ *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in an array,
+ *        zero-initialised. Tables are limited to 255 entries; any beyond that are left unused.
  */
 typedef struct deferred_executor_t {
     deferred_token         token;
+    uint8_t                heap_slot;
+    uint8_t                heap_position;
+    uint8_t                heap_count;
     uint32_t               trigger_time;
     deferred_exec_callback callback;
     void *                 cb_arg;
@@ -110,6 +122,16 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  */
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token);
 
+/**
+ * Retrieves the time at which the next deferred execution in a custom table is due.
+ *
+ * @param table[in] the custom table used for storage
+ * @param table_count[in] the number of available items in the table
+ * @param trigger_time[out] the trigger time of the earliest pending executor -- equivalent time-space as timer_read32()
+ * @return true if an executor is pending and trigger_time was written, otherwise false
+ */
+bool deferred_exec_advanced_next(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time);
+
 /**
  * Forward declaration for the main loop in order to execute any custom table deferred executors. Should not be invoked by keyboard/user code.
  * Needed for any custom-allocated deferred execution tables. Any core tasks should add appropriate invocation to quantum/main.c.
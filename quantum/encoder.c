@@ -5,6 +5,18 @@
 #include "action.h"
 #include "encoder.h"
 #include "wait.h"
+#ifdef ENCODER_COALESCE_EVENTS
+#    include "atomic_util.h"
+#    include "timer.h"
+#    ifdef ENCODER_MAP_ENABLE
+#        include "action_tapping.h"
+#    endif
+#    ifdef POINTING_DEVICE_ENABLE
+#        include "pointing_device.h"
+#    elif defined(MOUSEKEY_ENABLE)
+#        include "mousekey.h"
+#    endif
+#endif // ENCODER_COALESCE_EVENTS
 
 #ifndef ENCODER_MAP_KEY_DELAY
 #    define ENCODER_MAP_KEY_DELAY TAP_CODE_DELAY
@@ -17,8 +29,21 @@ __attribute__((weak)) bool should_process_encoder(void) {
 static encoder_events_t encoder_events;
 static bool             signal_queue_drain = false;
 
+#ifdef ENCODER_COALESCE_EVENTS
+typedef struct encoder_motion_t {
+    int16_t  count;     // detents accumulated since the last time this encoder was handled
+    uint16_t velocity;  // smoothed detents per second
+    uint16_t last_time; // time this encoder was last handled
+} encoder_motion_t;
+
+static encoder_motion_t encoder_motion[NUM_ENCODERS];
+#endif // ENCODER_COALESCE_EVENTS
+
 void encoder_init(void) {
     memset(&encoder_events, 0, sizeof(encoder_events));
+#ifdef ENCODER_COALESCE_EVENTS
+    memset(encoder_motion, 0, sizeof(encoder_motion));
+#endif // ENCODER_COALESCE_EVENTS
     encoder_driver_init();
 }
 
@@ -27,32 +52,147 @@ static void encoder_queue_drain(void) {
     encoder_events.dequeued = encoder_events.enqueued;
 }
 
-static bool encoder_handle_queue(void) {
-    bool    changed = false;
-    uint8_t index;
-    bool    clockwise;
-    while (encoder_dequeue_event(&index, &clockwise)) {
+static void encoder_exec_event(uint8_t index, bool clockwise) {
 #ifdef ENCODER_MAP_ENABLE
 
-        // The delays below cater for Windows and its wonderful requirements.
-        action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true));
+    // The delays below cater for Windows and its wonderful requirements.
+    action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true));
 #    if ENCODER_MAP_KEY_DELAY > 0
-        wait_ms(ENCODER_MAP_KEY_DELAY);
+    wait_ms(ENCODER_MAP_KEY_DELAY);
 #    endif // ENCODER_MAP_KEY_DELAY > 0
 
-        action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, false) : MAKE_ENCODER_CCW_EVENT(index, false));
+    action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, false) : MAKE_ENCODER_CCW_EVENT(index, false));
 #    if ENCODER_MAP_KEY_DELAY > 0
-        wait_ms(ENCODER_MAP_KEY_DELAY);
+    wait_ms(ENCODER_MAP_KEY_DELAY);
 #    endif // ENCODER_MAP_KEY_DELAY > 0
 
 #else // ENCODER_MAP_ENABLE
 
-        encoder_update_kb(index, clockwise);
+    encoder_update_kb(index, clockwise);
 
 #endif // ENCODER_MAP_ENABLE
+}
+
+#ifdef ENCODER_COALESCE_EVENTS
+
+#    if defined(ENCODER_MAP_ENABLE) && (defined(POINTING_DEVICE_ENABLE) || defined(MOUSEKEY_ENABLE))
+#        define ENCODER_COALESCE_WHEEL
+
+static mouse_hv_report_t encoder_clamp_wheel(int32_t value) {
+    return MAX(MOUSE_REPORT_HV_MIN, MIN(value, MOUSE_REPORT_HV_MAX));
+}
+
+// Scrolls the wheel by the given number of detents in a single report, instead of one report per detent.
+static bool encoder_send_wheel(uint16_t keycode, int16_t detents) {
+    int16_t v = 0;
+    int16_t h = 0;
+    switch (keycode) {
+        case QK_MOUSE_WHEEL_UP:
+            v = detents;
+            break;
+        case QK_MOUSE_WHEEL_DOWN:
+            v = -detents;
+            break;
+        case QK_MOUSE_WHEEL_LEFT:
+            h = -detents;
+            break;
+        case QK_MOUSE_WHEEL_RIGHT:
+            h = detents;
+            break;
+        default:
+            return false;
+    }
+
+#        ifdef POINTING_DEVICE_ENABLE
+    // Merged into the pending pointing device report, which is sent straight after the encoder task
+    int32_t scale = 1;
+#            ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
+    scale = pointing_device_get_hires_scroll_resolution();
+#            endif // POINTING_DEVICE_HIRES_SCROLL_ENABLE
+    report_mouse_t report = pointing_device_get_report();
+    report.v              = encoder_clamp_wheel(report.v + (int32_t)v * scale);
+    report.h              = encoder_clamp_wheel(report.h + (int32_t)h * scale);
+    pointing_device_set_report(report);
+#        else  // POINTING_DEVICE_ENABLE
+    // Keep any held mousekey buttons, but don't repeat pending cursor movement
+    report_mouse_t report = mousekey_get_report();
+    report.x              = 0;
+    report.y              = 0;
+    report.v              = encoder_clamp_wheel(v);
+    report.h              = encoder_clamp_wheel(h);
+    host_mouse_send(&report);
+#        endif // POINTING_DEVICE_ENABLE
+    return true;
+}
+#    endif // defined(ENCODER_MAP_ENABLE) && (defined(POINTING_DEVICE_ENABLE) || defined(MOUSEKEY_ENABLE))
+
+static void encoder_update_velocity(encoder_motion_t *motion, uint16_t detents) {
+    uint16_t now     = timer_read();
+    uint16_t elapsed = TIMER_DIFF_16(now, motion->last_time);
+
+    // Starting from rest counts as if the previous detent happened as long ago as possible
+    if (motion->velocity == 0 || elapsed > ENCODER_VELOCITY_TIMEOUT) {
+        elapsed          = ENCODER_VELOCITY_TIMEOUT;
+        motion->velocity = 0;
+    }
+
+    uint32_t instant  = (uint32_t)detents * 1000 / MAX(elapsed, 1);
+    instant           = MIN(instant, UINT16_MAX);
+    motion->velocity  = motion->velocity == 0 ? instant : (motion->velocity + instant) / 2;
+    motion->last_time = now;
+}
+
+static bool encoder_handle_coalesced(void) {
+    bool changed = false;
+    for (uint8_t index = 0; index < NUM_ENCODERS; ++index) {
+        encoder_motion_t *motion = &encoder_motion[index];
+        int16_t           count;
+        // Detents may be counted from an interrupt, which must not land between reading and clearing the count
+        ATOMIC_BLOCK_FORCEON {
+            count         = motion->count;
+            motion->count = 0;
+        }
+        if (count == 0) {
+            continue;
+        }
+
+        bool     clockwise = count > 0;
+        uint16_t detents   = clockwise ? count : -count;
+        encoder_update_velocity(motion, detents);
+        changed = true;
+
+        if (!encoder_update_coalesced_kb(index, count)) {
+            continue;
+        }
+
+#    ifdef ENCODER_COALESCE_WHEEL
+        keyevent_t event = clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true);
+        if (encoder_send_wheel(get_event_keycode(event, false), detents)) {
+            continue;
+        }
+#    endif // ENCODER_COALESCE_WHEEL
 
+        // Anything else is still actioned once per detent, but no detents are lost to a full queue
+        for (uint16_t i = 0; i < detents; ++i) {
+            encoder_exec_event(index, clockwise);
+        }
+    }
+    return changed;
+}
+
+#endif // ENCODER_COALESCE_EVENTS
+
+static bool encoder_handle_queue(void) {
+    bool    changed = false;
+    uint8_t index;
+    bool    clockwise;
+    while (encoder_dequeue_event(&index, &clockwise)) {
+        encoder_exec_event(index, clockwise);
         changed = true;
     }
+#ifdef ENCODER_COALESCE_EVENTS
+    changed |= encoder_handle_coalesced();
+#endif // ENCODER_COALESCE_EVENTS
     return changed;
 }
 
@@ -133,6 +273,21 @@ bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bo
 }
 
 bool encoder_queue_event(uint8_t index, bool clockwise) {
+#ifdef ENCODER_COALESCE_EVENTS
+    // The half processing encoders accumulates counts instead, other halves queue events for split transport
+    if (should_process_encoder() && index < NUM_ENCODERS) {
+        int16_t *count = &encoder_motion[index].count;
+        // Callable from both interrupts and the main loop, so the previous interrupt state is restored
+        ATOMIC_BLOCK_RESTORESTATE {
+            if (clockwise) {
+                *count = MIN(*count, INT16_MAX - 1) + 1;
+            } else {
+                *count = MAX(*count, INT16_MIN + 1) - 1;
+            }
+        }
+        return true;
+    }
+#endif // ENCODER_COALESCE_EVENTS
     return encoder_queue_event_advanced(&encoder_events, index, clockwise);
 }
 
@@ -148,6 +303,23 @@ void encoder_signal_queue_drain(void) {
     signal_queue_drain = true;
 }
 
+#ifdef ENCODER_COALESCE_EVENTS
+uint16_t encoder_get_velocity(uint8_t index) {
+    if (index >= NUM_ENCODERS || TIMER_DIFF_16(timer_read(), encoder_motion[index].last_time) > ENCODER_VELOCITY_TIMEOUT) {
+        return 0;
+    }
+    return encoder_motion[index].velocity;
+}
+
+__attribute__((weak)) bool encoder_update_coalesced_user(uint8_t index, int16_t count) {
+    return true;
+}
+
+__attribute__((weak)) bool encoder_update_coalesced_kb(uint8_t index, int16_t count) {
+    return encoder_update_coalesced_user(index, count);
+}
+#endif // ENCODER_COALESCE_EVENTS
+
 __attribute__((weak)) bool encoder_update_user(uint8_t index, bool clockwise) {
     return true;
 }
@@ -109,6 +109,20 @@ bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bo
 // Reset the queue to be empty
 void encoder_signal_queue_drain(void);
 
+#    ifdef ENCODER_COALESCE_EVENTS
+// Time after the last detent at which an encoder is considered to be at rest
+#        ifndef ENCODER_VELOCITY_TIMEOUT
+#            define ENCODER_VELOCITY_TIMEOUT 250
+#        endif // ENCODER_VELOCITY_TIMEOUT
+
+// Smoothed rotational speed of an encoder, in detents per second
+uint16_t encoder_get_velocity(uint8_t index);
+
+// Called once per encoder task with all the detents turned since the last call, positive for clockwise
+bool encoder_update_coalesced_kb(uint8_t index, int16_t count);
+bool encoder_update_coalesced_user(uint8_t index, int16_t count);
+#    endif // ENCODER_COALESCE_EVENTS
+
 #    ifdef ENCODER_MAP_ENABLE
 #        define NUM_DIRECTIONS 2
 #        define ENCODER_CCW_CW(ccw, cw) \
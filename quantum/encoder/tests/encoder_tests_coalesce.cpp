@@ -0,0 +1,140 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <vector>
+
+extern "C" {
+#include "encoder.h"
+#include "encoder/tests/mock.h"
+
+void advance_time(uint32_t ms);
+}
+
+struct update {
+    int8_t index;
+    bool   clockwise;
+};
+
+struct coalesced_update {
+    int8_t  index;
+    int16_t count;
+};
+
+std::vector<update>           updates;
+std::vector<coalesced_update> coalesced_updates;
+bool                          coalesced_passthrough = false;
+
+bool encoder_update_kb(uint8_t index, bool clockwise) {
+    updates.push_back({(int8_t)index, clockwise});
+    return true;
+}
+
+bool encoder_update_coalesced_kb(uint8_t index, int16_t count) {
+    coalesced_updates.push_back({(int8_t)index, count});
+    return coalesced_passthrough;
+}
+
+bool setAndRead(pin_t pin, bool val) {
+    setPin(pin, val);
+    return encoder_task();
+}
+
+class EncoderCoalesceTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        updates.clear();
+        coalesced_updates.clear();
+        coalesced_passthrough = false;
+        encoder_init();
+    }
+};
+
+TEST_F(EncoderCoalesceTest, TestOneClockwise) {
+    setAndRead(0, false);
+    setAndRead(1, false);
+    setAndRead(0, true);
+    setAndRead(1, true);
+
+    ASSERT_EQ(coalesced_updates.size(), 1);
+    EXPECT_EQ(coalesced_updates[0].index, 0);
+    EXPECT_EQ(coalesced_updates[0].count, 1);
+    EXPECT_EQ(updates.size(), 0);
+}
+
+TEST_F(EncoderCoalesceTest, TestFastSpinIsOneUpdate) {
+    // Far more detents than the event queue can hold arrive before the task runs
+    for (int i = 0; i < 3 * MAX_QUEUED_ENCODER_EVENTS; ++i) {
+        EXPECT_TRUE(encoder_queue_event(0, true));
+    }
+    EXPECT_TRUE(encoder_task());
+
+    ASSERT_EQ(coalesced_updates.size(), 1);
+    EXPECT_EQ(coalesced_updates[0].count, 3 * MAX_QUEUED_ENCODER_EVENTS);
+
+    // Nothing left over for the next cycle
+    EXPECT_FALSE(encoder_task());
+    EXPECT_EQ(coalesced_updates.size(), 1);
+}
+
+TEST_F(EncoderCoalesceTest, TestDirectionsCancel) {
+    for (int i = 0; i < 5; ++i) {
+        encoder_queue_event(0, true);
+    }
+    for (int i = 0; i < 7; ++i) {
+        encoder_queue_event(0, false);
+    }
+    encoder_task();
+
+    ASSERT_EQ(coalesced_updates.size(), 1);
+    EXPECT_EQ(coalesced_updates[0].count, -2);
+}
+
+TEST_F(EncoderCoalesceTest, TestPassthroughLosesNoDetents) {
+    coalesced_passthrough = true;
+    for (int i = 0; i < 3 * MAX_QUEUED_ENCODER_EVENTS; ++i) {
+        encoder_queue_event(0, false);
+    }
+    encoder_task();
+
+    ASSERT_EQ(coalesced_updates.size(), 1);
+    ASSERT_EQ(updates.size(), 3 * MAX_QUEUED_ENCODER_EVENTS);
+    for (auto &u : updates) {
+        EXPECT_EQ(u.index, 0);
+        EXPECT_EQ(u.clockwise, false);
+    }
+}
+
+TEST_F(EncoderCoalesceTest, TestVelocity) {
+    EXPECT_EQ(encoder_get_velocity(0), 0);
+
+    // A detent every 10ms settles at 100 detents per second
+    for (int i = 0; i < 16; ++i) {
+        advance_time(10);
+        encoder_queue_event(0, true);
+        encoder_task();
+    }
+    EXPECT_GE(encoder_get_velocity(0), 95);
+    EXPECT_LE(encoder_get_velocity(0), 100);
+
+    // Bursts of several detents per cycle count as faster rotation
+    for (int i = 0; i < 16; ++i) {
+        advance_time(10);
+        for (int j = 0; j < 4; ++j) {
+            encoder_queue_event(0, true);
+        }
+        encoder_task();
+    }
+    EXPECT_GE(encoder_get_velocity(0), 390);
+    EXPECT_LE(encoder_get_velocity(0), 400);
+
+    // Coming to rest drops the velocity to zero
+    advance_time(ENCODER_VELOCITY_TIMEOUT + 1);
+    EXPECT_EQ(encoder_get_velocity(0), 0);
+
+    // Starting again from rest is slow
+    encoder_queue_event(0, true);
+    encoder_task();
+    EXPECT_EQ(encoder_get_velocity(0), 1000 / ENCODER_VELOCITY_TIMEOUT);
+}
@@ -0,0 +1,126 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <vector>
+
+extern "C" {
+#include "encoder.h"
+#include "encoder/tests/mock.h"
+}
+
+struct update {
+    int8_t index;
+    bool   clockwise;
+};
+
+std::vector<update> updates;
+bool                hardware_available = true;
+int16_t             hardware_pulses    = 0;
+int                 hardware_reads     = 0;
+
+bool encoder_update_kb(uint8_t index, bool clockwise) {
+    updates.push_back({(int8_t)index, clockwise});
+    return true;
+}
+
+extern "C" bool encoder_quadrature_hardware_init(uint8_t index, pin_t pad_a, pin_t pad_b) {
+    EXPECT_EQ(pad_a, 0);
+    EXPECT_EQ(pad_b, 1);
+    return hardware_available;
+}
+
+extern "C" int16_t encoder_quadrature_hardware_read(uint8_t index) {
+    int16_t pulses  = hardware_pulses;
+    hardware_pulses = 0;
+    hardware_reads++;
+    return pulses;
+}
+
+bool setAndRead(pin_t pin, bool val) {
+    setPin(pin, val);
+    return encoder_task();
+}
+
+class EncoderHardwareTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        updates.clear();
+        hardware_available = true;
+        hardware_pulses    = 0;
+        hardware_reads     = 0;
+    }
+};
+
+TEST_F(EncoderHardwareTest, TestPinsLeftAloneWhenClaimed) {
+    pinIsInputHigh[0] = false;
+    pinIsInputHigh[1] = false;
+    encoder_init();
+    EXPECT_EQ(pinIsInputHigh[0], false);
+    EXPECT_EQ(pinIsInputHigh[1], false);
+}
+
+TEST_F(EncoderHardwareTest, TestOneDetentEachWay) {
+    encoder_init();
+
+    // Same direction convention as the software decoder
+    hardware_pulses = 4;
+    encoder_task();
+    hardware_pulses = -4;
+    encoder_task();
+
+    ASSERT_EQ(updates.size(), 2);
+    EXPECT_EQ(updates[0].clockwise, false);
+    EXPECT_EQ(updates[1].clockwise, true);
+    EXPECT_EQ(hardware_reads, 2);
+}
+
+TEST_F(EncoderHardwareTest, TestPartialDetentsCarryOver) {
+    encoder_init();
+
+    hardware_pulses = 3;
+    encoder_task();
+    EXPECT_EQ(updates.size(), 0);
+
+    hardware_pulses = 2;
+    encoder_task();
+    EXPECT_EQ(updates.size(), 1);
+
+    hardware_pulses = 3;
+    encoder_task();
+    EXPECT_EQ(updates.size(), 2);
+}
+
+TEST_F(EncoderHardwareTest, TestStalledLoopLosesNothing) {
+    encoder_init();
+
+    // A long stall counts far more detents than the event queue can hold
+    hardware_pulses = 4 * 20;
+    encoder_task();
+    EXPECT_GT(updates.size(), 0);
+    EXPECT_LT(updates.size(), 20);
+
+    for (int i = 0; i < 20 && updates.size() < 20; ++i) {
+        encoder_task();
+    }
+    EXPECT_EQ(updates.size(), 20);
+    encoder_task();
+    EXPECT_EQ(updates.size(), 20);
+}
+
+TEST_F(EncoderHardwareTest, TestSoftwareFallback) {
+    hardware_available = false;
+    encoder_init();
+    EXPECT_EQ(pinIsInputHigh[0], true);
+    EXPECT_EQ(pinIsInputHigh[1], true);
+
+    setAndRead(0, false);
+    setAndRead(1, false);
+    setAndRead(0, true);
+    setAndRead(1, true);
+
+    EXPECT_EQ(hardware_reads, 0);
+    ASSERT_EQ(updates.size(), 1);
+    EXPECT_EQ(updates[0].clockwise, true);
+}
@@ -8,6 +8,26 @@ encoder_SRC := \
 	$(QUANTUM_PATH)/encoder/tests/encoder_tests.cpp \
 	$(QUANTUM_PATH)/encoder.c
 
+encoder_coalesce_DEFS := -DENCODER_TESTS -DENCODER_ENABLE -DENCODER_MOCK_SINGLE -DENCODER_COALESCE_EVENTS
+encoder_coalesce_CONFIG := $(QUANTUM_PATH)/encoder/tests/config_mock.h
+
+encoder_coalesce_SRC := \
+	platforms/test/timer.c \
+	drivers/encoder/encoder_quadrature.c \
+	$(QUANTUM_PATH)/encoder/tests/mock.c \
+	$(QUANTUM_PATH)/encoder/tests/encoder_tests_coalesce.cpp \
+	$(QUANTUM_PATH)/encoder.c
+
+encoder_hardware_DEFS := -DENCODER_TESTS -DENCODER_ENABLE -DENCODER_MOCK_SINGLE
+encoder_hardware_CONFIG := $(QUANTUM_PATH)/encoder/tests/config_mock.h
+
+encoder_hardware_SRC := \
+	platforms/test/timer.c \
+	drivers/encoder/encoder_quadrature.c \
+	$(QUANTUM_PATH)/encoder/tests/mock.c \
+	$(QUANTUM_PATH)/encoder/tests/encoder_tests_hardware.cpp \
+	$(QUANTUM_PATH)/encoder.c
+
 encoder_split_left_eq_right_DEFS := -DENCODER_TESTS -DENCODER_ENABLE -DENCODER_MOCK_SPLIT
 encoder_split_left_eq_right_INC := $(QUANTUM_PATH)/split_common
 encoder_split_left_eq_right_CONFIG := $(QUANTUM_PATH)/encoder/tests/config_mock_split_left_eq_right.h
@@ -25,6 +25,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "keycode.h"
 #include "timer.h"
 #include "sync_timer.h"
+#include "deadline.h"
 #include "print.h"
 #include "debug.h"
 #include "command.h"
@@ -149,6 +150,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef CONNECTION_ENABLE
 #    include "connection.h"
 #endif
+#ifdef I2C_SCHEDULER_ENABLE
+#    include "i2c_master.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -565,14 +569,17 @@ void switch_events(uint8_t row, uint8_t col, bool pressed) {
 
 /**
  * @brief Generates a tick event at a maximum rate of 1KHz that drives the
- * internal QMK state machine.
+ * internal QMK state machine, but only once the tapping or one shot state has
+ * a deadline that has been reached.
  */
 static inline void generate_tick_event(void) {
     static uint16_t last_tick = 0;
     const uint16_t  now       = timer_read();
     if (TIMER_DIFF_16(now, last_tick) != 0) {
-        action_exec(MAKE_TICK_EVENT);
         last_tick = now;
+        if (deadline_expired(DEADLINE_TAPPING) || deadline_expired(DEADLINE_ONESHOT)) {
+            action_exec(MAKE_TICK_EVENT);
+        }
     }
 }
 
@@ -715,6 +722,10 @@ void quantum_task(void) {
 #ifdef LAYER_LOCK_ENABLE
     layer_lock_task();
 #endif
+
+#if defined(UNICODE_COMMON_ENABLE) && defined(UNICODE_QUEUE_SIZE)
+    unicode_task();
+#endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
@@ -807,6 +818,10 @@ void keyboard_task(void) {
     haptic_task();
 #endif
 
+#ifdef I2C_SCHEDULER_ENABLE
+    i2c_scheduler_task();
+#endif
+
     led_task();
 
 #ifdef OS_DETECTION_ENABLE
@@ -175,6 +175,14 @@ __attribute__((weak)) const key_override_t* key_override_get(uint16_t key_overri
     return key_override_get_raw(key_override_idx);
 }
 
+#    if !defined(KEY_OVERRIDE_NO_INDEX)
+static uint8_t key_override_index[ARRAY_SIZE(key_overrides)];
+
+uint8_t* key_override_index_raw(void) {
+    return key_override_index;
+}
+#    endif // !defined(KEY_OVERRIDE_NO_INDEX)
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,4 +108,9 @@ const key_override_t* key_override_get_raw(uint16_t key_override_idx);
 // Get the key override definitions, potentially stored dynamically
 const key_override_t* key_override_get(uint16_t key_override_idx);
 
+#    if !defined(KEY_OVERRIDE_NO_INDEX)
+// Get the storage for the key override lookup index, holding key_override_count_raw() entries
+uint8_t* key_override_index_raw(void);
+#    endif // !defined(KEY_OVERRIDE_NO_INDEX)
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
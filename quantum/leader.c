@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "leader.h"
+#include "deadline.h"
 #include "timer.h"
 #include "util.h"
 
@@ -17,6 +18,19 @@ uint16_t leader_time          = 0;
 uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
 uint8_t  leader_sequence_size = 0;
 
+// Schedules leader_task() for the moment the sequence times out
+static void leader_schedule_deadline(void) {
+#if defined(LEADER_NO_TIMEOUT)
+    if (leading && leader_sequence_size > 0) {
+#else
+    if (leading) {
+#endif
+        deadline_set(DEADLINE_LEADER, leader_time + LEADER_TIMEOUT + 1);
+    } else {
+        deadline_clear(DEADLINE_LEADER);
+    }
+}
+
 __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
@@ -34,16 +48,24 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+    leader_schedule_deadline();
 }
 
 void leader_end(void) {
     leading = false;
+    leader_schedule_deadline();
     leader_end_user();
 }
 
 void leader_task(void) {
+    if (!deadline_expired(DEADLINE_LEADER)) {
+        return;
+    }
+
     if (leader_sequence_active() && leader_sequence_timed_out()) {
         leader_end();
+    } else {
+        leader_schedule_deadline();
     }
 }
 
@@ -64,6 +86,7 @@ bool leader_sequence_add(uint16_t keycode) {
 
     leader_sequence[leader_sequence_size] = keycode;
     leader_sequence_size++;
+    leader_schedule_deadline();
 
     if (leader_add_user(keycode)) {
         leader_end();
@@ -81,6 +104,7 @@ bool leader_sequence_timed_out(void) {
 
 void leader_reset_timer(void) {
     leader_time = timer_read();
+    leader_schedule_deadline();
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
@@ -49,7 +49,10 @@ void print_set_sendchar(sendchar_func_t func);
     } while (0)
 
 #ifndef NO_PRINT
-#    if __has_include_next("_print.h")
+#    if defined(TOKENIZED_PRINT_ENABLE)
+#        include "print_tokenized.h"
+#        define xprintf(format, ...) print_tokenized(PSTR(format), ##__VA_ARGS__)
+#    elif __has_include_next("_print.h")
 #        include_next "_print.h" /* Include the platforms print.h */
 #    else
 #        include "printf.h" // // Fall back to lib/printf/printf.h
@@ -0,0 +1,124 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "print_tokenized.h"
+#include "progmem.h"
+
+#if defined(__AVR__)
+#    include "avr/xprintf.h"
+#    define print_tokenized_putc(c) xputc(c)
+#else
+#    include "printf.h"
+#    define print_tokenized_putc(c) putchar_(c)
+#endif
+
+static void print_tokenized_put_varint(uint32_t value) {
+    // Offset by one so that no byte is ever zero, carrying into an extra group if that wraps around
+    uint32_t biased = value + 1;
+    bool     carry  = biased == 0;
+
+    while (true) {
+        uint8_t group = biased & 0x7F;
+        biased >>= 7;
+        if (carry) {
+            biased |= (uint32_t)1 << 25;
+            carry = false;
+        }
+        if (biased == 0) {
+            print_tokenized_putc(group);
+            return;
+        }
+        print_tokenized_putc(group | 0x80);
+    }
+}
+
+static void print_tokenized_put_signed(int32_t value) {
+    print_tokenized_put_varint(((uint32_t)value << 1) ^ (uint32_t)(value >> 31));
+}
+
+static void print_tokenized_put_string(const char *string, bool progmem) {
+    if (!string) {
+        print_tokenized_put_varint(0);
+        return;
+    }
+
+    size_t length = 0;
+    while ((progmem ? pgm_read_byte(&string[length]) : string[length]) != '\0') {
+        length++;
+    }
+
+    print_tokenized_put_varint(length);
+    for (size_t i = 0; i < length; i++) {
+        print_tokenized_putc(progmem ? pgm_read_byte(&string[i]) : string[i]);
+    }
+}
+
+void print_tokenized(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+
+    print_tokenized_putc(PRINT_TOKENIZED_MARKER);
+    print_tokenized_put_varint((uintptr_t)format);
+
+    // Only the arguments are sent, so the format string just needs walking far enough to know their types
+    char c;
+    while ((c = pgm_read_byte(format++)) != '\0') {
+        if (c != '%') {
+            continue;
+        }
+
+        // Skip over flags, width, precision and length up to the conversion itself
+        bool is_long   = false;
+        bool is_size_t = false;
+        while (true) {
+            c = pgm_read_byte(format++);
+            if (c == '*') {
+                // Width or precision taken from an argument
+                print_tokenized_put_signed(va_arg(args, int));
+            } else if (c == 'l') {
+                is_long = true;
+            } else if (c == 'z') {
+                is_size_t = true;
+            } else if (!(c == '-' || c == '+' || c == ' ' || c == '#' || c == '.' || c == 'h' || (c >= '0' && c <= '9'))) {
+                break;
+            }
+        }
+
+        switch (c) {
+            case 'd':
+            case 'i':
+                print_tokenized_put_signed(is_long ? va_arg(args, long) : is_size_t ? (int32_t)va_arg(args, size_t) : va_arg(args, int));
+                break;
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+            case 'b':
+                print_tokenized_put_varint(is_long ? va_arg(args, unsigned long) : is_size_t ? va_arg(args, size_t) : va_arg(args, unsigned int));
+                break;
+            case 'c':
+                print_tokenized_put_varint((uint8_t)va_arg(args, int));
+                break;
+            case 'p':
+                print_tokenized_put_varint((uintptr_t)va_arg(args, void *));
+                break;
+            case 's':
+            case 'S':
+                // %S is a string in program memory
+                print_tokenized_put_string(va_arg(args, const char *), c == 'S');
+                break;
+            case '\0':
+                va_end(args);
+                return;
+            default:
+                // %% and unsupported conversions take no argument
+                break;
+        }
+    }
+
+    va_end(args);
+}
@@ -0,0 +1,26 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/*
+ * Tokenized printing
+ *
+ * Rather than formatting text on the keyboard, each print sends a compact record holding the address of its format
+ * string and the raw values of its arguments, leaving `qmk console-decode` to look the format string up in the
+ * firmware's ELF file and produce the text on the host.
+ *
+ * A record is PRINT_TOKENIZED_MARKER, which never appears in UTF-8 text, followed by the format string address and
+ * then each argument in the order the format string consumes them. Numbers are sent as LEB128 varints of the value
+ * plus one, with signed values zigzag encoded first, and strings as their length followed by their bytes. Records
+ * therefore never contain a zero byte, so any zero padding the console endpoint adds can simply be dropped.
+ */
+
+#define PRINT_TOKENIZED_MARKER 0xFF
+
+/**
+ * @brief Sends a tokenized record for a printf style format string and its arguments
+ *
+ * @param[in] format format string, which must be a literal so that the host can find it in the firmware
+ */
+void print_tokenized(const char *format, ...);
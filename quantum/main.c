@@ -53,6 +53,8 @@ int main(void) {
 #ifdef RAW_ENABLE
         void raw_hid_task(void);
         raw_hid_task();
+        void raw_hid_stream_task(void);
+        raw_hid_stream_task();
 #endif
 
 #ifdef CONSOLE_ENABLE
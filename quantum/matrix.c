@@ -133,6 +133,307 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     current_matrix[current_row] = current_row_value;
 }
 
+#elif defined(MATRIX_IO_EXPANDER) || defined(MATRIX_SHIFT_REGISTER)
+/*
+ * One side of the matrix (the rows for COL2ROW, the cols for ROW2COL) is selected through an I/O expander or a chain of
+ * 74HC595 shift registers. Each read both samples the line selected by the previous read and selects the next one, so
+ * that switching lines never needs a transaction of its own. The first line stays selected between scans.
+ *
+ * A chain of 74HC165 shift registers works the other way around: the lines are selected from MCU pins as usual, and the
+ * other side of the matrix is read through the chain.
+ */
+#    if (DIODE_DIRECTION == COL2ROW)
+#        define MATRIX_SELECT_LINES ROWS_PER_HAND
+#        define MATRIX_INPUT_LINES MATRIX_COLS
+#    elif (DIODE_DIRECTION == ROW2COL)
+#        define MATRIX_SELECT_LINES MATRIX_COLS
+#        define MATRIX_INPUT_LINES ROWS_PER_HAND
+#    else
+#        error DIODE_DIRECTION must be one of COL2ROW or ROW2COL!
+#    endif
+
+#    if defined(MATRIX_IO_EXPANDER)
+#        if defined(MATRIX_IO_EXPANDER_MCP23018)
+#            if MATRIX_INPUT_PRESSED_STATE
+#                error The MCP23018 outputs are open-drain and cannot drive a line high, MATRIX_INPUT_PRESSED_STATE must be 0
+#            endif
+#            include "mcp23018.h"
+#            define matrix_expander_init mcp23018_init
+#            define matrix_expander_set_config mcp23018_set_config
+#            define matrix_expander_set_output_all mcp23018_set_output_all
+#            define matrix_expander_read_pins_all mcp23018_read_pins_all
+#        elif defined(MATRIX_IO_EXPANDER_PCA9555)
+#            include "pca9555.h"
+#            define matrix_expander_init pca9555_init
+#            define matrix_expander_set_config pca9555_set_config
+#            define matrix_expander_set_output_all pca9555_set_output_all
+#            define matrix_expander_read_pins_all pca9555_read_pins_all
+#        else
+#            error Unsupported MATRIX_IO_EXPANDER
+#        endif
+#        include "timer.h"
+
+#        ifndef MATRIX_IO_EXPANDER_ADDRESS
+#            error MATRIX_IO_EXPANDER_ADDRESS is not defined!
+#        endif
+#        if !defined(MATRIX_IO_EXPANDER_ROW_PINS) || !defined(MATRIX_IO_EXPANDER_COL_PINS)
+#            error MATRIX_IO_EXPANDER_ROW_PINS and MATRIX_IO_EXPANDER_COL_PINS must both be defined!
+#        endif
+#        ifndef MATRIX_IO_EXPANDER_RETRY_INTERVAL
+#            define MATRIX_IO_EXPANDER_RETRY_INTERVAL 1000
+#        endif
+
+// Expander pins are numbered 0-15, with the first port's pins being 0-7
+static const uint8_t expander_row_pins[ROWS_PER_HAND] = MATRIX_IO_EXPANDER_ROW_PINS;
+static const uint8_t expander_col_pins[MATRIX_COLS]   = MATRIX_IO_EXPANDER_COL_PINS;
+#        if (DIODE_DIRECTION == COL2ROW)
+#            define expander_select_pins expander_row_pins
+#            define expander_input_pins expander_col_pins
+#        else
+#            define expander_select_pins expander_col_pins
+#            define expander_input_pins expander_row_pins
+#        endif
+
+static bool     expander_connected   = false;
+static uint16_t expander_retry_timer = 0;
+
+static bool expander_select(uint8_t line) {
+    uint16_t selected = 1 << expander_select_pins[line];
+    uint16_t output   = MATRIX_INPUT_PRESSED_STATE ? selected : ~selected;
+    return matrix_expander_set_output_all(MATRIX_IO_EXPANDER_ADDRESS, output & 0xFF, output >> 8);
+}
+
+static bool expander_configure(void) {
+    uint16_t outputs = 0;
+    for (uint8_t i = 0; i < MATRIX_SELECT_LINES; i++) {
+        outputs |= 1 << expander_select_pins[i];
+    }
+
+    // Everything other than the select lines is an input, with pull-ups where the expander has them
+    uint16_t config = ~outputs;
+    return matrix_expander_set_config(MATRIX_IO_EXPANDER_ADDRESS, 0, config & 0xFF) && matrix_expander_set_config(MATRIX_IO_EXPANDER_ADDRESS, 1, config >> 8) && expander_select(0);
+}
+
+/* Reads every input line while the given line is selected, then selects the next one.
+ *
+ * A burst read fetches both ports at once and a single write moves the selection along, leaving two I2C transactions
+ * per line no matter how the lines are spread over the ports. Any failure marks the expander disconnected, and all
+ * of its keys read as released until it has been reconfigured.
+ */
+static uint32_t expander_read_line(uint8_t line) {
+    if (!expander_connected) {
+        if (line != 0 || timer_elapsed(expander_retry_timer) < MATRIX_IO_EXPANDER_RETRY_INTERVAL) {
+            return 0;
+        }
+        expander_retry_timer = timer_read();
+        expander_connected   = expander_configure();
+        if (!expander_connected) {
+            return 0;
+        }
+    }
+
+    uint16_t pins = 0;
+    if (!matrix_expander_read_pins_all(MATRIX_IO_EXPANDER_ADDRESS, &pins) || !expander_select((line + 1) % MATRIX_SELECT_LINES)) {
+        expander_connected   = false;
+        expander_retry_timer = timer_read();
+        return 0;
+    }
+
+    uint32_t inputs = 0;
+    for (uint8_t i = 0; i < MATRIX_INPUT_LINES; i++) {
+        if (((pins >> expander_input_pins[i]) & 1) == MATRIX_INPUT_PRESSED_STATE) {
+            inputs |= (uint32_t)1 << i;
+        }
+    }
+    return inputs;
+}
+
+__attribute__((weak)) void matrix_init_pins(void) {
+    matrix_expander_init(MATRIX_IO_EXPANDER_ADDRESS);
+    expander_retry_timer = timer_read();
+    expander_connected   = expander_configure();
+}
+
+#        define matrix_read_line expander_read_line
+#    elif defined(MATRIX_SHIFT_REGISTER)
+#        if defined(MATRIX_SHIFT_REGISTER_74HC595) || defined(MATRIX_SHIFT_REGISTER_74HC165)
+#            include "spi_master.h"
+#        else
+#            error Unsupported MATRIX_SHIFT_REGISTER
+#        endif
+
+#        ifndef MATRIX_SHIFT_REGISTER_LATCH_PIN
+#            error MATRIX_SHIFT_REGISTER_LATCH_PIN is not defined!
+#        endif
+#        ifndef MATRIX_SHIFT_REGISTER_COUNT
+#            define MATRIX_SHIFT_REGISTER_COUNT 1
+#        endif
+#        ifndef MATRIX_SHIFT_REGISTER_DIVISOR
+#            define MATRIX_SHIFT_REGISTER_DIVISOR 8
+#        endif
+#        ifndef MATRIX_SHIFT_REGISTER_SPI_MODE
+#            define MATRIX_SHIFT_REGISTER_SPI_MODE 0
+#        endif
+
+#        if defined(MATRIX_SHIFT_REGISTER_74HC595)
+#            if (MATRIX_SELECT_LINES > MATRIX_SHIFT_REGISTER_COUNT * 8)
+#                error MATRIX_SHIFT_REGISTER_COUNT is too small for the number of lines to select
+#            endif
+
+// The other side of the matrix is read directly from MCU pins
+#            if (DIODE_DIRECTION == COL2ROW)
+#                define shift_register_input_pins col_pins
+#            else
+#                define shift_register_input_pins row_pins
+#            endif
+
+// Must remain untouched while a transfer is in progress
+static uint8_t shift_register_buffer[MATRIX_SHIFT_REGISTER_COUNT];
+
+/* Line n is output n of the chain, counting from the first output of the register closest to the MCU. The latch pin
+ * is used as the SPI chip select, so the new outputs only appear on its rising edge once the transfer completes.
+ */
+static bool shift_register_select_start(uint8_t line) {
+    memset(shift_register_buffer, MATRIX_INPUT_PRESSED_STATE ? 0x00 : 0xFF, sizeof(shift_register_buffer));
+    shift_register_buffer[MATRIX_SHIFT_REGISTER_COUNT - 1 - line / 8] ^= 1 << (line % 8);
+
+    if (!spi_start(MATRIX_SHIFT_REGISTER_LATCH_PIN, false, MATRIX_SHIFT_REGISTER_SPI_MODE, MATRIX_SHIFT_REGISTER_DIVISOR)) {
+        return false;
+    }
+    spi_transmit_async(shift_register_buffer, sizeof(shift_register_buffer));
+    return true;
+}
+
+/* Reads every input line while the given line is selected, then selects the next one.
+ *
+ * The next selection is shifted out in the background while the inputs are being read, and the outputs are then
+ * latched all at once, so each line costs a single SPI transfer which mostly overlaps the reads.
+ */
+static uint32_t shift_register_read_line(uint8_t line) {
+    matrix_output_select_delay();
+
+    bool started = shift_register_select_start((line + 1) % MATRIX_SELECT_LINES);
+
+    uint32_t inputs = 0;
+    for (uint8_t i = 0; i < MATRIX_INPUT_LINES; i++) {
+        inputs |= readMatrixPin(shift_register_input_pins[i]) ? 0 : (uint32_t)1 << i;
+    }
+
+    if (started) {
+        spi_stop();
+    }
+    matrix_output_unselect_delay(line, inputs != 0);
+    return inputs;
+}
+
+__attribute__((weak)) void matrix_init_pins(void) {
+    for (uint8_t x = 0; x < MATRIX_INPUT_LINES; x++) {
+        if (shift_register_input_pins[x] != NO_PIN) {
+            gpio_atomic_set_pin_input_high(shift_register_input_pins[x]);
+        }
+    }
+
+    spi_init();
+    if (shift_register_select_start(0)) {
+        spi_stop();
+    }
+}
+
+#        else
+#            ifndef MATRIX_SHIFT_REGISTER_CS_PIN
+#                error MATRIX_SHIFT_REGISTER_CS_PIN is not defined!
+#            endif
+#            if (MATRIX_INPUT_LINES > MATRIX_SHIFT_REGISTER_COUNT * 8)
+#                error MATRIX_SHIFT_REGISTER_COUNT is too small for the number of lines to read
+#            endif
+
+// The other side of the matrix is selected directly from MCU pins
+#            if (DIODE_DIRECTION == COL2ROW)
+#                define shift_register_select_pins row_pins
+#            else
+#                define shift_register_select_pins col_pins
+#            endif
+
+static void shift_register_unselect(uint8_t line) {
+    pin_t pin = shift_register_select_pins[line];
+    if (pin != NO_PIN) {
+#            ifdef MATRIX_UNSELECT_DRIVE_HIGH
+        gpio_atomic_set_pin_output_high(pin);
+#            else
+        gpio_atomic_set_pin_input_high(pin);
+#            endif
+    }
+}
+
+/* Reads every input line while the given line is selected.
+ *
+ * Pulsing the latch pin (`SH/LD`) low loads all of the inputs into the chain at once, so the line can be unselected
+ * straight away and settle while the chain is clocked out over SPI, with the chip select pin driving the registers'
+ * clock enable (`CE`). Line n is input n of the chain, counting from input A of the register closest to the MCU, and
+ * arrives as bit n % 8 of byte n / 8.
+ */
+static uint32_t shift_register_read_line(uint8_t line) {
+    pin_t pin = shift_register_select_pins[line];
+    if (pin == NO_PIN) {
+        return 0;
+    }
+    gpio_atomic_set_pin_output_low(pin);
+    matrix_output_select_delay();
+
+    gpio_write_pin_low(MATRIX_SHIFT_REGISTER_LATCH_PIN);
+    gpio_write_pin_high(MATRIX_SHIFT_REGISTER_LATCH_PIN);
+    shift_register_unselect(line);
+
+    uint8_t buffer[MATRIX_SHIFT_REGISTER_COUNT];
+    bool    received = false;
+    if (spi_start(MATRIX_SHIFT_REGISTER_CS_PIN, false, MATRIX_SHIFT_REGISTER_SPI_MODE, MATRIX_SHIFT_REGISTER_DIVISOR)) {
+        received = spi_receive(buffer, sizeof(buffer)) == SPI_STATUS_SUCCESS;
+        spi_stop();
+    }
+
+    // A failed transfer reads as every key released
+    uint32_t inputs = 0;
+    for (uint8_t i = 0; received && i < MATRIX_INPUT_LINES; i++) {
+        if (((buffer[i / 8] >> (i % 8)) & 1) == MATRIX_INPUT_PRESSED_STATE) {
+            inputs |= (uint32_t)1 << i;
+        }
+    }
+
+    matrix_output_unselect_delay(line, inputs != 0);
+    return inputs;
+}
+
+__attribute__((weak)) void matrix_init_pins(void) {
+    for (uint8_t x = 0; x < MATRIX_SELECT_LINES; x++) {
+        shift_register_unselect(x);
+    }
+
+    gpio_set_pin_output(MATRIX_SHIFT_REGISTER_LATCH_PIN);
+    gpio_write_pin_high(MATRIX_SHIFT_REGISTER_LATCH_PIN);
+    spi_init();
+}
+#        endif
+
+#        define matrix_read_line shift_register_read_line
+#    endif
+
+#    if (DIODE_DIRECTION == COL2ROW)
+__attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
+    current_matrix[current_row] = matrix_read_line(current_row);
+}
+#    else
+__attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[], uint8_t current_col, matrix_row_t row_shifter) {
+    uint32_t rows = matrix_read_line(current_col);
+    for (uint8_t row_index = 0; row_index < ROWS_PER_HAND; row_index++) {
+        if (rows & ((uint32_t)1 << row_index)) {
+            current_matrix[row_index] |= row_shifter;
+        } else {
+            current_matrix[row_index] &= ~row_shifter;
+        }
+    }
+}
+#    endif
+
 #elif defined(DIODE_DIRECTION)
 #    if defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
 #        if (DIODE_DIRECTION == COL2ROW)
@@ -323,6 +624,10 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 uint8_t matrix_scan(void) {
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
+#ifdef SPLIT_KEYBOARD
+    matrix_pre_scan();
+#endif
+
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
     // Set row, read cols
     for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
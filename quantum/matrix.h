@@ -76,6 +76,7 @@ void matrix_init_user(void);
 void matrix_scan_user(void);
 
 #ifdef SPLIT_KEYBOARD
+void matrix_pre_scan(void);
 bool matrix_post_scan(void);
 void matrix_slave_scan_kb(void);
 void matrix_slave_scan_user(void);
@@ -92,6 +92,14 @@ void matrix_print(void) {
 }
 
 #ifdef SPLIT_KEYBOARD
+void matrix_pre_scan(void) {
+    // Lets the exchange with the other half overlap with scanning this one, where the transport supports it. The other
+    // half then gets this half's matrix from the previous scan.
+    if (is_keyboard_master()) {
+        transport_master_start_if_connected(matrix + thisHand);
+    }
+}
+
 bool matrix_post_scan(void) {
     bool changed = false;
     if (is_keyboard_master()) {
@@ -166,6 +174,10 @@ __attribute__((weak)) void matrix_init(void) {
 }
 
 __attribute__((weak)) uint8_t matrix_scan(void) {
+#ifdef SPLIT_KEYBOARD
+    matrix_pre_scan();
+#endif
+
     bool changed = matrix_scan_custom(raw_matrix);
 
 #ifdef SPLIT_KEYBOARD
@@ -0,0 +1,122 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "midi_tx_queue.h"
+#include "compiler_support.h"
+
+STATIC_ASSERT(MIDI_TX_QUEUE_SIZE >= MIDI_TX_BATCH_SIZE && MIDI_TX_QUEUE_SIZE <= 255, "MIDI_TX_QUEUE_SIZE must be between 16 and 255");
+
+#define CIN_NOTE_OFF 0x08
+#define CIN_PITCH_BEND 0x0E
+#define CIN_CONTROL_CHANGE 0x0B
+
+static midi_tx_packet_t queue[MIDI_TX_QUEUE_SIZE];
+static uint8_t          queue_start  = 0;
+static uint8_t          queue_length = 0;
+
+static midi_tx_packet_t *queue_at(uint8_t index) {
+    uint16_t position = queue_start + index;
+    if (position >= MIDI_TX_QUEUE_SIZE) {
+        position -= MIDI_TX_QUEUE_SIZE;
+    }
+    return &queue[position];
+}
+
+static bool is_channel_message(const midi_tx_packet_t *packet) {
+    uint8_t cin = packet->event & 0x0F;
+    return cin >= CIN_NOTE_OFF && cin <= CIN_PITCH_BEND;
+}
+
+/**
+ * Whether only the latest value of this Control Change matters. Data entry and the RPN/NRPN selectors apply to
+ * whichever parameter was selected at the time, and channel mode messages are commands, so all of those are sent as
+ * they are.
+ */
+static bool is_coalescable(const midi_tx_packet_t *packet) {
+    if ((packet->event & 0x0F) != CIN_CONTROL_CHANGE) {
+        return false;
+    }
+
+    uint8_t controller = packet->data[1];
+    if (controller == 6 || controller == 38 || (controller >= 96 && controller <= 101) || controller >= 120) {
+        return false;
+    }
+
+    return true;
+}
+
+static bool coalesce(const midi_tx_packet_t *packet) {
+    if (!is_coalescable(packet)) {
+        return false;
+    }
+
+    uint8_t cable      = packet->event >> 4;
+    uint8_t channel    = packet->data[0] & 0x0F;
+    uint8_t controller = packet->data[1];
+
+    // Walk back from the newest packet, giving up at anything the new value must not overtake. The updated value does
+    // move ahead of any Control Changes for other controllers on the same channel queued since, as those controllers
+    // are independent, with the exception of the other half of a 14-bit controller.
+    for (uint8_t i = queue_length; i-- > 0;) {
+        midi_tx_packet_t *queued = queue_at(i);
+
+        if ((queued->event >> 4) != cable) {
+            continue;
+        }
+        if (!is_channel_message(queued)) {
+            return false;
+        }
+        if ((queued->data[0] & 0x0F) != channel) {
+            continue;
+        }
+        if ((queued->event & 0x0F) != CIN_CONTROL_CHANGE) {
+            return false;
+        }
+        if (queued->data[1] == controller) {
+            queued->data[2] = packet->data[2];
+            return true;
+        }
+        // The other half of a 14-bit controller
+        if (controller < 64 && queued->data[1] == (controller ^ 0x20)) {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+bool midi_tx_queue_push(const midi_tx_packet_t *packet) {
+    if (coalesce(packet)) {
+        return true;
+    }
+
+    if (queue_length == MIDI_TX_QUEUE_SIZE) {
+        return false;
+    }
+
+    *queue_at(queue_length++) = *packet;
+    return true;
+}
+
+uint8_t midi_tx_queue_pop(midi_tx_packet_t *packets, uint8_t count) {
+    if (count > queue_length) {
+        count = queue_length;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        packets[i] = *queue_at(i);
+    }
+
+    queue_start = queue_at(count) - queue;
+    queue_length -= count;
+    return count;
+}
+
+uint8_t midi_tx_queue_length(void) {
+    return queue_length;
+}
+
+void midi_tx_queue_clear(void) {
+    queue_start  = 0;
+    queue_length = 0;
+}
@@ -0,0 +1,52 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * MIDI transmit queue
+ *
+ * Outgoing USB-MIDI event packets are queued rather than written to the endpoint one by one, and drained from the
+ * main loop in batches that fill a whole bulk transfer. A Control Change that is still queued when the same
+ * controller is changed again is updated in place, so a fast encoder costs one packet per drain rather than one per
+ * detent. The update may therefore reach the host ahead of Control Changes for other controllers on the same channel
+ * which were queued after the original, but never ahead of any other message on that channel, of a system message on
+ * the same cable, or of the other half of a 14-bit controller.
+ */
+
+#ifndef MIDI_TX_QUEUE_SIZE
+#    define MIDI_TX_QUEUE_SIZE 32
+#endif
+
+// Event packets per bulk transfer, 64 bytes at full-speed
+#define MIDI_TX_BATCH_SIZE 16
+
+/**
+ * @brief A USB-MIDI event packet, laid out as LUFA's MIDI_EventPacket_t
+ */
+typedef struct {
+    uint8_t event; // cable number in the high nibble, code index number in the low nibble
+    uint8_t data[3];
+} midi_tx_packet_t;
+
+/**
+ * @brief Adds a packet to the queue, or updates a queued Control Change for the same controller
+ *
+ * @return false if the queue is full and the packet was not added
+ */
+bool midi_tx_queue_push(const midi_tx_packet_t *packet);
+
+/**
+ * @brief Removes up to count of the oldest packets from the queue
+ *
+ * @param[out] packets buffer receiving the packets, in order
+ * @return the number of packets removed
+ */
+uint8_t midi_tx_queue_pop(midi_tx_packet_t *packets, uint8_t count);
+
+uint8_t midi_tx_queue_length(void);
+
+void midi_tx_queue_clear(void);
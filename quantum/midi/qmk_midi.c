@@ -2,6 +2,8 @@
 #include "qmk_midi.h"
 #include "sysex_tools.h"
 #include "midi.h"
+#include "midi_tx_queue.h"
+#include "compiler_support.h"
 #include "usb_descriptor.h"
 #include "process_midi.h"
 
@@ -25,11 +27,23 @@ MidiDevice midi_device;
 #define SYS_COMMON_2 0x20
 #define SYS_COMMON_3 0x30
 
+STATIC_ASSERT(sizeof(midi_tx_packet_t) == sizeof(MIDI_EventPacket_t), "MIDI queue packets must match USB-MIDI event packets");
+STATIC_ASSERT(MIDI_TX_BATCH_SIZE * sizeof(MIDI_EventPacket_t) <= MIDI_STREAM_EPSIZE, "MIDI batches must fit in a single transfer");
+
+void midi_tx_task(void) {
+    midi_tx_packet_t packets[MIDI_TX_BATCH_SIZE];
+    uint8_t          count;
+
+    while ((count = midi_tx_queue_pop(packets, MIDI_TX_BATCH_SIZE)) > 0) {
+        send_midi_packets((MIDI_EventPacket_t*)packets, count);
+    }
+}
+
 static void usb_send_func(MidiDevice* device, uint16_t cnt, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
-    MIDI_EventPacket_t event;
-    event.Data1 = byte0;
-    event.Data2 = byte1;
-    event.Data3 = byte2;
+    midi_tx_packet_t event;
+    event.data[0] = byte0;
+    event.data[1] = byte1;
+    event.data[2] = byte2;
 
     uint8_t cable = 0;
 
@@ -38,21 +52,21 @@ static void usb_send_func(MidiDevice* device, uint16_t cnt, uint8_t byte0, uint8
         switch (cnt) {
             case 3:
                 if (byte2 == SYSEX_END)
-                    event.Event = MIDI_EVENT(cable, SYSEX_ENDS_IN_3);
+                    event.event = MIDI_EVENT(cable, SYSEX_ENDS_IN_3);
                 else
-                    event.Event = MIDI_EVENT(cable, SYSEX_START_OR_CONT);
+                    event.event = MIDI_EVENT(cable, SYSEX_START_OR_CONT);
                 break;
             case 2:
                 if (byte1 == SYSEX_END)
-                    event.Event = MIDI_EVENT(cable, SYSEX_ENDS_IN_2);
+                    event.event = MIDI_EVENT(cable, SYSEX_ENDS_IN_2);
                 else
-                    event.Event = MIDI_EVENT(cable, SYSEX_START_OR_CONT);
+                    event.event = MIDI_EVENT(cable, SYSEX_START_OR_CONT);
                 break;
             case 1:
                 if (byte0 == SYSEX_END)
-                    event.Event = MIDI_EVENT(cable, SYSEX_ENDS_IN_1);
+                    event.event = MIDI_EVENT(cable, SYSEX_ENDS_IN_1);
                 else
-                    event.Event = MIDI_EVENT(cable, SYSEX_START_OR_CONT);
+                    event.event = MIDI_EVENT(cable, SYSEX_START_OR_CONT);
                 break;
             default:
                 return; // invalid cnt
@@ -62,19 +76,22 @@ static void usb_send_func(MidiDevice* device, uint16_t cnt, uint8_t byte0, uint8
         // TODO are there any more?
         switch (byte0 & 0xF0) {
             case MIDI_SONGPOSITION:
-                event.Event = MIDI_EVENT(cable, SYS_COMMON_3);
+                event.event = MIDI_EVENT(cable, SYS_COMMON_3);
                 break;
             case MIDI_SONGSELECT:
             case MIDI_TC_QUARTERFRAME:
-                event.Event = MIDI_EVENT(cable, SYS_COMMON_2);
+                event.event = MIDI_EVENT(cable, SYS_COMMON_2);
                 break;
             default:
-                event.Event = MIDI_EVENT(cable, byte0);
+                event.event = MIDI_EVENT(cable, byte0);
                 break;
         }
     }
 
-    send_midi_packet(&event);
+    // Only block on the endpoint once more has been sent than the queue can hold
+    while (!midi_tx_queue_push(&event)) {
+        midi_tx_task();
+    }
 }
 
 static void usb_get_midi(MidiDevice* device) {
@@ -5,6 +5,7 @@
 #    include <LUFA/Drivers/USB/USB.h>
 extern MidiDevice midi_device;
 void              setup_midi(void);
-void              send_midi_packet(MIDI_EventPacket_t* event);
+void              midi_tx_task(void);
+void              send_midi_packets(MIDI_EventPacket_t* events, uint8_t count);
 bool              recv_midi_packet(MIDI_EventPacket_t* const event);
 #endif
@@ -0,0 +1,148 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+extern "C" {
+#include "midi/midi_tx_queue.h"
+}
+
+static midi_tx_packet_t note_on(uint8_t channel, uint8_t note) {
+    return {.event = 0x09, .data = {(uint8_t)(0x90 | channel), note, 127}};
+}
+
+static midi_tx_packet_t cc(uint8_t channel, uint8_t controller, uint8_t value, uint8_t cable = 0) {
+    return {.event = (uint8_t)(cable << 4 | 0x0B), .data = {(uint8_t)(0xB0 | channel), controller, value}};
+}
+
+class MidiTxQueue : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        midi_tx_queue_clear();
+    }
+
+    void push(const midi_tx_packet_t &packet) {
+        ASSERT_TRUE(midi_tx_queue_push(&packet));
+    }
+
+    std::vector<std::vector<uint8_t>> drain() {
+        std::vector<std::vector<uint8_t>> packets;
+        midi_tx_packet_t                  transfer[MIDI_TX_BATCH_SIZE];
+        uint8_t                           count;
+        while ((count = midi_tx_queue_pop(transfer, MIDI_TX_BATCH_SIZE)) > 0) {
+            for (uint8_t i = 0; i < count; i++) {
+                packets.push_back({transfer[i].event, transfer[i].data[0], transfer[i].data[1], transfer[i].data[2]});
+            }
+        }
+        return packets;
+    }
+};
+
+TEST_F(MidiTxQueue, BatchesInOrder) {
+    for (uint8_t i = 0; i < 20; i++) {
+        push(note_on(0, i));
+    }
+
+    midi_tx_packet_t transfer[MIDI_TX_BATCH_SIZE];
+    EXPECT_EQ(midi_tx_queue_pop(transfer, MIDI_TX_BATCH_SIZE), MIDI_TX_BATCH_SIZE);
+    EXPECT_EQ(transfer[0].data[1], 0);
+    EXPECT_EQ(transfer[15].data[1], 15);
+    EXPECT_EQ(midi_tx_queue_pop(transfer, MIDI_TX_BATCH_SIZE), 4);
+    EXPECT_EQ(transfer[3].data[1], 19);
+    EXPECT_EQ(midi_tx_queue_pop(transfer, MIDI_TX_BATCH_SIZE), 0);
+}
+
+TEST_F(MidiTxQueue, WrapsAround) {
+    midi_tx_packet_t transfer[MIDI_TX_BATCH_SIZE];
+
+    for (uint8_t round = 0; round < 5; round++) {
+        for (uint8_t i = 0; i < MIDI_TX_QUEUE_SIZE - 3; i++) {
+            push(note_on(0, i));
+        }
+        for (uint8_t i = 0; i < MIDI_TX_QUEUE_SIZE - 3; i += MIDI_TX_BATCH_SIZE) {
+            uint8_t count = midi_tx_queue_pop(transfer, MIDI_TX_BATCH_SIZE);
+            for (uint8_t j = 0; j < count; j++) {
+                EXPECT_EQ(transfer[j].data[1], i + j);
+            }
+        }
+        EXPECT_EQ(midi_tx_queue_length(), 0);
+    }
+}
+
+TEST_F(MidiTxQueue, FullQueueRejects) {
+    for (uint8_t i = 0; i < MIDI_TX_QUEUE_SIZE; i++) {
+        push(note_on(0, i));
+    }
+
+    midi_tx_packet_t packet = note_on(0, 0);
+    EXPECT_FALSE(midi_tx_queue_push(&packet));
+
+    // A queued controller can still be updated
+    midi_tx_queue_clear();
+    for (uint8_t i = 0; i < MIDI_TX_QUEUE_SIZE - 1; i++) {
+        push(note_on(1, i));
+    }
+    push(cc(0, 7, 1));
+    push(cc(0, 7, 2));
+    EXPECT_EQ(midi_tx_queue_length(), MIDI_TX_QUEUE_SIZE);
+}
+
+TEST_F(MidiTxQueue, CoalescesControlChanges) {
+    for (uint8_t value = 0; value < 100; value++) {
+        push(cc(0, 16, value));
+        push(cc(0, 17, 127 - value));
+    }
+    push(cc(1, 16, 5));
+    push(cc(0, 16, 50, 1));
+
+    EXPECT_EQ(drain(), (std::vector<std::vector<uint8_t>>{
+                           {0x0B, 0xB0, 16, 99},
+                           {0x0B, 0xB0, 17, 28},
+                           {0x0B, 0xB1, 16, 5},
+                           {0x1B, 0xB0, 16, 50},
+                       }));
+}
+
+TEST_F(MidiTxQueue, ControlChangesDoNotOvertakeChannelMessages) {
+    push(cc(0, 64, 127));
+    push(note_on(1, 60));
+    push(cc(0, 64, 100));
+    push(note_on(0, 60));
+    push(cc(0, 64, 0));
+
+    EXPECT_EQ(drain(), (std::vector<std::vector<uint8_t>>{
+                           {0x0B, 0xB0, 64, 100},
+                           {0x09, 0x91, 60, 127},
+                           {0x09, 0x90, 60, 127},
+                           {0x0B, 0xB0, 64, 0},
+                       }));
+}
+
+TEST_F(MidiTxQueue, ControlChangesDoNotOvertakeSystemMessages) {
+    push(cc(0, 1, 10));
+    push({.event = 0x0F, .data = {0xF8, 0, 0}});
+    push(cc(0, 1, 20));
+
+    EXPECT_EQ(drain().size(), 3);
+}
+
+TEST_F(MidiTxQueue, OrderSensitiveControllersAreNotCoalesced) {
+    // NRPN 1.2 = 3, then NRPN 4.5 = 6
+    for (uint8_t i = 0; i < 2; i++) {
+        push(cc(0, 99, 1 + 3 * i));
+        push(cc(0, 98, 2 + 3 * i));
+        push(cc(0, 6, 3 + 3 * i));
+    }
+    push(cc(0, 123, 0));
+    push(cc(0, 123, 0));
+    EXPECT_EQ(drain().size(), 8);
+
+    // Each MSB is followed by its LSB
+    push(cc(0, 7, 1));
+    push(cc(0, 39, 2));
+    push(cc(0, 7, 3));
+    push(cc(0, 39, 4));
+    EXPECT_EQ(drain().size(), 4);
+}
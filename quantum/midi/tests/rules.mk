@@ -0,0 +1,3 @@
+midi_tx_queue_SRC := \
+    $(QUANTUM_PATH)/midi/tests/midi_tx_queue_tests.cpp \
+    $(QUANTUM_PATH)/midi/midi_tx_queue.c
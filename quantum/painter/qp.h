@@ -56,6 +56,31 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the number of recently-used Unicode glyphs whose metrics are cached for each loaded font, avoiding
+ *      a search of the font's Unicode glyph table when they are drawn again. Each entry costs 8 bytes of RAM per font.
+ *      Set to 0 to disable.
+ */
+#    define QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE 0
+#endif
+
+#ifndef QUANTUM_PAINTER_FLASH_READ_AHEAD_SIZE
+/**
+ * @def This controls the size of the read-ahead buffer used when streaming images and fonts from external flash. Reads
+ *      from flash are performed in bulk transfers of this size, rather than a byte at a time.
+ */
+#    define QUANTUM_PAINTER_FLASH_READ_AHEAD_SIZE 256
+#endif
+
+#ifndef QUANTUM_PAINTER_FLASH_ASSET_INDEX_ADDRESS
+/**
+ * @def This controls the address in external flash of the asset index, used by \ref qp_load_image_flash_asset and
+ *      \ref qp_load_font_flash_asset to locate images and fonts by ID.
+ */
+#    define QUANTUM_PAINTER_FLASH_ASSET_INDEX_ADDRESS 0
+#endif
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -72,6 +97,15 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+/**
+ * @def This controls whether two pixel data buffers are used in alternation, allowing the transmission of one block to
+ *      the display to overlap with decoding of the next, for comms interfaces capable of asynchronous transfers. Doubles
+ *      the RAM required for the pixel data buffer.
+ */
+#    define QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER FALSE
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -263,6 +297,30 @@ bool qp_setpixel(painter_device_t device, uint16_t x, uint16_t y, uint8_t hue, u
  */
 bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat, uint8_t val);
 
+/**
+ * Draws an anti-aliased line using the specified colors.
+ *
+ * Pixels along the line are blended between the foreground and background colors based on their coverage, using 16
+ * intensity levels. Quantum Painter has no knowledge of the existing contents of the display, so pixels neighbouring
+ * the line are overwritten with the blended colors -- the background color should match whatever the line is drawn on.
+ * Horizontal and vertical lines are drawn as per qp_line().
+ *
+ * @param device[in] the handle of the device to control
+ * @param x0[in] the device's x-position to start
+ * @param y0[in] the device's y-position to start
+ * @param x1[in] the device's x-position to finish
+ * @param y1[in] the device's y-position to finish
+ * @param hue_fg[in] the hue of the line, with 0-360 mapped to 0-255
+ * @param sat_fg[in] the saturation of the line, with 0-100% mapped to 0-255
+ * @param val_fg[in] the value of the line, with 0-100% mapped to 0-255
+ * @param hue_bg[in] the hue of the background, with 0-360 mapped to 0-255
+ * @param sat_bg[in] the saturation of the background, with 0-100% mapped to 0-255
+ * @param val_bg[in] the value of the background, with 0-100% mapped to 0-255
+ * @return true if drawing the line succeeded
+ * @return false if drawing the line failed
+ */
+bool qp_line_aa(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
 /**
  * Draws a rectangle using the specified color, optionally filled.
  *
@@ -353,6 +411,32 @@ bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native
  */
 painter_image_handle_t qp_load_image_mem(const void *buffer);
 
+#ifdef QUANTUM_PAINTER_FLASH_ENABLE
+/**
+ * Loads an image stored in external flash. Image data is streamed from flash as it's drawn.
+ *
+ * @note Images can be unloaded by calling \ref qp_close_image.
+ *
+ * @param address[in] the address of the image data within external flash
+ * @return an image handle usable with \ref qp_drawimage, \ref qp_drawimage_recolor, \ref qp_animate, and
+ *         \ref qp_animate_recolor.
+ * @return NULL if loading the image failed
+ */
+painter_image_handle_t qp_load_image_flash(uint32_t address);
+
+/**
+ * Loads an image stored in external flash, located using the asset index.
+ *
+ * @note Images can be unloaded by calling \ref qp_close_image.
+ *
+ * @param asset_id[in] the index of the image within the asset index at \ref QUANTUM_PAINTER_FLASH_ASSET_INDEX_ADDRESS
+ * @return an image handle usable with \ref qp_drawimage, \ref qp_drawimage_recolor, \ref qp_animate, and
+ *         \ref qp_animate_recolor.
+ * @return NULL if loading the image failed
+ */
+painter_image_handle_t qp_load_image_flash_asset(uint16_t asset_id);
+#endif // QUANTUM_PAINTER_FLASH_ENABLE
+
 /**
  * Closes an image handle when no longer in use.
  *
@@ -440,6 +524,31 @@ void qp_stop_animation(deferred_token anim_token);
  */
 painter_font_handle_t qp_load_font_mem(const void *buffer);
 
+#ifdef QUANTUM_PAINTER_FLASH_ENABLE
+/**
+ * Loads a font stored in external flash. Font data is streamed from flash as it's drawn, unless
+ * \ref QUANTUM_PAINTER_LOAD_FONTS_TO_RAM is set to TRUE.
+ *
+ * @note Fonts can be unloaded by calling \ref qp_close_font.
+ *
+ * @param address[in] the address of the font data within external flash
+ * @return an image handle usable with \ref qp_textwidth, \ref qp_drawtext, and \ref qp_drawtext_recolor.
+ * @return NULL if loading the font failed
+ */
+painter_font_handle_t qp_load_font_flash(uint32_t address);
+
+/**
+ * Loads a font stored in external flash, located using the asset index.
+ *
+ * @note Fonts can be unloaded by calling \ref qp_close_font.
+ *
+ * @param asset_id[in] the index of the font within the asset index at \ref QUANTUM_PAINTER_FLASH_ASSET_INDEX_ADDRESS
+ * @return an image handle usable with \ref qp_textwidth, \ref qp_drawtext, and \ref qp_drawtext_recolor.
+ * @return NULL if loading the font failed
+ */
+painter_font_handle_t qp_load_font_flash_asset(uint16_t asset_id);
+#endif // QUANTUM_PAINTER_FLASH_ENABLE
+
 /**
  * Closes a font handle when no longer in use.
  *
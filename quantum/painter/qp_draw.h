@@ -10,7 +10,17 @@
 // Quantum Painter utility functions
 
 // Global variable used for native pixel data streaming.
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+extern uint8_t *qp_internal_global_pixdata_buffer;
+
+// Check if the supplied data is one of the pixdata buffers, which are only rewritten after being swapped back in
+bool qp_internal_is_pixdata_buffer(const void *data);
+#else
 extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif
+
+// Switches to the other pixdata buffer after a full buffer has been sent, leaving the previous one free to be transmitted asynchronously
+void qp_internal_swap_pixdata_buffer(void);
 
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
@@ -27,6 +37,12 @@ bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 // qp_rect internal implementation, but uses the global pixdata buffer with pre-converted native pixels.
 bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 
+// Draws the horizontal span covering [start, end] pixels either side of centerx on row y, merging both sides into one span if start is zero. Uses the global pixdata buffer with pre-converted native pixels.
+bool qp_internal_hspan_mirrored_impl(painter_device_t device, int16_t centerx, int16_t y, int16_t start, int16_t end);
+
+// Draws the vertical span covering [start, end] pixels either side of centery on column x, merging both sides into one span if start is zero. Uses the global pixdata buffer with pre-converted native pixels.
+bool qp_internal_vspan_mirrored_impl(painter_device_t device, int16_t x, int16_t centery, int16_t start, int16_t end);
+
 // Convert from input pixel data + palette to equivalent pixels
 typedef int16_t (*qp_internal_byte_input_callback)(void* cb_arg);
 typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t index, void* cb_arg);
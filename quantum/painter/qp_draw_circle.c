@@ -7,115 +7,52 @@
 #include "qp_comms.h"
 #include "qp_draw.h"
 
-// Utilize 8-way symmetry to draw circles
-static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+// Utilize 8-way symmetry to draw a run of circle points sharing the same offset
+static bool qp_circle_span_impl(painter_device_t device, int16_t centerx, int16_t centery, int16_t start, int16_t end, int16_t offset, bool filled) {
     /*
-    Circles have the property of 8-way symmetry, so eight pixels can be drawn
-    for each computed [offsetx,offsety] given the center coordinates
-    represented by [centerx,centery].
-
-    For filled circles, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
-
-    Two special cases exist and have been optimized:
-    1) offsetx == offsety (the final point), makes half the coordinates
-    equivalent, so we can omit them (and the corresponding fill lines)
-    2) offsetx == 0 (the starting point) means that some horizontal lines
-    would be a single pixel in length, so we write individual pixels instead.
-    This also makes half the symmetrical points identical to their twins,
-    so we only need four points or two points and one line
+    Circles have the property of 8-way symmetry, so each computed
+    [offsetx,offsety] given the center coordinates represented by
+    [centerx,centery] maps to eight pixels.
+
+    Consecutive points in the first octant that share the same offsety form a
+    run [start,end] of offsetx values. Each run is drawn as spans rather than
+    individual pixels -- horizontal spans at centery+/-offsety and vertical
+    spans at centerx+/-offsety -- so that each span only needs one viewport
+    and one bulk pixdata transfer.
+
+    For filled circles, rows centery+/-offsety span the widest point of the
+    run, and the mirrored octants form a solid block of rows
+    centery+/-[start,end] spanning centerx+/-offsety.
+
+    When offsety == 0 the mirrored spans are identical, so they're omitted.
+    When start == 0 the spans either side of the center are merged.
     */
 
-    int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
-    int16_t xmx = ((int16_t)centerx) - ((int16_t)offsetx);
-    int16_t xpy = ((int16_t)centerx) + ((int16_t)offsety);
-    int16_t xmy = ((int16_t)centerx) - ((int16_t)offsety);
-    int16_t ypx = ((int16_t)centery) + ((int16_t)offsetx);
-    int16_t ymx = ((int16_t)centery) - ((int16_t)offsetx);
-    int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
-    int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
-
-    if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, centerx, ypy)) {
+    if (filled) {
+        if (!qp_internal_fillrect_helper_impl(device, centerx - end, centery + offset, centerx + end, centery + offset)) {
             return false;
         }
-        if (!qp_internal_setpixel_impl(device, centerx, ymy)) {
+        if (offset > 0 && !qp_internal_fillrect_helper_impl(device, centerx - end, centery - offset, centerx + end, centery - offset)) {
             return false;
         }
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, centery, xmy, centery)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, centery)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, centery)) {
-                return false;
-            }
-        }
-    } else if (offsetx == offsety) {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypy, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymy, xmy, ymy)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymy)) {
-                return false;
-            }
+        if (start == 0) {
+            return qp_internal_fillrect_helper_impl(device, centerx - offset, centery - end, centerx + offset, centery + end);
         }
+        return qp_internal_fillrect_helper_impl(device, centerx - offset, centery + start, centerx + offset, centery + end) && qp_internal_fillrect_helper_impl(device, centerx - offset, centery - end, centerx + offset, centery - start);
+    }
 
-    } else {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypx, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymx, xmy, ymx)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymx)) {
-                return false;
-            }
+    if (!qp_internal_hspan_mirrored_impl(device, centerx, centery + offset, start, end)) {
+        return false;
+    }
+    if (!qp_internal_vspan_mirrored_impl(device, centerx + offset, centery, start, end)) {
+        return false;
+    }
+    if (offset > 0) {
+        if (!qp_internal_hspan_mirrored_impl(device, centerx, centery - offset, start, end)) {
+            return false;
+        }
+        if (!qp_internal_vspan_mirrored_impl(device, centerx - offset, centery, start, end)) {
+            return false;
         }
     }
 
@@ -138,32 +75,43 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
     int16_t ycalc = (int16_t)radius;
     int16_t err   = ((5 - (radius >> 2)) >> 2);
 
-    qp_internal_fill_pixdata(device, (radius * 2) + 1, hue, sat, val);
+    qp_internal_fill_pixdata(device, filled ? ((radius * 2) + 1) * ((radius * 2) + 1) : (radius * 2) + 1, hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_circle: fail (could not start comms)\n");
         return false;
     }
 
-    bool ret = true;
-    if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
-        ret = false;
-    }
-
-    if (ret) {
-        while (xcalc < ycalc) {
-            xcalc++;
+    // Walk the first octant, drawing each run of points sharing the same ycalc in one go
+    bool    ret       = true;
+    int16_t run_start = xcalc;
+    while (true) {
+        bool    last  = xcalc >= ycalc;
+        int16_t nextx = xcalc + 1;
+        int16_t nexty = ycalc;
+        if (!last) {
             if (err < 0) {
-                err += (xcalc << 1) + 1;
+                err += (nextx << 1) + 1;
             } else {
-                ycalc--;
-                err += ((xcalc - ycalc) << 1) + 1;
+                nexty--;
+                err += ((nextx - nexty) << 1) + 1;
             }
-            if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
+        }
+
+        if (last || nexty != ycalc) {
+            if (!qp_circle_span_impl(device, x, y, run_start, xcalc, ycalc, filled)) {
                 ret = false;
                 break;
             }
+            run_start = nextx;
+        }
+
+        if (last) {
+            break;
         }
+
+        xcalc = nextx;
+        ycalc = nexty;
     }
 
     qp_dprintf("qp_circle: %s\n", ret ? "ok" : "fail");
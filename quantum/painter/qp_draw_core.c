@@ -21,7 +21,12 @@ STATIC_ASSERT((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIXD
 //
 
 // Buffer used for transmitting native pixel data to the downstream device.
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+__attribute__((__aligned__(4))) static uint8_t qp_internal_global_pixdata_buffers[2][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+uint8_t                                       *qp_internal_global_pixdata_buffer = qp_internal_global_pixdata_buffers[0];
+#else
 __attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif
 
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
@@ -42,6 +47,19 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
 }
 
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+bool qp_internal_is_pixdata_buffer(const void *data) {
+    return data == qp_internal_global_pixdata_buffers[0] || data == qp_internal_global_pixdata_buffers[1];
+}
+#endif
+
+void qp_internal_swap_pixdata_buffer(void) {
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    // Any comms send of the buffer we're swapping to has already been waited upon, as each send waits for the previous one to complete
+    qp_internal_global_pixdata_buffer = qp_internal_global_pixdata_buffers[qp_internal_global_pixdata_buffer == qp_internal_global_pixdata_buffers[0] ? 1 : 0];
+#endif
+}
+
 // qp_setpixel internal implementation, but accepts a buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y) {
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -186,8 +204,6 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
         return false;
     }
 
-    qp_internal_fill_pixdata(device, 1, hue, sat, val);
-
     // draw angled line using Bresenham's algo
     int16_t x      = ((int16_t)x0);
     int16_t y      = ((int16_t)y0);
@@ -199,24 +215,41 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
     int16_t e  = dx + dy;
     int16_t e2 = 2 * e;
 
-    bool ret = true;
+    // The longest possible run of pixels is along the major axis
+    qp_internal_fill_pixdata(device, QP_MAX(dx, -dy) + 1, hue, sat, val);
+
+    // Consecutive pixels along the same row or column are sent as a single span, rather than one viewport per pixel
+    int16_t run_x = x;
+    int16_t run_y = y;
+    bool    ret   = true;
     while (x != x1 || y != y1) {
-        if (!qp_internal_setpixel_impl(device, x, y)) {
-            ret = false;
-            break;
-        }
-        e2 = 2 * e;
+        int16_t next_x = x;
+        int16_t next_y = y;
+        e2             = 2 * e;
         if (e2 >= dy) {
             e += dy;
-            x += slopex;
+            next_x += slopex;
         }
         if (e2 <= dx) {
             e += dx;
-            y += slopey;
+            next_y += slopey;
+        }
+
+        // Flush the current run if the next pixel doesn't continue it
+        if (next_x != run_x && next_y != run_y) {
+            if (!qp_internal_fillrect_helper_impl(device, run_x, run_y, x, y)) {
+                ret = false;
+                break;
+            }
+            run_x = next_x;
+            run_y = next_y;
         }
+
+        x = next_x;
+        y = next_y;
     }
-    // draw the last pixel
-    if (!qp_internal_setpixel_impl(device, x, y)) {
+    // draw the last run
+    if (ret && !qp_internal_fillrect_helper_impl(device, run_x, run_y, x, y)) {
         ret = false;
     }
 
@@ -225,6 +258,131 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
     return ret;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_line_aa
+
+// Number of intensity levels used when blending anti-aliased lines from background to foreground
+#define QP_LINE_AA_LEVELS 16
+
+// Draws a run of anti-aliased line pixels sharing the same integral minor-axis position, starting at the 16.16 minor-axis position `pos`
+static bool qp_line_aa_span_impl(painter_device_t device, bool steep, int16_t start, int16_t end, int32_t pos, int32_t gradient) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    int16_t           minor  = (int16_t)(pos >> 16);
+    uint16_t          count  = end - start + 1;
+
+    // If the run lies exactly on the pixel grid, only a single row/column of pixels is needed
+    bool    thick = false;
+    int32_t p     = pos;
+    for (uint16_t i = 0; i < count; ++i, p += gradient) {
+        if (((p >> 12) & 0x0F) != 0) {
+            thick = true;
+            break;
+        }
+    }
+
+    // Fill the pixdata buffer with the blended pixels -- the first row/column gets the remainder of the coverage of the second
+    uint32_t pixel_offset = 0;
+    uint8_t  palette_idx;
+    p = pos;
+    for (uint16_t i = 0; i < count; ++i, p += gradient) {
+        uint8_t coverage = (p >> 12) & 0x0F;
+        palette_idx      = (QP_LINE_AA_LEVELS - 1) - coverage;
+        driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, pixel_offset++, 1, &palette_idx);
+        if (thick && steep) {
+            // Steep lines are drawn as a 2-wide column, so the pixel pairs are interleaved
+            palette_idx = coverage;
+            driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, pixel_offset++, 1, &palette_idx);
+        }
+    }
+    if (thick && !steep) {
+        p = pos;
+        for (uint16_t i = 0; i < count; ++i, p += gradient) {
+            palette_idx = (p >> 12) & 0x0F;
+            driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, pixel_offset++, 1, &palette_idx);
+        }
+    }
+
+    bool ret;
+    if (steep) {
+        ret = driver->driver_vtable->viewport(device, minor, start, minor + (thick ? 1 : 0), end);
+    } else {
+        ret = driver->driver_vtable->viewport(device, start, minor, end, minor + (thick ? 1 : 0));
+    }
+    ret = ret && driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, pixel_offset);
+    qp_internal_swap_pixdata_buffer();
+    return ret;
+}
+
+bool qp_line_aa(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    if (x0 == x1 || y0 == y1) {
+        qp_dprintf("qp_line_aa(%d, %d, %d, %d): entry (deferring to qp_line)\n", (int)x0, (int)y0, (int)x1, (int)y1);
+        bool ret = qp_line(device, x0, y0, x1, y1, hue_fg, sat_fg, val_fg);
+        qp_dprintf("qp_line_aa(%d, %d, %d, %d): %s (deferred to qp_line)\n", (int)x0, (int)y0, (int)x1, (int)y1, ret ? "ok" : "fail");
+        return ret;
+    }
+
+    qp_dprintf("qp_line_aa(%d, %d, %d, %d): entry\n", (int)x0, (int)y0, (int)x1, (int)y1);
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_line_aa: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    // Work along the major axis of the line, from the lower coordinate to the higher
+    bool    steep = abs(((int16_t)y1) - ((int16_t)y0)) > abs(((int16_t)x1) - ((int16_t)x0));
+    int16_t u0    = (int16_t)(steep ? y0 : x0);
+    int16_t v0    = (int16_t)(steep ? x0 : y0);
+    int16_t u1    = (int16_t)(steep ? y1 : x1);
+    int16_t v1    = (int16_t)(steep ? x1 : y1);
+    if (u0 > u1) {
+        int16_t t = u0;
+        u0        = u1;
+        u1        = t;
+        t         = v0;
+        v0        = v1;
+        v1        = t;
+    }
+
+    // Generate the blend palette from background to foreground
+    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+    if (qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, QP_LINE_AA_LEVELS)) {
+        if (!driver->driver_vtable->palette_convert(device, QP_LINE_AA_LEVELS, qp_internal_global_pixel_lookup_table)) {
+            qp_dprintf("qp_line_aa: fail (could not convert pixels to native)\n");
+            return false;
+        }
+    }
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("Failed to start comms in qp_line_aa\n");
+        return false;
+    }
+
+    // Step along the major axis with the minor axis position in 16.16 fixed point, drawing each run of pixels sharing the same integral minor position as a single span
+    uint16_t max_run   = qp_internal_num_pixels_in_buffer(device) / 2;
+    int32_t  gradient  = (((int32_t)(v1 - v0)) << 16) / (u1 - u0);
+    int32_t  pos       = ((int32_t)v0) << 16;
+    int32_t  run_pos   = pos;
+    int16_t  run_start = u0;
+    bool     ret       = true;
+    for (int16_t u = u0; u <= u1; ++u) {
+        int32_t next_pos = pos + gradient;
+        if (u == u1 || (next_pos >> 16) != (run_pos >> 16) || (u - run_start + 1) >= max_run) {
+            if (!qp_line_aa_span_impl(device, steep, run_start, u, run_pos, gradient)) {
+                ret = false;
+                break;
+            }
+            run_start = u + 1;
+            run_pos   = next_pos;
+        }
+        pos = next_pos;
+    }
+
+    qp_comms_stop(device);
+    qp_dprintf("qp_line_aa(%d, %d, %d, %d): %s\n", (int)x0, (int)y0, (int)x1, (int)y1, ret ? "ok" : "fail");
+    return ret;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_rect
 
@@ -251,6 +409,20 @@ bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t left, ui
     return true;
 }
 
+bool qp_internal_hspan_mirrored_impl(painter_device_t device, int16_t centerx, int16_t y, int16_t start, int16_t end) {
+    if (start == 0) {
+        return qp_internal_fillrect_helper_impl(device, centerx - end, y, centerx + end, y);
+    }
+    return qp_internal_fillrect_helper_impl(device, centerx + start, y, centerx + end, y) && qp_internal_fillrect_helper_impl(device, centerx - end, y, centerx - start, y);
+}
+
+bool qp_internal_vspan_mirrored_impl(painter_device_t device, int16_t x, int16_t centery, int16_t start, int16_t end) {
+    if (start == 0) {
+        return qp_internal_fillrect_helper_impl(device, x, centery - end, x, centery + end);
+    }
+    return qp_internal_fillrect_helper_impl(device, x, centery + start, x, centery + end) && qp_internal_fillrect_helper_impl(device, x, centery - end, x, centery - start);
+}
+
 bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
     qp_dprintf("qp_rect(%d, %d, %d, %d): entry\n", (int)left, (int)top, (int)right, (int)bottom);
     painter_driver_t *driver = (painter_driver_t *)device;
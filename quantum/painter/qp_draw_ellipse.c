@@ -6,54 +6,49 @@
 #include "qp_comms.h"
 #include "qp_draw.h"
 
-// Utilize 4-way symmetry to draw an ellipse
-static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+// Utilize 4-way symmetry to draw a run of ellipse points sharing the same offset
+static bool qp_ellipse_span_impl(painter_device_t device, int16_t centerx, int16_t centery, int16_t start, int16_t end, int16_t offset, bool filled, bool horizontal) {
     /*
-    Ellipses have the property of 4-way symmetry, so four pixels can be drawn
-    for each computed [offsetx,offsety] given the center coordinates
-    represented by [centerx,centery].
+    Ellipses have the property of 4-way symmetry, so each computed
+    [offsetx,offsety] given the center coordinates represented by
+    [centerx,centery] maps to four pixels.
 
-    For filled ellipses, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
+    In the first region of the ellipse consecutive points share the same
+    offsety, forming a horizontal run [start,end] of offsetx values. In the
+    second region they share the same offsetx, forming a vertical run of
+    offsety values. Each run is drawn as a span, needing only one viewport and
+    one bulk pixdata transfer, rather than as individual pixels.
 
-    When offsetx == 0 only two pixels can be drawn for filled or unfilled ellipses
-    */
+    For filled ellipses, horizontal runs become rows spanning the widest point
+    of the run, and vertical runs become solid blocks.
 
-    int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
-    int16_t xmx = ((int16_t)centerx) - ((int16_t)offsetx);
-    int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
-    int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
+    When the offset is zero the mirrored spans are identical, so they're
+    omitted. When start == 0 the spans either side of the center are merged.
+    */
 
-    if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
-        }
-    } else if (filled) {
-        if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-            return false;
-        }
-        if (offsety > 0 && !qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-            return false;
-        }
-    } else {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
+    if (horizontal) {
+        if (filled) {
+            if (!qp_internal_fillrect_helper_impl(device, centerx - end, centery + offset, centerx + end, centery + offset)) {
+                return false;
+            }
+            return offset == 0 || qp_internal_fillrect_helper_impl(device, centerx - end, centery - offset, centerx + end, centery - offset);
         }
-        if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
+        if (!qp_internal_hspan_mirrored_impl(device, centerx, centery + offset, start, end)) {
             return false;
         }
+        return offset == 0 || qp_internal_hspan_mirrored_impl(device, centerx, centery - offset, start, end);
     }
 
-    return true;
+    if (filled) {
+        if (start == 0) {
+            return qp_internal_fillrect_helper_impl(device, centerx - offset, centery - end, centerx + offset, centery + end);
+        }
+        return qp_internal_fillrect_helper_impl(device, centerx - offset, centery + start, centerx + offset, centery + end) && qp_internal_fillrect_helper_impl(device, centerx - offset, centery - end, centerx + offset, centery - start);
+    }
+    if (!qp_internal_vspan_mirrored_impl(device, centerx + offset, centery, start, end)) {
+        return false;
+    }
+    return offset == 0 || qp_internal_vspan_mirrored_impl(device, centerx - offset, centery, start, end);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -75,39 +70,53 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     int16_t dx = 0;
     int16_t dy = ((int16_t)sizey);
 
-    qp_internal_fill_pixdata(device, QP_MAX(sizex, sizey), hue, sat, val);
+    qp_internal_fill_pixdata(device, filled ? ((sizex * 2) + 1) * ((sizey * 2) + 1) : (QP_MAX(sizex, sizey) * 2) + 1, hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_ellipse: fail (could not start comms)\n");
         return false;
     }
 
-    bool ret = true;
+    // First region: each run of points sharing the same dy is drawn in one go
+    bool    ret       = true;
+    int16_t run_start = dx;
     for (int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
-            ret = false;
-            break;
-        }
+        int16_t run_dy = dy;
         if (delta >= 0) {
             delta += fa * (1 - dy);
             dy--;
         }
         delta += bb * (4 * dx + 6);
+
+        if (dy != run_dy || bb * (dx + 1) > aa * dy) {
+            if (!qp_ellipse_span_impl(device, x, y, run_start, dx, run_dy, filled, true)) {
+                ret = false;
+                break;
+            }
+            run_start = dx + 1;
+        }
     }
 
     dx = sizex;
     dy = 0;
 
-    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
-            ret = false;
-            break;
-        }
+    // Second region: each run of points sharing the same dx is drawn in one go
+    run_start = dy;
+    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); ret && aa * dy <= bb * dx; dy++) {
+        int16_t run_dx = dx;
         if (delta >= 0) {
             delta += fb * (1 - dx);
             dx--;
         }
         delta += aa * (4 * dy + 6);
+
+        if (dx != run_dx || aa * (dy + 1) > bb * dx) {
+            if (!qp_ellipse_span_impl(device, x, y, run_start, dy, run_dx, filled, false)) {
+                ret = false;
+                break;
+            }
+            run_start = dy + 1;
+        }
     }
 
     qp_dprintf("qp_ellipse: %s\n", ret ? "ok" : "fail");
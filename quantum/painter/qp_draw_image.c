@@ -19,6 +19,9 @@ typedef struct qgf_image_handle_t {
 #ifdef QP_STREAM_HAS_FILE_IO
         qp_file_stream_t file_stream;
 #endif // QP_STREAM_HAS_FILE_IO
+#ifdef QUANTUM_PAINTER_FLASH_ENABLE
+        qp_flash_stream_t flash_stream;
+#endif // QUANTUM_PAINTER_FLASH_ENABLE
     };
 } qgf_image_handle_t;
 
@@ -85,6 +88,42 @@ painter_image_handle_t qp_load_image_mem(const void *buffer) {
     return qp_load_image_internal(image_mem_stream_factory, (void *)buffer);
 }
 
+#ifdef QUANTUM_PAINTER_FLASH_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_image_flash
+
+static inline bool image_flash_stream_factory(qgf_image_handle_t *image, void *arg) {
+    uint32_t address = *(uint32_t *)arg;
+
+    // Assume we can read the graphics descriptor
+    image->flash_stream = qp_make_flash_stream(address, sizeof(qgf_graphics_descriptor_v1_t));
+
+    // Update the length of the stream to match, and rewind to the start
+    image->flash_stream.length   = qgf_get_total_size(&image->stream);
+    image->flash_stream.position = 0;
+
+    return true;
+}
+
+painter_image_handle_t qp_load_image_flash(uint32_t address) {
+    return qp_load_image_internal(image_flash_stream_factory, &address);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_image_flash_asset
+
+painter_image_handle_t qp_load_image_flash_asset(uint16_t asset_id) {
+    uint32_t address;
+    if (!qp_flash_asset_find(asset_id, &address, NULL)) {
+        qp_dprintf("qp_load_image_flash_asset: fail (could not find asset %d)\n", (int)asset_id);
+        return NULL;
+    }
+    return qp_load_image_flash(address);
+}
+
+#endif // QUANTUM_PAINTER_FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_image
 
@@ -117,6 +156,7 @@ typedef struct qgf_frame_info_t {
     bool                  has_palette;
     bool                  is_panel_native;
     bool                  is_delta;
+    bool                  is_unchanged;
     uint16_t              left;
     uint16_t              top;
     uint16_t              right;
@@ -204,6 +244,9 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         return false;
     }
 
+    // Delta frames without any pixel data are identical to the previous frame
+    info->is_unchanged = info->is_delta && data_descriptor.header.length == 0;
+
     // Stream is now at the point of being able to read pixdata
     return true;
 }
@@ -228,6 +271,12 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
+    // Nothing to send to the display if the frame doesn't change anything
+    if (frame_info->is_unchanged) {
+        qp_dprintf("qp_drawimage_recolor: ok (frame %d unchanged)\n", frame_number);
+        return true;
+    }
+
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_drawimage_recolor: fail (could not start comms)\n");
         return false;
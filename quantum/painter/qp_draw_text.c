@@ -12,6 +12,13 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QFF font handles
 
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+typedef struct qff_glyph_cache_entry_t {
+    uint32_t code_point;
+    uint32_t value; // Uses QFF_GLYPH_*_(BITS|MASK), as per the glyph tables
+} qff_glyph_cache_entry_t;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
 typedef struct qff_font_handle_t {
     painter_font_desc_t   base;
     bool                  validate_ok;
@@ -21,12 +28,21 @@ typedef struct qff_font_handle_t {
     bool                  has_palette;
     bool                  is_panel_native;
     painter_compression_t compression_scheme;
+    bool                  unicode_table_sorted;
+    uint32_t              glyph_data_offset;
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    uint8_t                 glyph_cache_count;
+    qff_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE];
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
     union {
         qp_stream_t        stream;
         qp_memory_stream_t mem_stream;
 #ifdef QP_STREAM_HAS_FILE_IO
         qp_file_stream_t file_stream;
 #endif // QP_STREAM_HAS_FILE_IO
+#ifdef QUANTUM_PAINTER_FLASH_ENABLE
+        qp_flash_stream_t flash_stream;
+#endif // QUANTUM_PAINTER_FLASH_ENABLE
     };
 #if QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
     bool  owns_buffer;
@@ -36,6 +52,43 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper: glyph table offsets
+
+static inline uint32_t qff_unicode_table_offset(qff_font_handle_t *qff_font) {
+    return sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
+           + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
+           + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
+}
+
+static inline uint32_t qff_glyph_data_offset(qff_font_handle_t *qff_font) {
+    return sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
+           + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
+           + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
+           + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
+           + sizeof(qgf_block_header_v1_t);                                                                                                                     // Skip the data block header
+}
+
+// Checks that the unicode glyph table is in ascending code point order, allowing it to be binary searched
+static bool qff_unicode_table_is_sorted(qff_font_handle_t *qff_font) {
+    if (qp_stream_setpos(&qff_font->stream, qff_unicode_table_offset(qff_font)) < 0) {
+        return false;
+    }
+
+    qff_unicode_glyph_v1_t glyph_info;
+    uint32_t               prev_code_point = 0;
+    for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
+        if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+            return false;
+        }
+        if (i > 0 && glyph_info.code_point <= prev_code_point) {
+            return false;
+        }
+        prev_code_point = glyph_info.code_point;
+    }
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -73,13 +126,18 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
     font->owns_buffer = false;
     font->buffer      = NULL;
 
-    void *ram_buffer = malloc(font->mem_stream.length);
+    // Work out the length of the font, regardless of the type of stream it's being loaded from
+    qp_stream_seek(&font->stream, 0, SEEK_END);
+    int32_t font_length = qp_stream_tell(&font->stream);
+    qp_stream_setpos(&font->stream, 0);
+
+    void *ram_buffer = malloc(font_length);
     if (ram_buffer == NULL) {
         qp_dprintf("qp_load_font: could not allocate enough RAM for font, falling back to original\n");
     } else {
         do {
             // Copy the data into RAM
-            if (qp_stream_read(ram_buffer, 1, font->mem_stream.length, &font->mem_stream) != font->mem_stream.length) {
+            if (qp_stream_read(ram_buffer, 1, font_length, &font->stream) != (uint32_t)font_length) {
                 qp_dprintf("qp_load_font: could not copy from flash to RAM, falling back to original\n");
                 break;
             }
@@ -87,7 +145,7 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
             // Create the new stream with the new buffer
             font->buffer      = ram_buffer;
             font->owns_buffer = true;
-            font->mem_stream  = qp_make_memory_stream(font->buffer, font->mem_stream.length);
+            font->mem_stream  = qp_make_memory_stream(font->buffer, font_length);
         } while (0);
     }
 
@@ -106,6 +164,16 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
         return NULL;
     }
 
+    // Work out where the glyph data lives, and whether the unicode table can be binary searched
+    font->glyph_data_offset    = qff_glyph_data_offset(font);
+    font->unicode_table_sorted = qff_unicode_table_is_sorted(font);
+    if (font->num_unicode_glyphs > 0 && !font->unicode_table_sorted) {
+        qp_dprintf("qp_load_font: unicode glyph table is unsorted, falling back to linear search\n");
+    }
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    font->glyph_cache_count = 0;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
     // Validation success, we can return the handle
     font->validate_ok = true;
     qp_dprintf("qp_load_font: ok\n");
@@ -132,6 +200,42 @@ painter_font_handle_t qp_load_font_mem(const void *buffer) {
     return qp_load_font_internal(font_mem_stream_factory, (void *)buffer);
 }
 
+#ifdef QUANTUM_PAINTER_FLASH_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_font_flash
+
+static inline bool font_flash_stream_factory(qff_font_handle_t *font, void *arg) {
+    uint32_t address = *(uint32_t *)arg;
+
+    // Assume we can read the graphics descriptor
+    font->flash_stream = qp_make_flash_stream(address, sizeof(qff_font_descriptor_v1_t));
+
+    // Update the length of the stream to match, and rewind to the start
+    font->flash_stream.length   = qff_get_total_size(&font->stream);
+    font->flash_stream.position = 0;
+
+    return true;
+}
+
+painter_font_handle_t qp_load_font_flash(uint32_t address) {
+    return qp_load_font_internal(font_flash_stream_factory, &address);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_font_flash_asset
+
+painter_font_handle_t qp_load_font_flash_asset(uint16_t asset_id) {
+    uint32_t address;
+    if (!qp_flash_asset_find(asset_id, &address, NULL)) {
+        qp_dprintf("qp_load_font_flash_asset: fail (could not find asset %d)\n", (int)asset_id);
+        return NULL;
+    }
+    return qp_load_font_flash(address);
+}
+
+#endif // QUANTUM_PAINTER_FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_font
 
@@ -214,7 +318,95 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     return true;
 }
 
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+// Looks up a recently-used unicode glyph, moving it to the front of the cache if found
+static inline bool qp_drawtext_glyph_cache_find(qff_font_handle_t *qff_font, uint32_t code_point, uint32_t *value) {
+    for (uint8_t i = 0; i < qff_font->glyph_cache_count; ++i) {
+        if (qff_font->glyph_cache[i].code_point == code_point) {
+            qff_glyph_cache_entry_t entry = qff_font->glyph_cache[i];
+            memmove(&qff_font->glyph_cache[1], &qff_font->glyph_cache[0], i * sizeof(qff_glyph_cache_entry_t));
+            qff_font->glyph_cache[0] = entry;
+            *value                   = entry.value;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Inserts a unicode glyph at the front of the cache, evicting the least recently used entry if full
+static inline void qp_drawtext_glyph_cache_insert(qff_font_handle_t *qff_font, uint32_t code_point, uint32_t value) {
+    if (qff_font->glyph_cache_count < QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE) {
+        qff_font->glyph_cache_count++;
+    }
+    memmove(&qff_font->glyph_cache[1], &qff_font->glyph_cache[0], (qff_font->glyph_cache_count - 1) * sizeof(qff_glyph_cache_entry_t));
+    qff_font->glyph_cache[0] = (qff_glyph_cache_entry_t){.code_point = code_point, .value = value};
+}
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
+static inline bool qp_drawtext_read_unicode_glyph(qff_font_handle_t *qff_font, uint16_t index, qff_unicode_glyph_v1_t *glyph_info) {
+    if (qp_stream_setpos(&qff_font->stream, qff_unicode_table_offset(qff_font) + index * sizeof(qff_unicode_glyph_v1_t)) < 0) {
+        qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+        return false;
+    }
+
+    if (qp_stream_read(glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+        qp_dprintf("Failed to read unicode glyph info\n");
+        return false;
+    }
+
+    return true;
+}
+
+// Finds the glyph info in the unicode table, which may include singular ascii glyphs if full ascii table isn't specified
+static inline bool qp_drawtext_find_unicode_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint32_t *value) {
+    qff_unicode_glyph_v1_t glyph_info;
+
+    if (qff_font->unicode_table_sorted) {
+        // Binary search the table
+        uint16_t lo = 0;
+        uint16_t hi = qff_font->num_unicode_glyphs;
+        while (lo < hi) {
+            uint16_t mid = lo + (hi - lo) / 2;
+            if (!qp_drawtext_read_unicode_glyph(qff_font, mid, &glyph_info)) {
+                return false;
+            }
+
+            if (glyph_info.code_point == code_point) {
+                *value = glyph_info.value;
+                return true;
+            } else if (glyph_info.code_point < code_point) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+    } else {
+        // Fonts with an unsorted table need every entry checked
+        if (qp_stream_setpos(&qff_font->stream, qff_unicode_table_offset(qff_font)) < 0) {
+            qp_dprintf("Failed to set stream position while preparing glyph data\n");
+            return false;
+        }
+
+        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
+            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+                qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+                return false;
+            }
+
+            if (glyph_info.code_point == code_point) {
+                *value = glyph_info.value;
+                return true;
+            }
+        }
+    }
+
+    // Not found
+    qp_dprintf("Failed to find unicode glyph info\n");
+    return false;
+}
+
 static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+    uint32_t value;
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
         qff_ascii_glyph_v1_t glyph_info;
@@ -231,65 +423,31 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             return false;
         }
 
-        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
-            return false;
-        }
-
-        *width = glyph_width;
-        return true;
+        value = glyph_info.value;
     } else {
-        // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
-        uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
-                                     + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
-                                     + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
-
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing glyph data\n");
-            return false;
-        }
-
-        qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
-            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
-                qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+        if (!qp_drawtext_glyph_cache_find(qff_font, code_point, &value)) {
+            if (!qp_drawtext_find_unicode_glyph(qff_font, code_point, &value)) {
                 return false;
             }
-
-            if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
-                    return false;
-                }
-
-                *width = glyph_width;
-                return true;
-            }
+            qp_drawtext_glyph_cache_insert(qff_font, code_point, value);
         }
+#else
+        if (!qp_drawtext_find_unicode_glyph(qff_font, code_point, &value)) {
+            return false;
+        }
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    }
 
-        // Not found
-        qp_dprintf("Failed to find unicode glyph info\n");
+    uint8_t  glyph_width  = (uint8_t)(value & QFF_GLYPH_WIDTH_MASK);
+    uint32_t glyph_offset = ((value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
+    if (qp_stream_setpos(&qff_font->stream, qff_font->glyph_data_offset + glyph_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
         return false;
     }
-    return false;
+
+    *width = glyph_width;
+    return true;
 }
 
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
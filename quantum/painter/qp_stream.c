@@ -1,12 +1,18 @@
 // Copyright 2021 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "qp_stream.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Stream API
 
 uint32_t qp_stream_read_impl(void *output_buf, uint32_t member_size, uint32_t num_members, qp_stream_t *stream) {
+    // Use bulk reads if the stream supports them
+    if (stream->read) {
+        return stream->read(stream, output_buf, num_members * member_size) / member_size;
+    }
+
     uint8_t *output_ptr = (uint8_t *)output_buf;
 
     uint32_t i;
@@ -47,6 +53,17 @@ static inline int16_t mem_get(qp_stream_t *stream) {
     return s->buffer[s->position++];
 }
 
+static inline uint32_t mem_read(qp_stream_t *stream, void *output_buf, uint32_t length) {
+    qp_memory_stream_t *s = (qp_memory_stream_t *)stream;
+    if (s->position + (int32_t)length > s->length) {
+        length    = (s->position < s->length) ? (s->length - s->position) : 0;
+        s->is_eof = true;
+    }
+    memcpy(output_buf, &s->buffer[s->position], length);
+    s->position += length;
+    return length;
+}
+
 static inline bool mem_put(qp_stream_t *stream, uint8_t c) {
     qp_memory_stream_t *s = (qp_memory_stream_t *)stream;
     if (s->position >= s->length) {
@@ -111,7 +128,7 @@ static inline void mem_close(qp_stream_t *stream) {
 
 qp_memory_stream_t qp_make_memory_stream(void *buffer, int32_t length) {
     qp_memory_stream_t stream = {
-        .base     = {.get = mem_get, .put = mem_put, .seek = mem_seek, .tell = mem_tell, .is_eof = mem_is_eof, .close = mem_close},
+        .base     = {.get = mem_get, .read = mem_read, .put = mem_put, .seek = mem_seek, .tell = mem_tell, .is_eof = mem_is_eof, .close = mem_close},
         .buffer   = (uint8_t *)buffer,
         .length   = length,
         .position = 0,
@@ -164,3 +181,174 @@ qp_file_stream_t qp_make_file_stream(FILE *f) {
     return stream;
 }
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// External flash streams
+
+#ifdef QUANTUM_PAINTER_FLASH_ENABLE
+
+#    include "flash.h"
+
+// Read-ahead buffer shared by all flash streams, keyed by absolute flash address
+static uint8_t  flash_read_ahead_buffer[QUANTUM_PAINTER_FLASH_READ_AHEAD_SIZE];
+static uint32_t flash_read_ahead_address = 0;
+static uint32_t flash_read_ahead_length  = 0;
+
+// Copies as much of the requested range as is available from the read-ahead buffer, returning the number of bytes copied
+static inline uint32_t flash_read_ahead_copy(uint32_t address, uint8_t *output_buf, uint32_t length) {
+    if (address < flash_read_ahead_address || address >= flash_read_ahead_address + flash_read_ahead_length) {
+        return 0;
+    }
+    uint32_t available = flash_read_ahead_address + flash_read_ahead_length - address;
+    if (length > available) {
+        length = available;
+    }
+    memcpy(output_buf, &flash_read_ahead_buffer[address - flash_read_ahead_address], length);
+    return length;
+}
+
+static bool flash_read_ahead_fill(uint32_t address, uint32_t length) {
+    if (length > QUANTUM_PAINTER_FLASH_READ_AHEAD_SIZE) {
+        length = QUANTUM_PAINTER_FLASH_READ_AHEAD_SIZE;
+    }
+    if (flash_read_range(address, flash_read_ahead_buffer, length) != FLASH_STATUS_SUCCESS) {
+        flash_read_ahead_length = 0;
+        return false;
+    }
+    flash_read_ahead_address = address;
+    flash_read_ahead_length  = length;
+    return true;
+}
+
+static inline uint32_t flash_read(qp_stream_t *stream, void *output_buf, uint32_t length) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    if (s->position + (int32_t)length > s->length) {
+        length    = (s->position < s->length) ? (s->length - s->position) : 0;
+        s->is_eof = true;
+    }
+
+    uint8_t *output_ptr = (uint8_t *)output_buf;
+    uint32_t done       = 0;
+    while (done < length) {
+        uint32_t address = s->address + s->position + done;
+        uint32_t copied  = flash_read_ahead_copy(address, &output_ptr[done], length - done);
+        if (copied > 0) {
+            done += copied;
+            continue;
+        }
+
+        // Large reads go straight to the destination, anything else refills the read-ahead buffer from this location
+        uint32_t remaining = length - done;
+        if (remaining >= QUANTUM_PAINTER_FLASH_READ_AHEAD_SIZE) {
+            if (flash_read_range(address, &output_ptr[done], remaining) != FLASH_STATUS_SUCCESS) {
+                break;
+            }
+            done += remaining;
+        } else if (!flash_read_ahead_fill(address, s->length - (s->position + done))) {
+            break;
+        }
+    }
+
+    s->position += done;
+    return done;
+}
+
+static inline int16_t flash_get(qp_stream_t *stream) {
+    uint8_t c;
+    if (flash_read(stream, &c, 1) != 1) {
+        ((qp_flash_stream_t *)stream)->is_eof = true;
+        return STREAM_EOF;
+    }
+    return c;
+}
+
+static inline bool flash_put(qp_stream_t *stream, uint8_t c) {
+    // Flash streams are read-only.
+    return false;
+}
+
+static inline int flash_seek(qp_stream_t *stream, int32_t offset, int origin) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+
+    // Handle as per fseek
+    int32_t position = s->position;
+    switch (origin) {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position += offset;
+            break;
+        case SEEK_END:
+            position = s->length + offset;
+            break;
+        default:
+            return -1;
+    }
+
+    // Same bounds handling as memory streams
+    if (position < 0 || position > s->length) {
+        return -1;
+    }
+
+    s->position = position;
+    s->is_eof   = false;
+    return 0;
+}
+
+static inline int32_t flash_tell(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->position;
+}
+
+static inline bool flash_is_eof(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->is_eof;
+}
+
+static inline void flash_close(qp_stream_t *stream) {
+    // No-op.
+}
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length) {
+    flash_init_once();
+
+    // Anything read ahead by an earlier stream may since have been rewritten, so assets loaded after a flash write see the new contents
+    flash_read_ahead_length = 0;
+
+    qp_flash_stream_t stream = {
+        .base     = {.get = flash_get, .read = flash_read, .put = flash_put, .seek = flash_seek, .tell = flash_tell, .is_eof = flash_is_eof, .close = flash_close},
+        .address  = address,
+        .length   = length,
+        .position = 0,
+    };
+    return stream;
+}
+
+bool qp_flash_asset_find(uint16_t asset_id, uint32_t *address, uint32_t *length) {
+    qp_flash_stream_t stream = qp_make_flash_stream(QUANTUM_PAINTER_FLASH_ASSET_INDEX_ADDRESS, sizeof(qp_flash_asset_index_v1_t) + ((uint32_t)(asset_id + 1) * sizeof(qp_flash_asset_entry_v1_t)));
+
+    qp_flash_asset_index_v1_t index;
+    if (qp_stream_read(&index, sizeof(index), 1, &stream) != 1 || index.magic != QP_FLASH_ASSET_INDEX_MAGIC) {
+        qp_dprintf("qp_flash_asset_find: fail (no asset index at 0x%08lX)\n", (unsigned long)QUANTUM_PAINTER_FLASH_ASSET_INDEX_ADDRESS);
+        return false;
+    }
+    if (asset_id >= index.asset_count) {
+        qp_dprintf("qp_flash_asset_find: fail (asset %d out of range, %d assets)\n", (int)asset_id, (int)index.asset_count);
+        return false;
+    }
+
+    qp_flash_asset_entry_v1_t entry;
+    qp_stream_setpos(&stream, sizeof(qp_flash_asset_index_v1_t) + ((uint32_t)asset_id * sizeof(qp_flash_asset_entry_v1_t)));
+    if (qp_stream_read(&entry, sizeof(entry), 1, &stream) != 1) {
+        return false;
+    }
+
+    *address = QUANTUM_PAINTER_FLASH_ASSET_INDEX_ADDRESS + entry.offset;
+    if (length) {
+        *length = entry.length;
+    }
+    return true;
+}
+
+#endif // QUANTUM_PAINTER_FLASH_ENABLE
@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+#include "compiler_support.h"
 #include "qp_internal.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,6 +51,7 @@ uint32_t qp_stream_write_impl(const void *input_buf, uint32_t member_size, uint3
 
 typedef struct qp_stream_t {
     int16_t (*get)(qp_stream_t *stream);
+    uint32_t (*read)(qp_stream_t *stream, void *output_buf, uint32_t length); // optional, bulk reads fall back to get() if NULL
     bool (*put)(qp_stream_t *stream, uint8_t c);
     int (*seek)(qp_stream_t *stream, int32_t offset, int origin);
     int32_t (*tell)(qp_stream_t *stream);
@@ -83,3 +85,43 @@ typedef struct qp_file_stream_t {
 qp_file_stream_t qp_make_file_stream(FILE *f);
 
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// External flash streams
+
+#ifdef QUANTUM_PAINTER_FLASH_ENABLE
+
+typedef struct qp_flash_stream_t {
+    qp_stream_t base;
+    uint32_t    address;
+    int32_t     length;
+    int32_t     position;
+    bool        is_eof;
+} qp_flash_stream_t;
+
+// Streams share one read-ahead buffer, which is discarded whenever a stream is made. Images and fonts must therefore be
+// closed and loaded again to pick up rewritten flash contents.
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length);
+
+// Asset index, allowing multiple QGF/QFF files stored in external flash to be addressed by ID
+#    define QP_FLASH_ASSET_INDEX_MAGIC 0x49415051 // "QPAI"
+
+typedef struct QP_PACKED qp_flash_asset_index_v1_t {
+    uint32_t magic;       // QP_FLASH_ASSET_INDEX_MAGIC
+    uint16_t asset_count; // number of qp_flash_asset_entry_v1_t entries following this header
+    uint16_t reserved;
+} qp_flash_asset_index_v1_t;
+
+STATIC_ASSERT(sizeof(qp_flash_asset_index_v1_t) == 8, "qp_flash_asset_index_v1_t must be 8 bytes in v1 of the asset index");
+
+typedef struct QP_PACKED qp_flash_asset_entry_v1_t {
+    uint32_t offset; // offset of the asset, relative to the start of the index
+    uint32_t length; // length of the asset in bytes
+} qp_flash_asset_entry_v1_t;
+
+STATIC_ASSERT(sizeof(qp_flash_asset_entry_v1_t) == 8, "qp_flash_asset_entry_v1_t must be 8 bytes in v1 of the asset index");
+
+// Looks up the flash address, and optionally length, of the asset with the supplied ID
+bool qp_flash_asset_find(uint16_t asset_id, uint32_t *address, uint32_t *length);
+
+#endif // QUANTUM_PAINTER_FLASH_ENABLE
@@ -0,0 +1,24 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Normally provided by ChibiOS, which Quantum Painter's options are written against
+#define TRUE 1
+#define FALSE 0
+
+#define MATRIX_ROWS 1
+#define MATRIX_COLS 1
+
+#define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 64
+#define QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER TRUE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "qp_spi_mock.h"
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,187 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "spi_master.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
+#include "qp_tft_panel.h"
+}
+
+#define DC_PIN 2
+
+// A mock SPI peripheral whose asynchronous transfers stay in flight until something waits for them, as with DMA. The
+// bytes are only clocked out on completion, so a buffer rewritten while in flight puts the wrong data on the wire.
+static struct {
+    const uint8_t       *data;
+    uint16_t             length;
+    std::vector<uint8_t> at_start;
+} in_flight;
+
+static std::vector<uint8_t>         wire;
+static std::vector<const uint8_t *> async_buffers;
+static int                          overwritten_in_flight = 0;
+static int                          dc_toggled_in_flight  = 0;
+
+static void complete_transfer(void) {
+    if (in_flight.data) {
+        if (memcmp(in_flight.data, in_flight.at_start.data(), in_flight.length) != 0) {
+            ++overwritten_in_flight;
+        }
+        wire.insert(wire.end(), in_flight.data, in_flight.data + in_flight.length);
+        in_flight.data = NULL;
+    }
+}
+
+extern "C" {
+void gpio_set_pin_output(pin_t pin) {}
+
+void gpio_write_pin_high(pin_t pin) {
+    if (pin == DC_PIN && in_flight.data) {
+        ++dc_toggled_in_flight;
+    }
+}
+
+void gpio_write_pin_low(pin_t pin) {
+    if (pin == DC_PIN && in_flight.data) {
+        ++dc_toggled_in_flight;
+    }
+}
+
+void wait_ms(uint32_t ms) {}
+
+void spi_init(void) {}
+
+bool spi_start(pin_t slave_pin, bool lsb_first, uint8_t mode, uint16_t divisor) {
+    return true;
+}
+
+spi_status_t spi_transmit_wait(void) {
+    complete_transfer();
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_write(uint8_t data) {
+    complete_transfer();
+    wire.push_back(data);
+    return data;
+}
+
+spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    complete_transfer();
+    wire.insert(wire.end(), data, data + length);
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    complete_transfer();
+    in_flight.data     = data;
+    in_flight.length   = length;
+    in_flight.at_start = std::vector<uint8_t>(data, data + length);
+    async_buffers.push_back(data);
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_stop(void) {
+    complete_transfer();
+}
+}
+
+static const tft_panel_dc_reset_painter_driver_vtable_t test_driver_vtable = {
+    .base =
+        {
+            .pixdata         = qp_tft_panel_pixdata,
+            .palette_convert = qp_tft_panel_palette_convert_rgb565_swapped,
+            .append_pixels   = qp_tft_panel_append_pixels_rgb565,
+            .append_pixdata  = qp_tft_panel_append_pixdata,
+        },
+};
+
+// Counts up from the start value, noting how many bytes were decoded while a transfer was in flight
+typedef struct {
+    uint8_t  next;
+    uint32_t decoded_in_flight;
+} test_input_state_t;
+
+static int16_t test_input(void *cb_arg) {
+    test_input_state_t *state = (test_input_state_t *)cb_arg;
+    if (in_flight.data) {
+        ++state->decoded_in_flight;
+    }
+    return state->next++;
+}
+
+class PixdataDoubleBuffer : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        in_flight.data = NULL;
+        wire.clear();
+        async_buffers.clear();
+        overwritten_in_flight = 0;
+        dc_toggled_in_flight  = 0;
+
+        memset(&device, 0, sizeof(device));
+        device.base.driver_vtable                             = (const painter_driver_vtable_t *)&test_driver_vtable;
+        device.base.comms_vtable                              = (const painter_comms_vtable_t *)&spi_comms_with_dc_vtable;
+        device.base.validate_ok                               = true;
+        device.base.native_bits_per_pixel                     = 16;
+        device.base.comms_config                              = &device.spi_dc_reset_config;
+        device.spi_dc_reset_config.dc_pin                     = DC_PIN;
+        device.spi_dc_reset_config.spi_config.chip_select_pin = 1;
+    }
+
+    tft_panel_dc_reset_painter_device_t device;
+};
+
+TEST_F(PixdataDoubleBuffer, flushes_alternate_buffers_without_overwriting_in_flight_data) {
+    // Two and a half buffers of native pixels
+    const uint32_t     pixel_count = QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 5 / 4;
+    test_input_state_t input       = {0, 0};
+
+    EXPECT_TRUE(qp_comms_start(&device));
+    EXPECT_TRUE(qp_internal_appender(&device, 16, pixel_count, test_input, &input));
+
+    // The last flush is still in flight until comms stop
+    EXPECT_NE(in_flight.data, nullptr);
+    qp_comms_stop(&device);
+    EXPECT_EQ(in_flight.data, nullptr);
+
+    ASSERT_EQ(async_buffers.size(), 3);
+    EXPECT_NE(async_buffers[0], async_buffers[1]);
+    EXPECT_EQ(async_buffers[0], async_buffers[2]);
+
+    // Decoding of the next buffer overlapped each transfer, yet no buffer was touched before its transfer completed
+    EXPECT_GT(input.decoded_in_flight, 0);
+    EXPECT_EQ(overwritten_in_flight, 0);
+
+    ASSERT_EQ(wire.size(), pixel_count * 2);
+    for (size_t i = 0; i < wire.size(); ++i) {
+        EXPECT_EQ(wire[i], (uint8_t)i) << "at byte " << i;
+    }
+}
+
+TEST_F(PixdataDoubleBuffer, commands_wait_for_in_flight_pixdata) {
+    const uint32_t     pixel_count = QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE / 2;
+    test_input_state_t input       = {0, 0};
+    uint8_t            params[2]   = {0xA5, 0x5A};
+
+    EXPECT_TRUE(qp_comms_start(&device));
+    EXPECT_TRUE(qp_internal_appender(&device, 16, pixel_count, test_input, &input));
+    EXPECT_NE(in_flight.data, nullptr);
+
+    // Neither the D/C pin nor the bytes on the wire change until the pixdata has gone out
+    qp_comms_command_databuf(&device, 0x2C, params, sizeof(params));
+    EXPECT_EQ(dc_toggled_in_flight, 0);
+    qp_comms_stop(&device);
+
+    ASSERT_EQ(wire.size(), pixel_count * 2 + 3);
+    for (size_t i = 0; i < pixel_count * 2; ++i) {
+        EXPECT_EQ(wire[i], (uint8_t)i) << "at byte " << i;
+    }
+    EXPECT_EQ(wire[pixel_count * 2 + 0], 0x2C);
+    EXPECT_EQ(wire[pixel_count * 2 + 1], 0xA5);
+    EXPECT_EQ(wire[pixel_count * 2 + 2], 0x5A);
+}
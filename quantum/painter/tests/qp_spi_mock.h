@@ -0,0 +1,13 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint8_t pin_t;
+
+void gpio_set_pin_output(pin_t pin);
+void gpio_write_pin_high(pin_t pin);
+void gpio_write_pin_low(pin_t pin);
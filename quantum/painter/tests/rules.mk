@@ -0,0 +1,13 @@
+qp_pixdata_double_buffer_DEFS := -DQUANTUM_PAINTER_ENABLE -DQUANTUM_PAINTER_SPI_ENABLE -DQUANTUM_PAINTER_SPI_DC_RESET_ENABLE
+qp_pixdata_double_buffer_INC := $(QUANTUM_PATH)/painter/tests $(QUANTUM_PATH)/painter $(DRIVER_PATH)/painter/comms $(DRIVER_PATH)/painter/tft_panel
+qp_pixdata_double_buffer_CONFIG := $(QUANTUM_PATH)/painter/tests/config_pixdata_double_buffer.h
+
+qp_pixdata_double_buffer_SRC := \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/painter/qp_comms.c \
+	$(QUANTUM_PATH)/painter/qp_draw_codec.c \
+	$(QUANTUM_PATH)/painter/qp_draw_core.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c \
+	$(DRIVER_PATH)/painter/comms/qp_comms_spi.c \
+	$(DRIVER_PATH)/painter/tft_panel/qp_tft_panel.c \
+	$(QUANTUM_PATH)/painter/tests/qp_pixdata_double_buffer_tests.cpp
@@ -0,0 +1 @@
+TEST_LIST += qp_pixdata_double_buffer
@@ -273,7 +273,14 @@ __attribute__((weak)) bool pointing_device_task(void) {
     };
 #endif
 
-#if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
+#if defined(POINTING_DEVICE_TASK_THROTTLE_US)
+    // For sensors read faster than once a millisecond, e.g. to keep up with high-speed USB
+    static uint32_t last_exec = 0;
+    if (timer_read_us() - last_exec < POINTING_DEVICE_TASK_THROTTLE_US) {
+        return false;
+    }
+    last_exec = timer_read_us();
+#elif (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
     if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
         return false;
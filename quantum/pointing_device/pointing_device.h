@@ -130,7 +130,7 @@ uint16_t pointing_device_get_hires_scroll_resolution(void);
 #if defined(SPLIT_POINTING_ENABLE)
 void     pointing_device_set_shared_report(report_mouse_t report);
 uint16_t pointing_device_get_shared_cpi(void);
-#    if !defined(POINTING_DEVICE_TASK_THROTTLE_MS)
+#    if !defined(POINTING_DEVICE_TASK_THROTTLE_MS) && !defined(POINTING_DEVICE_TASK_THROTTLE_US)
 #        define POINTING_DEVICE_TASK_THROTTLE_MS 1
 #    endif
 #    if defined(POINTING_DEVICE_COMBINED)
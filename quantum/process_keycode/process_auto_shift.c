@@ -17,6 +17,7 @@
 #include "process_auto_shift.h"
 #include "quantum.h"
 #include "action_util.h"
+#include "deadline.h"
 #include "timer.h"
 #include "keycodes.h"
 
@@ -61,6 +62,23 @@ static struct {
 } autoshift_flags = {AUTO_SHIFT_STARTUP_STATE, false, false, false, false, false};
 // clang-format on
 
+/** \brief Schedules autoshift_matrix_scan() for the moment the key in progress times out */
+static void autoshift_schedule_deadline(void) {
+    if (!autoshift_flags.in_progress) {
+        deadline_clear(DEADLINE_AUTO_SHIFT);
+        return;
+    }
+    // clang-format off
+    deadline_set(DEADLINE_AUTO_SHIFT, autoshift_time +
+#ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
+        get_autoshift_timeout(autoshift_lastkey, &autoshift_lastrecord)
+#else
+        autoshift_timeout
+#endif
+    );
+    // clang-format on
+}
+
 /** \brief Called on physical press, returns whether key should be added to Auto Shift */
 __attribute__((weak)) bool get_custom_auto_shifted_key(uint16_t keycode, keyrecord_t *record) {
     return false;
@@ -223,6 +241,7 @@ static bool autoshift_press(uint16_t keycode, uint16_t now, keyrecord_t *record)
     autoshift_lastkey           = keycode;
     autoshift_time              = now;
     autoshift_flags.in_progress = true;
+    autoshift_schedule_deadline();
 
 #if !defined(NO_ACTION_ONESHOT) && !defined(NO_ACTION_TAPPING)
     clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
@@ -298,6 +317,7 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
     }
     // Roll the autoshift_time forward for detecting tap-and-hold.
     autoshift_time = now;
+    autoshift_schedule_deadline();
 }
 
 /** \brief Simulates auto-shifted key releases when timeout is hit
@@ -307,7 +327,12 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
  *  to be released.
  */
 void autoshift_matrix_scan(void) {
+    // With AUTO_SHIFT_TIMEOUT_PER_KEY, get_autoshift_timeout() can return a different timeout at any time, so it is checked on every scan as before
+#ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
     if (autoshift_flags.in_progress) {
+#else
+    if (autoshift_flags.in_progress && deadline_expired(DEADLINE_AUTO_SHIFT)) {
+#endif
         const uint16_t now = timer_read();
         if (TIMER_DIFF_16(now, autoshift_time) >=
 #ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
@@ -317,6 +342,8 @@ void autoshift_matrix_scan(void) {
 #endif
         ) {
             autoshift_end(autoshift_lastkey, now, true, &autoshift_lastrecord);
+        } else {
+            autoshift_schedule_deadline();
         }
     }
 }
@@ -361,6 +388,7 @@ __attribute__((weak)) uint16_t get_autoshift_timeout(uint16_t keycode, keyrecord
 
 void set_autoshift_timeout(uint16_t timeout) {
     autoshift_timeout = timeout;
+    autoshift_schedule_deadline();
 }
 
 bool process_auto_shift(uint16_t keycode, keyrecord_t *record) {
@@ -497,6 +525,7 @@ void retroshift_poll_time(keyevent_t *event) {
 void retroshift_swap_times(void) {
     if (autoshift_flags.in_progress) {
         autoshift_time = last_retroshift_time;
+        autoshift_schedule_deadline();
     }
 }
 #endif
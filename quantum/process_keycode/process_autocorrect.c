@@ -22,6 +22,38 @@
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
+#ifdef AUTOCORRECT_AUTOMATON
+#    ifdef AUTOCORRECT_AUTOMATON_EXTERNAL_FLASH
+#        include "flash.h"
+#        ifndef AUTOCORRECT_AUTOMATON_FLASH_ADDRESS
+#            define AUTOCORRECT_AUTOMATON_FLASH_ADDRESS 0
+#        endif
+#        ifndef AUTOCORRECT_AUTOMATON_CORRECTION_SIZE
+#            define AUTOCORRECT_AUTOMATON_CORRECTION_SIZE 32
+#        endif
+#    endif
+
+// a-z, ' and word break, in the order used by the generator
+#    define AUTOCORRECT_AUTOMATON_SYMBOLS 28
+#    define AUTOCORRECT_AUTOMATON_ROW_SIZE ((1 + AUTOCORRECT_AUTOMATON_SYMBOLS) * AUTOCORRECT_AUTOMATON_WORD_SIZE)
+#    define AUTOCORRECT_AUTOMATON_TERMINAL ((uint32_t)1 << (AUTOCORRECT_AUTOMATON_WORD_SIZE * 8 - 1))
+
+#    if AUTOCORRECT_AUTOMATON_WORD_SIZE == 2
+typedef uint16_t autocorrect_state_t;
+#    else
+typedef uint32_t autocorrect_state_t;
+#    endif
+
+// The buffer becomes a ring so that dropping the oldest character is O(1).
+// Each entry records the automaton state reached after typing it, which makes
+// backspace a matter of stepping back one entry.
+static autocorrect_state_t typo_states[AUTOCORRECT_MAX_LENGTH] = {AUTOCORRECT_AUTOMATON_START};
+static uint8_t             typo_buffer_start                   = 0;
+#    define TYPO_BUFFER_INDEX(i) ((uint8_t)(typo_buffer_start + (i)) % AUTOCORRECT_MAX_LENGTH)
+#else
+#    define TYPO_BUFFER_INDEX(i) (i)
+#endif
+
 /**
  * @brief function for querying the enabled state of autocorrect
  *
@@ -189,6 +221,133 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+#ifdef AUTOCORRECT_AUTOMATON
+/**
+ * @brief reads a little endian word of the autocorrect automaton
+ *
+ * @param offset byte offset into the automaton data
+ * @return uint32_t value of the word
+ */
+static uint32_t autocorrect_automaton_read(uint32_t offset) {
+    uint8_t word[AUTOCORRECT_AUTOMATON_WORD_SIZE];
+#    ifdef AUTOCORRECT_AUTOMATON_EXTERNAL_FLASH
+    flash_init_once();
+    flash_read_range(AUTOCORRECT_AUTOMATON_FLASH_ADDRESS + offset, word, sizeof(word));
+#    else
+    for (uint8_t i = 0; i < sizeof(word); ++i) {
+        word[i] = pgm_read_byte(autocorrect_data + offset + i);
+    }
+#    endif
+
+    uint32_t value = 0;
+    for (int8_t i = sizeof(word) - 1; i >= 0; --i) {
+        value = value << 8 | word[i];
+    }
+    return value;
+}
+
+/**
+ * @brief maps a buffered keycode to its column in the automaton transition rows
+ *
+ * @param keycode KC_A to KC_Z, KC_QUOTE or KC_SPC
+ * @return uint8_t symbol index
+ */
+static inline uint8_t autocorrect_automaton_symbol(uint16_t keycode) {
+    switch (keycode) {
+        case KC_QUOTE:
+            return 26;
+        case KC_SPC:
+            return 27;
+        default:
+            return keycode - KC_A;
+    }
+}
+#endif
+
+/**
+ * @brief types the correction for the typo that ends the buffer
+ *
+ * @param backspaces number of characters to remove
+ * @param changes pointer to PROGMEM string to replace mistyped seletion with,
+ *        or to a RAM copy when the automaton lives in external flash
+ * @param keycode the keycode that completed the typo
+ * @return true Continue processing keycodes, and send to host
+ * @return false Stop processing keycodes, and don't send to host
+ */
+static bool autocorrect_correct_typo(uint8_t backspaces, const char *changes, uint16_t keycode) {
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    uint8_t typo_start = 0;
+    bool    space_last = typo_buffer[TYPO_BUFFER_INDEX(typo_buffer_size - 1)] == KC_SPC;
+    for (uint8_t i = typo_buffer_size; i > 0; --i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (typo_buffer[TYPO_BUFFER_INDEX(i - 1)] == KC_SPC && i != typo_buffer_size) {
+            typo_start = i;
+            break;
+        }
+
+        ++typo_len;
+    }
+
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
+
+    // convert buffer of keycodes into a string
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = typo_buffer[TYPO_BUFFER_INDEX(typo_start + i)] - KC_A + 'a';
+    }
+
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+#ifdef AUTOCORRECT_AUTOMATON_EXTERNAL_FLASH
+    strcpy(correct + typo_len - offset, changes);
+#else
+    strcpy_P(correct + typo_len - offset, changes);
+#endif
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
+        }
+#ifdef AUTOCORRECT_AUTOMATON_EXTERNAL_FLASH
+        send_string(changes);
+#else
+        send_string_P(changes);
+#endif
+    }
+
+    if (keycode == KC_SPC) {
+#ifdef AUTOCORRECT_AUTOMATON
+        typo_buffer_start = 0;
+        typo_states[0]    = AUTOCORRECT_AUTOMATON_START;
+#endif
+        typo_buffer[0]   = KC_SPC;
+        typo_buffer_size = 1;
+        return true;
+    } else {
+        typo_buffer_size = 0;
+        return false;
+    }
+}
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -266,6 +425,38 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
             return true;
     }
 
+#ifdef AUTOCORRECT_AUTOMATON
+    // Drop oldest character if buffer is full, the automaton state already
+    // carries all the context needed to find a match.
+    if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
+        typo_buffer_start = TYPO_BUFFER_INDEX(1);
+        typo_buffer_size  = AUTOCORRECT_MAX_LENGTH - 1;
+    }
+
+    // Advance the automaton by a single transition from the last state.
+    autocorrect_state_t state = typo_buffer_size ? typo_states[TYPO_BUFFER_INDEX(typo_buffer_size - 1)] : 0;
+    uint32_t            next  = autocorrect_automaton_read(state * (uint32_t)AUTOCORRECT_AUTOMATON_ROW_SIZE + (1 + autocorrect_automaton_symbol(keycode)) * AUTOCORRECT_AUTOMATON_WORD_SIZE);
+
+    typo_buffer[TYPO_BUFFER_INDEX(typo_buffer_size)] = keycode;
+    typo_states[TYPO_BUFFER_INDEX(typo_buffer_size)] = next & ~AUTOCORRECT_AUTOMATON_TERMINAL;
+    ++typo_buffer_size;
+
+    if (!(next & AUTOCORRECT_AUTOMATON_TERMINAL)) {
+        return true;
+    }
+
+    // A typo was found! Look up the correction record of the matching state.
+    uint32_t output = autocorrect_automaton_read((next & ~AUTOCORRECT_AUTOMATON_TERMINAL) * (uint32_t)AUTOCORRECT_AUTOMATON_ROW_SIZE);
+#    ifdef AUTOCORRECT_AUTOMATON_EXTERNAL_FLASH
+    char changes[AUTOCORRECT_AUTOMATON_CORRECTION_SIZE + 1] = {0};
+    flash_read_range(AUTOCORRECT_AUTOMATON_FLASH_ADDRESS + output, changes, AUTOCORRECT_AUTOMATON_CORRECTION_SIZE);
+    const uint8_t backspaces = (changes[0] & 63) + !record->event.pressed;
+    return autocorrect_correct_typo(backspaces, changes + 1, keycode);
+#    else
+    const uint8_t backspaces = (pgm_read_byte(autocorrect_data + output) & 63) + !record->event.pressed;
+    return autocorrect_correct_typo(backspaces, (const char *)(autocorrect_data + output + 1), keycode);
+#    endif
+#else
     // Rotate oldest character if buffer is full.
     if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
         memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
@@ -311,66 +502,9 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
             const uint8_t backspaces = (code & 63) + !record->event.pressed;
             const char *  changes    = (const char *)(autocorrect_data + state + 1);
 
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
-
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
-
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
-
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+            return autocorrect_correct_typo(backspaces, changes, keycode);
         }
     }
     return true;
+#endif
 }
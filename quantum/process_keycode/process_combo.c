@@ -19,6 +19,7 @@
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
+#include "deadline.h"
 #include "wait.h"
 #include "keyboard.h"
 #include "keymap_common.h"
@@ -177,6 +178,17 @@ static inline bool _get_combo_must_hold(uint16_t combo_index, combo_t *combo) {
     return false;
 }
 
+#ifndef COMBO_NO_TIMER
+/* Schedules combo_task() for the moment the buffered keys and combos time out. */
+static inline void combo_schedule_deadline(void) {
+    if (timer) {
+        deadline_set(DEADLINE_COMBO, timer + longest_term + 1);
+    } else {
+        deadline_clear(DEADLINE_COMBO);
+    }
+}
+#endif
+
 static inline uint16_t _get_wait_time(uint16_t combo_index, combo_t *combo) {
     if (_get_combo_must_hold(combo_index, combo)
 #ifdef COMBO_MUST_TAP_PER_COMBO
@@ -624,6 +636,9 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
             clear_combos();
         }
     }
+#ifndef COMBO_NO_TIMER
+    combo_schedule_deadline();
+#endif
     return !is_combo_key;
 }
 
@@ -633,6 +648,10 @@ void combo_task(void) {
     }
 
 #ifndef COMBO_NO_TIMER
+    if (!deadline_expired(DEADLINE_COMBO)) {
+        return;
+    }
+
     if (timer && timer_elapsed(timer) > longest_term) {
         if (combo_buffer_read != combo_buffer_write) {
             apply_combos();
@@ -644,6 +663,7 @@ void combo_task(void) {
             clear_combos();
         }
     }
+    combo_schedule_deadline();
 #endif
 }
 
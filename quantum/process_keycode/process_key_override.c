@@ -84,6 +84,13 @@ static uint16_t deferred_register = 0;
 // TODO: in future maybe save in EEPROM?
 static bool enabled = true;
 
+#ifndef KEY_OVERRIDE_NO_INDEX
+// Key override indices sorted by trigger, so that an event only inspects the overrides it could possibly activate. Ties keep their original order, which is also the activation priority. Built on first use.
+static uint8_t *trigger_index       = NULL;
+static uint8_t  trigger_index_count = 0;
+static bool     trigger_index_valid = false;
+#endif
+
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
@@ -243,151 +250,283 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
-static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
-    if (key_override_count() == 0) {
-        return true;
+/** Checks everything required to activate the provided override, except for it already being the active one. */
+static bool can_activate_override(const key_override_t *override, const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+    // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
+    if (active_mods == 0 && override->trigger_mods != 0) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
     }
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
-        const key_override_t *const override = key_override_get(i);
+    // Check layer
+    if ((override->layers & (1 << layer)) == 0) {
+        key_override_printf("Not activating override: Not set to activate on pressed layer\n");
+        return false;
+    }
 
-        // End of array
-        if (override == NULL) {
-            break;
-        }
+    // Check allowed activation events
+    if (!check_activation_event(override, key_down, is_mod)) {
+        key_override_printf("Not activating override: Activation event not allowed\n");
+        return false;
+    }
 
-        // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
-        if (active_mods == 0 && override->trigger_mods != 0) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    const bool is_trigger = override->trigger == keycode;
 
-        // Check layer
-        if ((override->layers & (1 << layer)) == 0) {
-            key_override_printf("Not activating override: Not set to activate on pressed layer\n");
-            continue;
-        }
+    // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
+    if (is_trigger && !key_down) {
+        key_override_printf("Not activating override: Trigger lifted\n");
+        return false;
+    }
 
-        // Check allowed activation events
-        if (!check_activation_event(override, key_down, is_mod)) {
-            key_override_printf("Not activating override: Activation event not allowed\n");
-            continue;
-        }
+    // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
+    const bool no_trigger = override->trigger == KC_NO;
 
-        const bool is_trigger = override->trigger == keycode;
+    // Check if aleady active
+    if (override == active_override) {
+        key_override_printf("Not activating override: Alerady actived\n");
+        return false;
+    }
 
-        // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
-        if (is_trigger && !key_down) {
-            key_override_printf("Not activating override: Trigger lifted\n");
-            continue;
-        }
+    // Check if enabled
+    if (override->enabled != NULL && !((*(override->enabled) & 1))) {
+        key_override_printf("Not activating override: Not enabled\n");
+        return false;
+    }
 
-        // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
-        const bool no_trigger = override->trigger == KC_NO;
+    // Check mods precisely
+    if (!key_override_matches_active_modifiers(override, active_mods)) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
+    }
 
-        // Check if aleady active
-        if (override == active_override) {
-            key_override_printf("Not activating override: Alerady actived\n");
-            continue;
-        }
+    // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
+    // If no trigger key is required, yes.
+    // If the trigger was just pressed, yes.
+    // If the last non-mod key that was pressed down is the trigger key, yes.
+    bool should_activate = no_trigger || (is_trigger && key_down) || last_key_down == override->trigger;
 
-        // Check if enabled
-        if (override->enabled != NULL && !((*(override->enabled) & 1))) {
-            key_override_printf("Not activating override: Not enabled\n");
-            continue;
-        }
-
-        // Check mods precisely
-        if (!key_override_matches_active_modifiers(override, active_mods)) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    if (!should_activate) {
+        key_override_printf("Not activating override. Trigger not down\n");
+        return false;
+    }
 
-        // Check if trigger key is down.
-        const bool trigger_down = is_trigger && key_down;
+    return true;
+}
 
-        // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
-        // If no trigger key is required, yes.
-        // If the trigger was just pressed, yes.
-        // If the last non-mod key that was pressed down is the trigger key, yes.
-        bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
+/** Activates the provided override. Returns true if the key action for `keycode` should be sent */
+static bool activate_override(const key_override_t *override, const uint16_t keycode, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+    const bool no_trigger = override->trigger == KC_NO;
 
-        if (!should_activate) {
-            key_override_printf("Not activating override. Trigger not down\n");
-            continue;
-        }
+    // Check if trigger key is down.
+    const bool trigger_down = override->trigger == keycode && key_down;
 
-        key_override_printf("Activating override\n");
+    key_override_printf("Activating override\n");
 
-        clear_active_override(false);
+    clear_active_override(false);
 
 #ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
-        // Send a dummy keycode before unregistering the modifier(s)
-        // so that suppressing the modifier(s) doesn't falsely get interpreted
-        // by the host OS as a tap of a modifier key.
-        // For example, unintended activations of the start menu on Windows when
-        // using a GUI+<kc> key override with suppressed mods.
-        neutralize_flashing_modifiers(active_mods);
+    // Send a dummy keycode before unregistering the modifier(s)
+    // so that suppressing the modifier(s) doesn't falsely get interpreted
+    // by the host OS as a tap of a modifier key.
+    // For example, unintended activations of the start menu on Windows when
+    // using a GUI+<kc> key override with suppressed mods.
+    neutralize_flashing_modifiers(active_mods);
 #endif
 
-        active_override                 = override;
-        active_override_trigger_is_down = true;
+    active_override                 = override;
+    active_override_trigger_is_down = true;
 
-        set_suppressed_override_mods(override->suppressed_mods);
+    set_suppressed_override_mods(override->suppressed_mods);
 
-        if (!trigger_down && !no_trigger) {
-            // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
-            if (IS_BASIC_KEYCODE(override->trigger)) {
-                del_key(override->trigger);
+    if (!trigger_down && !no_trigger) {
+        // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
+        if (IS_BASIC_KEYCODE(override->trigger)) {
+            del_key(override->trigger);
+        } else {
+            unregister_code(override->trigger);
+        }
+    }
+
+    const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
+
+    bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
+                                mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+
+    // Try firing the custom handler
+    if (override->custom_action != NULL) {
+        register_replacement &= override->custom_action(true, override->context);
+    }
+
+    if (register_replacement) {
+        const uint8_t override_mods = extract_mod_bits(override->replacement);
+        set_weak_override_mods(override_mods);
+
+        // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
+        if (is_mod) {
+            key_override_printf("Deferring register replacement key\n");
+            schedule_deferred_register(mod_free_replacement);
+            send_keyboard_report();
+        } else {
+            if (IS_BASIC_KEYCODE(mod_free_replacement)) {
+                add_key(mod_free_replacement);
             } else {
-                unregister_code(override->trigger);
+                key_override_printf("NOT KEY 2\n");
+                send_keyboard_report();
+                // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
+                wait_ms(10);
+                register_code(mod_free_replacement);
             }
         }
+    } else {
+        // If not registering the replacement key send keyboard report to update the unregistered keys.
+        send_keyboard_report();
+    }
+
+    // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
+    return !trigger_down;
+}
+
+#ifndef KEY_OVERRIDE_NO_INDEX
+/** Returns true if `earlier` activates whenever `later` would, so that `later` only ever activates while `earlier` is already active. */
+static bool key_override_shadows(const key_override_t *earlier, const key_override_t *later) {
+    // Same trigger and modifier requirements, the earlier one cannot be switched off, is active on every layer and for every activation event the later one is, and is not blocked by more modifiers.
+    return earlier->trigger == later->trigger && earlier->trigger_mods == later->trigger_mods && (earlier->options & ko_option_one_mod) == (later->options & ko_option_one_mod) && earlier->enabled == NULL && (later->layers & ~earlier->layers) == 0 && (later->options & ko_options_all_activations & ~earlier->options) == 0 && (earlier->negative_mod_mask & ~later->negative_mod_mask) == 0;
+}
+
+/** Returns the first position in the trigger index whose override has a trigger that is not less than `trigger`. */
+static uint8_t trigger_index_lower_bound(const uint16_t trigger) {
+    uint8_t low  = 0;
+    uint8_t high = trigger_index_count;
+
+    while (low < high) {
+        uint8_t mid = low + (high - low) / 2;
+        if (key_override_get(trigger_index[mid])->trigger < trigger) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
 
-        const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
+    return low;
+}
+
+void key_override_reindex(void) {
+    uint16_t count      = key_override_count();
+    trigger_index_valid = false;
 
-        bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
-                                    mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+    // The index lives in storage sized for the overrides in the keymap. Dynamically provided overrides beyond that are scanned linearly.
+    if (count > key_override_count_raw() || count > UINT8_MAX) {
+        key_override_printf("Not indexing key overrides: %u overrides do not fit\n", count);
+        return;
+    }
+
+    trigger_index       = key_override_index_raw();
+    trigger_index_count = 0;
+
+    for (uint8_t i = 0; i < count; i++) {
+        const key_override_t *const override = key_override_get(i);
+
+        // End of array
+        if (override == NULL) {
+            break;
+        }
 
-        // Try firing the custom handler
-        if (override->custom_action != NULL) {
-            register_replacement &= override->custom_action(true, override->context);
+        // Stable insertion sort, this only happens once
+        uint8_t pos = trigger_index_count++;
+        for (; pos > 0 && key_override_get(trigger_index[pos - 1])->trigger > override->trigger; pos--) {
+            trigger_index[pos] = trigger_index[pos - 1];
         }
+        trigger_index[pos] = i;
+    }
 
-        if (register_replacement) {
-            const uint8_t override_mods = extract_mod_bits(override->replacement);
-            set_weak_override_mods(override_mods);
+    // Overrides sharing a trigger are now adjacent, so check each group for overrides that can never activate
+    for (uint8_t group = 0; group < trigger_index_count;) {
+        uint8_t end = group + 1;
+        while (end < trigger_index_count && key_override_get(trigger_index[end])->trigger == key_override_get(trigger_index[group])->trigger) {
+            end++;
+        }
 
-            // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
-            if (is_mod) {
-                key_override_printf("Deferring register replacement key\n");
-                schedule_deferred_register(mod_free_replacement);
-                send_keyboard_report();
-            } else {
-                if (IS_BASIC_KEYCODE(mod_free_replacement)) {
-                    add_key(mod_free_replacement);
-                } else {
-                    key_override_printf("NOT KEY 2\n");
-                    send_keyboard_report();
-                    // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
-                    wait_ms(10);
-                    register_code(mod_free_replacement);
+        for (uint8_t i = group; i < end; i++) {
+            for (uint8_t j = i + 1; j < end; j++) {
+                if (key_override_shadows(key_override_get(trigger_index[i]), key_override_get(trigger_index[j]))) {
+                    dprintf("Key override %u is shadowed by key override %u\n", trigger_index[j], trigger_index[i]);
                 }
             }
-        } else {
-            // If not registering the replacement key send keyboard report to update the unregistered keys.
-            send_keyboard_report();
         }
 
-        *activated = true;
-
-        // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
-        return !trigger_down;
+        group = end;
     }
 
+    trigger_index_valid = true;
+}
+#else
+void key_override_reindex(void) {}
+#endif
+
+/** Tries activating the key overrides that `keycode` could activate, in order, until one activates or none are left. Returns true if the key action for `keycode` should be sent */
+static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
     *activated = false;
 
+    if (key_override_count() == 0) {
+        return true;
+    }
+
+#ifndef KEY_OVERRIDE_NO_INDEX
+    if (!trigger_index_valid) {
+        key_override_reindex();
+    }
+
+    if (trigger_index_valid) {
+        // An override can only activate if it has no trigger, if its trigger is the key of this event, or if its trigger is the last key held down. Walk those (at most three) groups of the index together, in the original override order.
+        const uint16_t triggers[] = {KC_NO, keycode, last_key_down};
+        uint8_t        next[3], end[3];
+
+        for (uint8_t g = 0; g < 3; g++) {
+            next[g] = end[g] = 0;
+            if (g > 0 && (triggers[g] == KC_NO || (g == 2 && triggers[g] == keycode))) {
+                continue;
+            }
+            next[g] = trigger_index_lower_bound(triggers[g]);
+            end[g]  = next[g];
+            while (end[g] < trigger_index_count && key_override_get(trigger_index[end[g]])->trigger == triggers[g]) {
+                end[g]++;
+            }
+        }
+
+        while (true) {
+            int8_t g = -1;
+            for (uint8_t h = 0; h < 3; h++) {
+                if (next[h] < end[h] && (g < 0 || trigger_index[next[h]] < trigger_index[next[g]])) {
+                    g = h;
+                }
+            }
+            if (g < 0) {
+                return true;
+            }
+
+            const key_override_t *const override = key_override_get(trigger_index[next[g]++]);
+            if (can_activate_override(override, keycode, layer, key_down, is_mod, active_mods)) {
+                *activated = true;
+                return activate_override(override, keycode, key_down, is_mod, active_mods);
+            }
+        }
+    }
+#endif
+
+    for (uint8_t i = 0; i < key_override_count(); i++) {
+        const key_override_t *const override = key_override_get(i);
+
+        // End of array
+        if (override == NULL) {
+            break;
+        }
+
+        if (can_activate_override(override, keycode, layer, key_down, is_mod, active_mods)) {
+            *activated = true;
+            return activate_override(override, keycode, key_down, is_mod, active_mods);
+        }
+    }
+
     return true;
 }
 
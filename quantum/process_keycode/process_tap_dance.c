@@ -19,6 +19,7 @@
 #include "action_layer.h"
 #include "action_tapping.h"
 #include "action_util.h"
+#include "deadline.h"
 #include "timer.h"
 #include "wait.h"
 #include "keymap_introspection.h"
@@ -167,6 +168,9 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
                 last_tap_time = timer_read();
                 process_tap_dance_action_on_each_tap(action);
                 active_td = action->state.finished ? 0 : keycode;
+                if (active_td) {
+                    deadline_set(DEADLINE_TAP_DANCE, last_tap_time + GET_TAPPING_TERM(active_td, &(keyrecord_t){}) + 1);
+                }
             } else {
                 process_tap_dance_action_on_each_release(action);
                 if (action->state.finished) {
@@ -186,7 +190,21 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 void tap_dance_task(void) {
     tap_dance_action_t *action;
 
-    if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
+#ifndef TAPPING_TERM_PER_KEY
+    // With TAPPING_TERM_PER_KEY, get_tapping_term() can return a different term at any time, so it is checked on every scan as before
+    if (!deadline_expired(DEADLINE_TAP_DANCE)) return;
+#endif
+
+    // The tapping term may have changed since the last tap, so check it again
+    if (active_td) {
+        const uint16_t term = GET_TAPPING_TERM(active_td, &(keyrecord_t){});
+        if (timer_elapsed(last_tap_time) <= term) {
+            deadline_set(DEADLINE_TAP_DANCE, last_tap_time + term + 1);
+            return;
+        }
+    }
+    deadline_clear(DEADLINE_TAP_DANCE);
+    if (!active_td) return;
 
     action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
     if (!action->state.interrupted) {
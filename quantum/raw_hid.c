@@ -1,9 +1,24 @@
 // Copyright 2025 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <stddef.h>
+#include <string.h>
 #include "raw_hid.h"
 #include "host.h"
 
+// Size of every report in both directions, as RAW_EPSIZE
+#define RAW_HID_REPORT_SIZE 32
+
+typedef struct {
+    uint8_t           command_id;
+    raw_hid_handler_t handler;
+} raw_hid_handler_entry_t;
+
+static raw_hid_handler_entry_t handlers[RAW_HID_HANDLER_COUNT];
+
+static raw_hid_stream_t stream_callback = NULL;
+static void            *stream_context  = NULL;
+
 void raw_hid_send(uint8_t *data, uint8_t length) {
     host_raw_hid_send(data, length);
 }
@@ -13,3 +28,78 @@ __attribute__((weak)) void raw_hid_receive(uint8_t *data, uint8_t length) {
     // and implement this function there. Leave this as weak linkage
     // so users can opt to not handle data coming in.
 }
+
+__attribute__((weak)) bool raw_hid_send_ready(void) {
+    return true;
+}
+
+static raw_hid_handler_entry_t *find_handler(uint8_t command_id) {
+    for (uint8_t i = 0; i < RAW_HID_HANDLER_COUNT; i++) {
+        if (handlers[i].handler && handlers[i].command_id == command_id) {
+            return &handlers[i];
+        }
+    }
+    return NULL;
+}
+
+bool raw_hid_register_handler(uint8_t command_id, raw_hid_handler_t handler) {
+    raw_hid_handler_entry_t *entry = find_handler(command_id);
+
+    for (uint8_t i = 0; !entry && handler && i < RAW_HID_HANDLER_COUNT; i++) {
+        if (!handlers[i].handler) {
+            entry = &handlers[i];
+        }
+    }
+
+    // Removing a handler which was never registered is not an error
+    if (!entry) {
+        return !handler;
+    }
+
+    entry->command_id = command_id;
+    entry->handler    = handler;
+    return true;
+}
+
+void raw_hid_dispatch(uint8_t *data, uint8_t length) {
+    raw_hid_handler_entry_t *entry = find_handler(data[0]);
+
+    if (!entry) {
+        raw_hid_receive(data, length);
+        return;
+    }
+
+    if (entry->handler(data, length)) {
+        raw_hid_send(data, length);
+    }
+}
+
+bool raw_hid_stream(raw_hid_stream_t callback, void *context) {
+    if (stream_callback) {
+        return false;
+    }
+
+    stream_callback = callback;
+    stream_context  = context;
+    return true;
+}
+
+void raw_hid_stream_task(void) {
+    if (!stream_callback || !raw_hid_send_ready()) {
+        return;
+    }
+
+    uint8_t report[RAW_HID_REPORT_SIZE] = {0};
+
+    raw_hid_stream_state_t state = stream_callback(report, sizeof(report), stream_context);
+    if (state == RAW_HID_STREAM_WAIT) {
+        return;
+    }
+
+    if (state == RAW_HID_STREAM_END) {
+        stream_callback = NULL;
+        stream_context  = NULL;
+    }
+
+    raw_hid_send(report, sizeof(report));
+}
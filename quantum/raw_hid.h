@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /**
@@ -28,4 +29,67 @@ void raw_hid_receive(uint8_t *data, uint8_t length);
  */
 void raw_hid_send(uint8_t *data, uint8_t length);
 
+#ifndef RAW_HID_HANDLER_COUNT
+#    define RAW_HID_HANDLER_COUNT 4
+#endif
+
+/**
+ * \brief Handler for reports whose first byte is a registered command ID.
+ *
+ * The report may be modified in place, and is only valid until the handler returns.
+ *
+ * \param data A pointer to the received data. Always 32 bytes in length.
+ * \param length The length of the buffer. Always 32.
+ *
+ * \return true to send `data` back to the host as the reply, false if the handler replies itself or with `raw_hid_stream()`.
+ */
+typedef bool (*raw_hid_handler_t)(uint8_t *data, uint8_t length);
+
+/**
+ * \brief Route reports for a command ID to a handler instead of `raw_hid_receive()`.
+ *
+ * \param command_id The first byte of the reports to handle.
+ * \param handler The handler, or `NULL` to remove the handler for this command ID.
+ *
+ * \return false if `RAW_HID_HANDLER_COUNT` handlers are already registered.
+ */
+bool raw_hid_register_handler(uint8_t command_id, raw_hid_handler_t handler);
+
+/**
+ * \brief Pass a report received from the host to its handler, or to `raw_hid_receive()`. Called by the USB protocol.
+ */
+void raw_hid_dispatch(uint8_t *data, uint8_t length);
+
+typedef enum {
+    RAW_HID_STREAM_WAIT, // Nothing to send yet, call again later
+    RAW_HID_STREAM_SEND, // Send the report, then call again for the next one
+    RAW_HID_STREAM_END,  // Send the report, which is the last one
+} raw_hid_stream_state_t;
+
+/**
+ * \brief Callback filling in the next report of a stream.
+ *
+ * \param data A buffer for the report, cleared before each call.
+ * \param length The length of the buffer. Always 32.
+ * \param context The context passed to `raw_hid_stream()`.
+ */
+typedef raw_hid_stream_state_t (*raw_hid_stream_t)(uint8_t *data, uint8_t length, void *context);
+
+/**
+ * \brief Send a deferred reply, or a reply spanning several reports, from the main loop.
+ *
+ * The callback is invoked at most once per main loop iteration, and only once the previous report has been taken by
+ * the host, so a long reply never holds up scanning.
+ *
+ * \return false if a stream is already in progress.
+ */
+bool raw_hid_stream(raw_hid_stream_t callback, void *context);
+
+/**
+ * \brief Whether a report can be sent without waiting for the host. Implemented by the USB protocol.
+ */
+bool raw_hid_send_ready(void);
+
+void raw_hid_stream_task(void);
+
 /** \} */
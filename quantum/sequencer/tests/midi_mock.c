@@ -15,6 +15,7 @@
  */
 
 #include "midi_mock.h"
+#include "midi/midi_tx_queue.h"
 
 uint16_t last_noteon  = 0;
 uint16_t last_noteoff = 0;
@@ -25,8 +26,14 @@ uint16_t midi_compute_note(uint16_t keycode) {
 
 void process_midi_basic_noteon(uint16_t note) {
     last_noteon = note;
+
+    midi_tx_packet_t packet = {.event = 0x09, .data = {0x90, note & 0x7F, 127}};
+    midi_tx_queue_push(&packet);
 }
 
 void process_midi_basic_noteoff(uint16_t note) {
     last_noteoff = note;
+
+    midi_tx_packet_t packet = {.event = 0x08, .data = {0x80, note & 0x7F, 0}};
+    midi_tx_queue_push(&packet);
 }
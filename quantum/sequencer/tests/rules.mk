@@ -8,5 +8,6 @@ sequencer_SRC := \
 	$(QUANTUM_PATH)/sequencer/tests/midi_mock.c \
 	$(QUANTUM_PATH)/sequencer/tests/sequencer_tests.cpp \
 	$(QUANTUM_PATH)/sequencer/sequencer.c \
+	$(QUANTUM_PATH)/midi/midi_tx_queue.c \
 	$(PLATFORM_PATH)/timer.c \
 	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
@@ -16,10 +16,14 @@
 
 #include "gtest/gtest.h"
 
+#include <queue>
+
 extern "C" {
 #include "sequencer.h"
 #include "midi_mock.h"
+#include "midi/midi_tx_queue.h"
 #include "quantum/quantum_keycodes.h"
+#include "timer.h"
 }
 
 extern "C" {
@@ -50,6 +54,7 @@ class SequencerTest : public ::testing::Test {
 
         last_noteon  = 0;
         last_noteoff = 0;
+        midi_tx_queue_clear();
 
         set_time(0);
     }
@@ -590,3 +595,47 @@ TEST_F(SequencerTest, TestMatrixScanSequencerShouldLoopOnceSequenceIsOver) {
     EXPECT_EQ(sequencer_internal_state.current_track, 1);
     EXPECT_EQ(sequencer_internal_state.phase, SEQUENCER_PHASE_ATTACK);
 }
+
+TEST_F(SequencerTest, TestMidiQueueKeepsNoteJitterBoundedUnderControlChangeFlood) {
+    setUpMatrixScanSequencerTest();
+
+    for (int i = 0; i < SEQUENCER_STEPS; i++) {
+        sequencer_config.steps[i] = (1 << SEQUENCER_TRACKS) - 1;
+    }
+
+    std::queue<uint16_t> note_times;
+    uint16_t             max_latency = 0;
+    int                  notes_sent  = 0;
+
+    // Two full loops of the sequence, one scan and one USB frame per millisecond
+    for (int ms = 0; ms < 2 * SEQUENCER_STEPS * 125; ms++) {
+        uint8_t queued = midi_tx_queue_length();
+        sequencer_task();
+        for (uint8_t i = queued; i < midi_tx_queue_length(); i++) {
+            note_times.push(timer_read());
+        }
+
+        // A two axis encoder spinning fast enough to send more than a transfer's worth of updates per scan
+        for (uint8_t i = 0; i < 2 * MIDI_TX_BATCH_SIZE; i++) {
+            midi_tx_packet_t cc = {.event = 0x0B, .data = {0xB0, (uint8_t)(16 + i % 2), (uint8_t)(i & 0x7F)}};
+            ASSERT_TRUE(midi_tx_queue_push(&cc));
+        }
+
+        midi_tx_packet_t transfer[MIDI_TX_BATCH_SIZE];
+        uint8_t          count = midi_tx_queue_pop(transfer, MIDI_TX_BATCH_SIZE);
+        for (uint8_t i = 0; i < count; i++) {
+            if ((transfer[i].event & 0x0F) == 0x09 || (transfer[i].event & 0x0F) == 0x08) {
+                ASSERT_FALSE(note_times.empty());
+                max_latency = std::max<uint16_t>(max_latency, timer_elapsed(note_times.front()));
+                note_times.pop();
+                notes_sent++;
+            }
+        }
+
+        advance_time(1);
+    }
+
+    EXPECT_EQ(notes_sent, 2 * 2 * SEQUENCER_STEPS * SEQUENCER_TRACKS);
+    EXPECT_TRUE(note_times.empty());
+    EXPECT_EQ(max_latency, 0);
+}
@@ -235,6 +235,20 @@ bool is_transport_connected(void) {
     return connection_errors < SPLIT_MAX_CONNECTION_ERRORS;
 }
 
+// Fallback implementation for transports which can't run in the background
+__attribute__((weak)) void transport_master_start(matrix_row_t master_matrix[]) {}
+
+void transport_master_start_if_connected(matrix_row_t master_matrix[]) {
+#if SPLIT_MAX_CONNECTION_ERRORS > 0 && SPLIT_CONNECTION_CHECK_TIMEOUT > 0
+    // Leave reconnection attempts to transport_master_if_connected(), which throttles them
+    if (!is_transport_connected()) {
+        return;
+    }
+#endif // SPLIT_MAX_CONNECTION_ERRORS > 0 && SPLIT_CONNECTION_CHECK_TIMEOUT > 0
+
+    transport_master_start(master_matrix);
+}
+
 bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
 #if SPLIT_MAX_CONNECTION_ERRORS > 0 && SPLIT_CONNECTION_CHECK_TIMEOUT > 0
     // Throttle transaction attempts if target doesn't seem to be connected
@@ -10,6 +10,7 @@ extern volatile bool isLeftHand;
 void split_pre_init(void);
 void split_post_init(void);
 
+void transport_master_start_if_connected(matrix_row_t master_matrix[]);
 bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 bool is_transport_connected(void);
 
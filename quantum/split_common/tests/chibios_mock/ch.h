@@ -0,0 +1,70 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Just enough of the ChibiOS kernel API for the split transport thread, on top of pthreads
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define NORMALPRIO 128
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond;
+    bool            taken;
+} binary_semaphore_t;
+
+#define BSEMAPHORE_DECL(name, taken) binary_semaphore_t name = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, taken}
+
+static inline void chBSemWait(binary_semaphore_t *bsp) {
+    pthread_mutex_lock(&bsp->mutex);
+    while (bsp->taken) {
+        pthread_cond_wait(&bsp->cond, &bsp->mutex);
+    }
+    bsp->taken = true;
+    pthread_mutex_unlock(&bsp->mutex);
+}
+
+static inline void chBSemSignal(binary_semaphore_t *bsp) {
+    pthread_mutex_lock(&bsp->mutex);
+    bsp->taken = false;
+    pthread_cond_signal(&bsp->cond);
+    pthread_mutex_unlock(&bsp->mutex);
+}
+
+#define THD_WORKING_AREA(name, size) char name[size]
+#define THD_FUNCTION(name, arg) void name(void *arg)
+
+typedef void (*tfunc_t)(void *arg);
+
+static inline void chRegSetThreadName(const char *name) {
+    (void)name;
+}
+
+typedef struct {
+    tfunc_t pf;
+    void   *arg;
+} mock_thread_start_t;
+
+static inline void *mock_thread_main(void *start) {
+    mock_thread_start_t *thread_start = (mock_thread_start_t *)start;
+    thread_start->pf(thread_start->arg);
+    return NULL;
+}
+
+// The working area holds the entry point, as it isn't needed for a stack
+static inline void *chThdCreateStatic(void *wsp, size_t size, int prio, tfunc_t pf, void *arg) {
+    (void)size;
+    (void)prio;
+    mock_thread_start_t *thread_start = (mock_thread_start_t *)wsp;
+    thread_start->pf                  = pf;
+    thread_start->arg                 = arg;
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, mock_thread_main, thread_start);
+    pthread_detach(thread);
+    return NULL;
+}
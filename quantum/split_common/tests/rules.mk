@@ -0,0 +1,13 @@
+sync_timer_DEFS := -DSPLIT_KEYBOARD
+
+sync_timer_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/sync_timer_tests.cpp \
+	$(QUANTUM_PATH)/sync_timer.c
+
+transport_async_DEFS := -DSPLIT_KEYBOARD -DSPLIT_TRANSPORT_ASYNC -DPROTOCOL_CHIBIOS
+transport_async_INC := $(QUANTUM_PATH)/split_common $(QUANTUM_PATH)/split_common/tests/chibios_mock
+transport_async_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_transport_async.h
+
+transport_async_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/transport_async_tests.cpp \
+	$(QUANTUM_PATH)/split_common/transport.c
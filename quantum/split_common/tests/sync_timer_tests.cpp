@@ -0,0 +1,205 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <cmath>
+#include <cstdlib>
+#include <random>
+
+extern "C" {
+#include "sync_timer.h"
+}
+
+// A simulated split link: both halves run their own clock off a shared "true" time, and the test decides which half
+// the code under test is currently running on.
+struct simulated_clock_t {
+    double start_us;
+    double rate;
+
+    uint64_t read(double now_us) const {
+        return (uint64_t)std::floor(start_us + now_us * rate);
+    }
+};
+
+static simulated_clock_t master_clock;
+static simulated_clock_t slave_clock;
+static double            now_us;
+static bool              on_master;
+
+static const simulated_clock_t &current_clock() {
+    return on_master ? master_clock : slave_clock;
+}
+
+extern "C" {
+bool is_keyboard_master(void) {
+    return on_master;
+}
+
+uint32_t timer_read_us(void) {
+    return (uint32_t)current_clock().read(now_us);
+}
+
+uint32_t timer_read32(void) {
+    return (uint32_t)(current_clock().read(now_us) / 1000);
+}
+
+uint16_t timer_read(void) {
+    return (uint16_t)timer_read32();
+}
+}
+
+class SyncTimer : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        master_clock = {0, 1.0};
+        slave_clock  = {0, 1.0};
+        now_us       = 0;
+        on_master    = true;
+        sync_timer_init();
+    }
+
+    // Runs one request from the master to the slave and back, returning whether the slave received it
+    void exchange(double out_us, double back_us, bool response_lost = false) {
+        sync_timer_request_t request;
+        on_master = true;
+        sync_timer_request_begin(&request);
+
+        now_us += out_us;
+        on_master = false;
+        sync_timer_handle_request(&request, timer_read_us());
+
+        now_us += back_us;
+        on_master = true;
+        sync_timer_request_end(&request, !response_lost);
+    }
+
+    // Synchronized time on the slave minus the master's time, in microseconds
+    int32_t skew_us() {
+        on_master      = false;
+        int32_t result = (int32_t)(sync_timer_read_us() - (uint32_t)master_clock.read(now_us));
+        on_master      = true;
+        return result;
+    }
+};
+
+TEST_F(SyncTimer, MasterReadsItsOwnClock) {
+    master_clock = {123456789, 1.0};
+    now_us       = 5000;
+    EXPECT_EQ(sync_timer_read_us(), 123461789);
+    EXPECT_EQ(sync_timer_read32(), 123461);
+}
+
+TEST_F(SyncTimer, CompensatesTransportDelay) {
+    slave_clock = {987654321, 1.0};
+
+    for (int i = 0; i < 3; i++) {
+        exchange(1500, 1500);
+        now_us += 100000;
+    }
+
+    // Without round trip compensation the slave would be behind by the 1.5ms it takes a request to arrive
+    EXPECT_LE(std::abs(skew_us()), 2);
+}
+
+TEST_F(SyncTimer, EstimatesDrift) {
+    master_clock = {1000000, 1.0};
+    slave_clock  = {42, 1.0003};
+
+    for (int i = 0; i < 200; i++) {
+        exchange(200, 200);
+        now_us += 100000;
+    }
+
+    // Between synchronizations a drift of 300ppm would otherwise add up to 30us
+    int32_t worst = 0;
+    for (int i = 0; i < 20; i++) {
+        exchange(200, 200);
+        for (int j = 0; j < 10; j++) {
+            now_us += 10000;
+            worst = std::max(worst, std::abs(skew_us()));
+        }
+    }
+    EXPECT_LE(worst, 5);
+}
+
+TEST_F(SyncTimer, BoundedSkewOnJitteryLink) {
+    std::mt19937                           rng(1234);
+    std::uniform_real_distribution<double> latency(100, 600);
+    std::uniform_real_distribution<double> interval(90000, 110000);
+
+    master_clock = {3000000, 1.0};
+    slave_clock  = {17000, 0.99985};
+
+    for (int i = 0; i < 200; i++) {
+        exchange(latency(rng), latency(rng));
+        now_us += interval(rng);
+    }
+
+    int32_t worst = 0;
+    for (int i = 0; i < 300; i++) {
+        exchange(latency(rng), latency(rng));
+        now_us += interval(rng) / 2;
+        worst = std::max(worst, std::abs(skew_us()));
+        now_us += interval(rng) / 2;
+    }
+
+    // Each request takes 350us on average in either direction, which can differ by up to 500us
+    EXPECT_LE(worst, 120);
+}
+
+TEST_F(SyncTimer, IgnoresIncompleteExchanges) {
+    slave_clock = {55555, 1.0};
+
+    for (int i = 0; i < 3; i++) {
+        exchange(300, 300);
+        now_us += 100000;
+    }
+
+    // A response which never made it back, and then took forever to time out
+    exchange(300, 20000, true);
+    now_us += 100000;
+    exchange(300, 300);
+    now_us += 100000;
+
+    EXPECT_LE(std::abs(skew_us()), 2);
+}
+
+TEST_F(SyncTimer, FollowsMasterReset) {
+    slave_clock = {1000, 1.0};
+
+    for (int i = 0; i < 5; i++) {
+        exchange(250, 250);
+        now_us += 100000;
+    }
+
+    master_clock.start_us -= (double)now_us;
+
+    exchange(250, 250);
+    now_us += 100000;
+    exchange(250, 250);
+    now_us += 100000;
+
+    EXPECT_LE(std::abs(skew_us()), 2);
+}
+
+TEST_F(SyncTimer, MillisecondsFollowMaster) {
+    // Close enough to the 32-bit microsecond wraparound to cross it
+    master_clock = {4294967296.0 - 2000000, 1.0};
+    slave_clock  = {31337, 1.0002};
+
+    for (int i = 0; i < 60; i++) {
+        exchange(400, 400);
+        now_us += 100000;
+
+        for (double offset : {0.0, 25000.0, 50000.0}) {
+            double when = now_us + offset;
+            std::swap(now_us, when);
+            on_master         = false;
+            int64_t slave_ms  = sync_timer_read32();
+            int64_t master_ms = master_clock.read(now_us) / 1000;
+            on_master         = true;
+            std::swap(now_us, when);
+            EXPECT_LE(std::abs(slave_ms - (int64_t)(uint32_t)master_ms), 1) << "exchange " << i;
+        }
+    }
+}
@@ -0,0 +1,3 @@
+TEST_LIST += \
+	sync_timer \
+	transport_async \
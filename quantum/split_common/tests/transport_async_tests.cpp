@@ -0,0 +1,122 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+extern "C" {
+#include "transactions.h"
+#include "transport.h"
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+// Time taken to scan one half, and for one exchange with the other half, in the order of a full-duplex USART link. The
+// exchange is spent waiting on the link rather than the CPU, so it sleeps where the scan spins.
+static const auto scan_time     = std::chrono::microseconds(400);
+static const auto exchange_time = std::chrono::microseconds(400);
+
+static std::atomic<int> exchanges;
+static matrix_row_t     exchanged_master_matrix[HALF_ROWS];
+
+static void spin_for(std::chrono::microseconds duration) {
+    auto end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end) {
+    }
+}
+
+extern "C" {
+split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
+
+void soft_serial_initiator_init(void) {}
+void soft_serial_target_init(void) {}
+bool soft_serial_transaction(int sstd_index) {
+    return true;
+}
+
+// The other half echoes the master matrix back inverted
+bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    std::this_thread::sleep_for(exchange_time);
+    for (int i = 0; i < HALF_ROWS; i++) {
+        exchanged_master_matrix[i] = master_matrix[i];
+        slave_matrix[i]            = ~master_matrix[i];
+    }
+    exchanges++;
+    return true;
+}
+
+void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {}
+}
+
+class TransportAsync : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        exchanges = 0;
+    }
+
+    static void fill(matrix_row_t matrix[], matrix_row_t value) {
+        for (int i = 0; i < HALF_ROWS; i++) {
+            matrix[i] = value;
+        }
+    }
+};
+
+TEST_F(TransportAsync, ExchangeWithoutStartRunsNow) {
+    matrix_row_t master[HALF_ROWS], slave[HALF_ROWS];
+    fill(master, 0x12);
+
+    EXPECT_TRUE(transport_master(master, slave));
+    EXPECT_EQ(exchanges, 1);
+    EXPECT_EQ(slave[0], (matrix_row_t)~0x12);
+}
+
+TEST_F(TransportAsync, StartedExchangeSendsMatrixAsOfStart) {
+    matrix_row_t master[HALF_ROWS], slave[HALF_ROWS];
+    fill(master, 0x34);
+    transport_master_start(master);
+
+    // Scanning changes the master matrix while the exchange is in flight, which only goes out with the next one
+    fill(master, 0x56);
+    fill(slave, 0);
+    EXPECT_TRUE(transport_master(master, slave));
+    EXPECT_EQ(exchanges, 1);
+    EXPECT_EQ(exchanged_master_matrix[0], 0x34);
+    EXPECT_EQ(slave[0], (matrix_row_t)~0x34);
+
+    // Starting again while an exchange is in flight doesn't queue a second one
+    transport_master_start(master);
+    transport_master_start(master);
+    EXPECT_TRUE(transport_master(master, slave));
+    EXPECT_EQ(exchanges, 2);
+    EXPECT_EQ(exchanged_master_matrix[0], 0x56);
+}
+
+TEST_F(TransportAsync, ScanRate) {
+    matrix_row_t master[HALF_ROWS] = {0}, slave[HALF_ROWS];
+    const int    scans             = 500;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < scans; i++) {
+        spin_for(scan_time);
+        transport_master(master, slave);
+    }
+    auto sync_elapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < scans; i++) {
+        transport_master_start(master);
+        spin_for(scan_time);
+        transport_master(master, slave);
+    }
+    auto async_elapsed = std::chrono::steady_clock::now() - start;
+
+    double sync_rate  = scans / std::chrono::duration<double>(sync_elapsed).count();
+    double async_rate = scans / std::chrono::duration<double>(async_elapsed).count();
+    std::cout << "split scan rate with " << scan_time.count() << " us scans and " << exchange_time.count() << " us exchanges: " << (int)sync_rate << " Hz synchronous, " << (int)async_rate << " Hz overlapped" << std::endl;
+
+    // Overlapping should approach the rate of whichever is slower on its own
+    EXPECT_GT(async_rate, sync_rate * 1.4);
+}
@@ -18,6 +18,7 @@
 #include <string.h>
 #include <stddef.h>
 
+#include "compiler_support.h"
 #include "crc.h"
 #include "debug.h"
 #include "matrix.h"
@@ -65,8 +66,6 @@
 #    include "wpm.h"
 #endif
 
-#define SYNC_TIMER_OFFSET 2
-
 #ifndef FORCED_SYNC_THROTTLE_MS
 #    define FORCED_SYNC_THROTTLE_MS 100
 #endif // FORCED_SYNC_THROTTLE_MS
@@ -301,8 +300,10 @@ static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_
 
     bool okay = true;
     if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
-        uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
-        okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
+        sync_timer_request_t request;
+        sync_timer_request_begin(&request);
+        okay &= transport_write(PUT_SYNC_TIMER, &request, sizeof(request));
+        sync_timer_request_end(&request, okay);
         if (okay) {
             last_update = timer_read32();
         }
@@ -311,16 +312,21 @@ static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_
 }
 
 static void sync_timer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_sync_timer = 0;
-    if (last_sync_timer != split_shmem->sync_timer) {
-        last_sync_timer = split_shmem->sync_timer;
-        sync_timer_update(last_sync_timer);
+    static uint32_t last_received_us = 0;
+    if (last_received_us != split_shmem->sync_timer.received_us) {
+        last_received_us = split_shmem->sync_timer.received_us;
+        sync_timer_handle_request(&split_shmem->sync_timer.request, last_received_us);
     }
 }
 
+static void sync_timer_handlers_slave_received(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    // Timestamp the request as early as possible, it's processed later on from the main loop
+    split_shmem->sync_timer.received_us = timer_read_us();
+}
+
 #    define TRANSACTIONS_SYNC_TIMER_MASTER() TRANSACTION_HANDLER_MASTER(sync_timer)
 #    define TRANSACTIONS_SYNC_TIMER_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(sync_timer)
-#    define TRANSACTIONS_SYNC_TIMER_REGISTRATIONS [PUT_SYNC_TIMER] = trans_initiator2target_initializer(sync_timer),
+#    define TRANSACTIONS_SYNC_TIMER_REGISTRATIONS [PUT_SYNC_TIMER] = trans_initiator2target_initializer_cb(sync_timer.request, sync_timer_handlers_slave_received),
 
 #else // DISABLE_SYNC_TIMER
 
@@ -745,7 +751,13 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
         return;
     }
 #    endif
-#    if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
+#    if defined(POINTING_DEVICE_TASK_THROTTLE_US)
+    static uint32_t last_exec = 0;
+    if (timer_read_us() - last_exec < POINTING_DEVICE_TASK_THROTTLE_US) {
+        return;
+    }
+    last_exec = timer_read_us();
+#    elif (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
     if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
         return;
@@ -916,6 +928,39 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 ////////////////////////////////////////////////////
 
+// Buffer sizes are held in a byte, and the serial streaming protocol sends them as such in every frame. Only the members
+// whose size depends on the keyboard's configuration are checked; the rest are fixed and small.
+STATIC_ASSERT(sizeof(((split_shared_memory_t *)0)->smatrix.matrix) <= 255, "Split transaction buffer smatrix.matrix is larger than 255 bytes");
+#ifdef SPLIT_TRANSPORT_MIRROR
+STATIC_ASSERT(sizeof(((split_shared_memory_t *)0)->mmatrix.matrix) <= 255, "Split transaction buffer mmatrix.matrix is larger than 255 bytes");
+#endif // SPLIT_TRANSPORT_MIRROR
+#ifdef ENCODER_ENABLE
+STATIC_ASSERT(sizeof(((split_shared_memory_t *)0)->encoders.events) <= 255, "Split transaction buffer encoders.events is larger than 255 bytes");
+#endif // ENCODER_ENABLE
+#if defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+STATIC_ASSERT(sizeof(((split_shared_memory_t *)0)->rgblight_sync) <= 255, "Split transaction buffer rgblight_sync is larger than 255 bytes");
+#endif // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
+#if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
+STATIC_ASSERT(sizeof(((split_shared_memory_t *)0)->led_matrix_sync) <= 255, "Split transaction buffer led_matrix_sync is larger than 255 bytes");
+#endif // defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+STATIC_ASSERT(sizeof(((split_shared_memory_t *)0)->rgb_matrix_sync) <= 255, "Split transaction buffer rgb_matrix_sync is larger than 255 bytes");
+#endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
+#if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+STATIC_ASSERT(sizeof(((split_shared_memory_t *)0)->pointing.report) <= 255, "Split transaction buffer pointing.report is larger than 255 bytes");
+#endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+#if defined(HAPTIC_ENABLE) && defined(SPLIT_HAPTIC_ENABLE)
+STATIC_ASSERT(sizeof(((split_shared_memory_t *)0)->haptic_sync) <= 255, "Split transaction buffer haptic_sync is larger than 255 bytes");
+#endif // defined(HAPTIC_ENABLE) && defined(SPLIT_HAPTIC_ENABLE)
+#if defined(SPLIT_ACTIVITY_ENABLE)
+STATIC_ASSERT(sizeof(((split_shared_memory_t *)0)->activity_sync) <= 255, "Split transaction buffer activity_sync is larger than 255 bytes");
+#endif // defined(SPLIT_ACTIVITY_ENABLE)
+#if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+STATIC_ASSERT(sizeof(((split_shared_memory_t *)0)->rpc_info) <= 255, "Split transaction buffer rpc_info is larger than 255 bytes");
+STATIC_ASSERT(sizeof(((split_shared_memory_t *)0)->rpc_m2s_buffer) <= 255, "Split transaction buffer rpc_m2s_buffer is larger than 255 bytes");
+STATIC_ASSERT(sizeof(((split_shared_memory_t *)0)->rpc_s2m_buffer) <= 255, "Split transaction buffer rpc_s2m_buffer is larger than 255 bytes");
+#endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     // Set defaults
     [0 ...(NUM_TOTAL_TRANSACTIONS - 1)] = {0, 0, 0, 0, 0},
@@ -101,6 +101,8 @@ void transport_slave_init(void) {
     soft_serial_target_init();
 }
 
+__attribute__((weak)) void soft_serial_target_sync(void) {}
+
 bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
@@ -122,10 +124,83 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSPORT_ASYNC
+
+#    ifndef PROTOCOL_CHIBIOS
+#        error "SPLIT_TRANSPORT_ASYNC is only supported on ChibiOS"
+#    endif
+
+// The transport thread would use the bus while the main thread scans the matrix, and i2c_master is not thread-safe
+#    if defined(USE_I2C)
+#        error "SPLIT_TRANSPORT_ASYNC is not supported with SPLIT_TRANSPORT = i2c"
+#    endif
+#    if defined(MATRIX_IO_EXPANDER)
+#        error "SPLIT_TRANSPORT_ASYNC is not supported with MATRIX_IO_EXPANDER"
+#    endif
+
+#    include <ch.h>
+
+// Double-buffered matrices, owned by the transport thread while an exchange is in flight
+static matrix_row_t async_master_matrix[(MATRIX_ROWS) / 2];
+static matrix_row_t async_slave_matrix[(MATRIX_ROWS) / 2];
+static bool         async_okay      = false;
+static bool         async_in_flight = false;
+
+static BSEMAPHORE_DECL(async_start_semaphore, true);
+static BSEMAPHORE_DECL(async_done_semaphore, true);
+
+static THD_WORKING_AREA(waTransportThread, SPLIT_TRANSPORT_ASYNC_STACK_SIZE);
+static THD_FUNCTION(TransportThread, arg) {
+    (void)arg;
+    chRegSetThreadName("split_transport");
+
+    while (true) {
+        chBSemWait(&async_start_semaphore);
+        async_okay = transactions_master(async_master_matrix, async_slave_matrix);
+        chBSemSignal(&async_done_semaphore);
+    }
+}
+
+void transport_master_start(matrix_row_t master_matrix[]) {
+    static bool thread_started = false;
+    if (!thread_started) {
+        chThdCreateStatic(waTransportThread, sizeof(waTransportThread), NORMALPRIO + 1, TransportThread, NULL);
+        thread_started = true;
+    }
+
+    if (async_in_flight) {
+        return;
+    }
+
+    memcpy(async_master_matrix, master_matrix, sizeof(async_master_matrix));
+    async_in_flight = true;
+    chBSemSignal(&async_start_semaphore);
+}
+
+bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    // Nothing was started before the scan, so run the exchange now
+    if (!async_in_flight) {
+        transport_master_start(master_matrix);
+    }
+
+    chBSemWait(&async_done_semaphore);
+    async_in_flight = false;
+
+    memcpy(slave_matrix, async_slave_matrix, sizeof(async_slave_matrix));
+    return async_okay;
+}
+
+#else // SPLIT_TRANSPORT_ASYNC
+
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     return transactions_master(master_matrix, slave_matrix);
 }
 
+#endif // SPLIT_TRANSPORT_ASYNC
+
 void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     transactions_slave(master_matrix, slave_matrix);
+#ifndef USE_I2C
+    soft_serial_target_sync();
+#endif
 }
@@ -31,9 +31,15 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+#ifndef SPLIT_TRANSPORT_ASYNC_STACK_SIZE
+#    define SPLIT_TRANSPORT_ASYNC_STACK_SIZE 1024
+#endif // SPLIT_TRANSPORT_ASYNC_STACK_SIZE
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
+// starts exchanging data with the slave in the background, if supported
+void transport_master_start(matrix_row_t master_matrix[]);
 // returns false if valid data not received from slave
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
@@ -70,6 +76,15 @@ typedef struct _split_slave_encoder_sync_t {
 } split_slave_encoder_sync_t;
 #endif // ENCODER_ENABLE
 
+#ifndef DISABLE_SYNC_TIMER
+#    include "sync_timer.h"
+
+typedef struct _split_sync_timer_t {
+    sync_timer_request_t request;
+    uint32_t             received_us;
+} split_sync_timer_t;
+#endif // DISABLE_SYNC_TIMER
+
 #if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
 typedef struct _split_layers_sync_t {
     layer_state_t layer_state;
@@ -163,7 +178,7 @@ typedef struct _split_shared_memory_t {
 #endif // ENCODER_ENABLE
 
 #ifndef DISABLE_SYNC_TIMER
-    uint32_t sync_timer;
+    split_sync_timer_t sync_timer;
 #endif // DISABLE_SYNC_TIMER
 
 #if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
@@ -23,38 +23,204 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <stdlib.h>
 #include "sync_timer.h"
 #include "keyboard.h"
+#include "util.h"
 
 #if defined(SPLIT_KEYBOARD) && !defined(DISABLE_SYNC_TIMER)
-volatile int32_t sync_timer_ms;
+
+/*
+ * The master periodically sends a request stamped with its own time. The slave
+ * notes when each one arrives, and pairs it with the time the master saw the
+ * request complete, which is sent along with the next request. Like NTP, this
+ * gives both the round trip delay and the offset between the two clocks, under
+ * the assumption that both directions take equally long. Exchanges which took
+ * much longer than the fastest recent one are dropped, the rest are averaged,
+ * and the drift between the clocks is estimated from the resulting offsets
+ * over several seconds.
+ */
+
+typedef struct {
+    int32_t  offset; // master time minus local time
+    uint32_t delay;  // round trip time
+    uint32_t local;  // local time the request arrived at
+} sync_timer_sample_t;
+
+// Master: the last request which completed successfully
+static uint32_t last_sent_us = 0;
+static uint32_t last_done_us = 0;
+
+// Slave: the last request received, which is completed by the next one
+static bool     pending_valid = false;
+static uint32_t pending_sent_us;
+static uint32_t pending_received_us;
+
+// Slave: round trip times of the last few exchanges
+static uint32_t recent_delays[SYNC_TIMER_FILTER_SIZE];
+static uint8_t  recent_count = 0;
+static uint8_t  recent_head  = 0;
+
+// Slave: master time = local + ref_offset + drift * (local - ref_local), drift being a Q0.32 fraction
+static bool     model_valid = false;
+static uint32_t ref_local;
+static int32_t  ref_offset;
+static int32_t  drift = 0;
+
+// Slave: filtered offsets, spread out over time to estimate the drift from
+static sync_timer_sample_t drift_points[SYNC_TIMER_DRIFT_POINTS];
+static uint8_t             drift_point_count = 0;
+static uint8_t             drift_point_head  = 0;
+
+// Slave: master millisecond timer at a given master time
+static uint32_t anchor_us;
+static uint32_t anchor_ms;
 
 void sync_timer_init(void) {
-    sync_timer_ms = 0;
+    last_sent_us      = 0;
+    last_done_us      = 0;
+    pending_valid     = false;
+    recent_count      = 0;
+    recent_head       = 0;
+    model_valid       = false;
+    drift             = 0;
+    drift_point_count = 0;
+    drift_point_head  = 0;
 }
 
-void sync_timer_update(uint32_t time) {
-    if (is_keyboard_master()) return;
-    sync_timer_ms = time - timer_read32();
+static int32_t sync_timer_offset_at(uint32_t local) {
+    return ref_offset + (int32_t)(((int64_t)drift * (int32_t)(local - ref_local)) >> 32);
+}
+
+static void sync_timer_step(const sync_timer_sample_t *sample) {
+    recent_delays[0]  = sample->delay;
+    recent_count      = 1;
+    recent_head       = 1 % SYNC_TIMER_FILTER_SIZE;
+    ref_local         = sample->local;
+    ref_offset        = sample->offset;
+    model_valid       = true;
+    drift_point_count = 0;
+    drift_point_head  = 0;
+}
+
+static void sync_timer_update_drift(const sync_timer_sample_t *point) {
+    if (drift_point_count > 0) {
+        const sync_timer_sample_t *newest = &drift_points[(drift_point_head + SYNC_TIMER_DRIFT_POINTS - 1) % SYNC_TIMER_DRIFT_POINTS];
+        if ((int32_t)(point->local - newest->local) < SYNC_TIMER_DRIFT_INTERVAL_US) {
+            return;
+        }
+    }
+
+    drift_points[drift_point_head] = *point;
+    drift_point_head               = (drift_point_head + 1) % SYNC_TIMER_DRIFT_POINTS;
+    if (drift_point_count < SYNC_TIMER_DRIFT_POINTS) {
+        drift_point_count++;
+    }
+
+    // The longer the baseline, the less the errors of the individual offsets matter
+    if (drift_point_count > 1) {
+        const sync_timer_sample_t *oldest   = &drift_points[(drift_point_head + SYNC_TIMER_DRIFT_POINTS - drift_point_count) % SYNC_TIMER_DRIFT_POINTS];
+        int32_t                    interval = (int32_t)(point->local - oldest->local);
+        drift                               = (int32_t)(((int64_t)(point->offset - oldest->offset) << 32) / interval);
+    }
+}
+
+static void sync_timer_add_sample(const sync_timer_sample_t *sample) {
+    // Large errors mean either half was reset, so start over from the new offset
+    if (!model_valid || abs(sample->offset - sync_timer_offset_at(sample->local)) > SYNC_TIMER_STEP_US) {
+        sync_timer_step(sample);
+        return;
+    }
+
+    recent_delays[recent_head] = sample->delay;
+    recent_head                = (recent_head + 1) % SYNC_TIMER_FILTER_SIZE;
+    if (recent_count < SYNC_TIMER_FILTER_SIZE) {
+        recent_count++;
+    }
+
+    // Round trips much slower than the fastest recent one leave too much room for the two directions to differ
+    uint32_t min_delay = sample->delay;
+    for (uint8_t i = 0; i < recent_count; i++) {
+        min_delay = MIN(min_delay, recent_delays[i]);
+    }
+    if (sample->delay > min_delay + min_delay / 2) {
+        return;
+    }
+
+    // Whatever difference remains averages out over several exchanges, once there have been a few
+    int32_t predicted = sync_timer_offset_at(sample->local);
+    ref_offset        = predicted + (sample->offset - predicted) / MIN(recent_count, SYNC_TIMER_PHASE_GAIN);
+    ref_local         = sample->local;
+
+    sync_timer_sample_t filtered = {.offset = ref_offset, .delay = sample->delay, .local = ref_local};
+    sync_timer_update_drift(&filtered);
+}
+
+void sync_timer_request_begin(sync_timer_request_t *request) {
+    request->last_sent_us = last_sent_us;
+    request->last_done_us = last_done_us;
+    request->sent_us      = timer_read_us();
+    request->sent_ms      = timer_read32();
+}
+
+void sync_timer_request_end(const sync_timer_request_t *request, bool success) {
+    uint32_t done_us = timer_read_us();
+    if (success) {
+        last_sent_us = request->sent_us;
+        last_done_us = done_us;
+    }
+}
+
+void sync_timer_handle_request(const sync_timer_request_t *request, uint32_t received_us) {
+    if (pending_valid && request->last_sent_us == pending_sent_us) {
+        uint32_t delay = request->last_done_us - pending_sent_us;
+        if (delay <= SYNC_TIMER_MAX_DELAY_US) {
+            sync_timer_sample_t sample = {
+                .offset = (int32_t)(pending_sent_us + delay / 2 - pending_received_us),
+                .delay  = delay,
+                .local  = pending_received_us,
+            };
+            sync_timer_add_sample(&sample);
+        }
+    } else if (!model_valid) {
+        // Nothing better to go on until the first exchange completes
+        ref_local   = received_us;
+        ref_offset  = (int32_t)(request->sent_us - received_us);
+        model_valid = true;
+    }
+
+    pending_valid       = true;
+    pending_sent_us     = request->sent_us;
+    pending_received_us = received_us;
+
+    anchor_us = request->sent_us;
+    anchor_ms = request->sent_ms;
+}
+
+uint32_t sync_timer_read_us(void) {
+    uint32_t local = timer_read_us();
+    if (is_keyboard_master() || !model_valid) return local;
+    return local + sync_timer_offset_at(local);
 }
 
 uint16_t sync_timer_read(void) {
-    if (is_keyboard_master()) return timer_read();
-    return sync_timer_read32();
+    return (uint16_t)sync_timer_read32();
 }
 
 uint32_t sync_timer_read32(void) {
-    if (is_keyboard_master()) return timer_read32();
-    return sync_timer_ms + timer_read32();
+    if (is_keyboard_master() || !model_valid) return timer_read32();
+    return anchor_ms + (int32_t)(sync_timer_read_us() - anchor_us) / 1000;
 }
 
 uint16_t sync_timer_elapsed(uint16_t last) {
-    if (is_keyboard_master()) return timer_elapsed(last);
     return TIMER_DIFF_16(sync_timer_read(), last);
 }
 
 uint32_t sync_timer_elapsed32(uint32_t last) {
-    if (is_keyboard_master()) return timer_elapsed32(last);
     return TIMER_DIFF_32(sync_timer_read32(), last);
 }
+
+uint32_t sync_timer_elapsed_us(uint32_t last) {
+    return TIMER_DIFF_32(sync_timer_read_us(), last);
+}
 #endif
@@ -26,6 +26,7 @@ SOFTWARE.
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "timer.h"
 
 #ifdef __cplusplus
@@ -33,20 +34,63 @@ extern "C" {
 #endif
 
 #if defined(SPLIT_KEYBOARD) && !defined(DISABLE_SYNC_TIMER)
+
+// Number of recent exchanges whose fastest round trip decides which exchanges are accurate enough to use
+#    ifndef SYNC_TIMER_FILTER_SIZE
+#        define SYNC_TIMER_FILTER_SIZE 8
+#    endif
+
+// Minimum time in microseconds between the exchanges used to estimate the drift between both clocks
+#    ifndef SYNC_TIMER_DRIFT_INTERVAL_US
+#        define SYNC_TIMER_DRIFT_INTERVAL_US 1000000
+#    endif
+
+// Fraction of each measured offset error which is corrected at once
+#    ifndef SYNC_TIMER_PHASE_GAIN
+#        define SYNC_TIMER_PHASE_GAIN 4
+#    endif
+
+// Number of those exchanges kept, the drift is measured across all of them
+#    ifndef SYNC_TIMER_DRIFT_POINTS
+#        define SYNC_TIMER_DRIFT_POINTS 8
+#    endif
+
+// Offset error in microseconds beyond which the slave jumps to the new time rather than filtering it
+#    ifndef SYNC_TIMER_STEP_US
+#        define SYNC_TIMER_STEP_US 2000
+#    endif
+
+// Exchanges taking longer than this many microseconds are too inaccurate to be used
+#    ifndef SYNC_TIMER_MAX_DELAY_US
+#        define SYNC_TIMER_MAX_DELAY_US 20000
+#    endif
+
+typedef struct sync_timer_request_t {
+    uint32_t sent_us;      // master time this request was sent at
+    uint32_t sent_ms;      // master millisecond timer at the same time
+    uint32_t last_sent_us; // master time the previous successful request was sent at
+    uint32_t last_done_us; // master time the previous successful request completed at
+} sync_timer_request_t;
+
 void     sync_timer_init(void);
-void     sync_timer_update(uint32_t time);
+void     sync_timer_request_begin(sync_timer_request_t *request);
+void     sync_timer_request_end(const sync_timer_request_t *request, bool success);
+void     sync_timer_handle_request(const sync_timer_request_t *request, uint32_t received_us);
 uint16_t sync_timer_read(void);
 uint32_t sync_timer_read32(void);
+uint32_t sync_timer_read_us(void);
 uint16_t sync_timer_elapsed(uint16_t last);
 uint32_t sync_timer_elapsed32(uint32_t last);
+uint32_t sync_timer_elapsed_us(uint32_t last);
 #else
 #    define sync_timer_init()
 #    define sync_timer_clear()
-#    define sync_timer_update(t)
 #    define sync_timer_read() timer_read()
 #    define sync_timer_read32() timer_read32()
+#    define sync_timer_read_us() timer_read_us()
 #    define sync_timer_elapsed(t) timer_elapsed(t)
 #    define sync_timer_elapsed32(t) timer_elapsed32(t)
+#    define sync_timer_elapsed_us(t) TIMER_DIFF_32(timer_read_us(), t)
 #endif
 
 #ifdef __cplusplus
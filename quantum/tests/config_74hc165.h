@@ -0,0 +1,24 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 12
+#define DIODE_DIRECTION COL2ROW
+
+// Twelve columns need a second register in the chain
+#define MATRIX_ROW_PINS {10, 11, 12, 13}
+#define MATRIX_SHIFT_REGISTER_LATCH_PIN 20
+#define MATRIX_SHIFT_REGISTER_CS_PIN 21
+#define MATRIX_SHIFT_REGISTER_COUNT 2
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "matrix_mock.h"
+
+#ifdef __cplusplus
+};
+#endif
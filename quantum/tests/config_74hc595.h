@@ -0,0 +1,23 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 10
+#define MATRIX_COLS 6
+#define DIODE_DIRECTION COL2ROW
+
+// Ten rows need a second register in the chain
+#define MATRIX_COL_PINS {0, 1, 2, 3, 4, 5}
+#define MATRIX_SHIFT_REGISTER_LATCH_PIN 20
+#define MATRIX_SHIFT_REGISTER_COUNT 2
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "matrix_mock.h"
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,24 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 6
+#define DIODE_DIRECTION COL2ROW
+
+// Rows on the second port, so that both ports take part in each scan
+#define MATRIX_IO_EXPANDER_ADDRESS 0x20
+#define MATRIX_IO_EXPANDER_ROW_PINS {8, 9, 10, 11}
+#define MATRIX_IO_EXPANDER_COL_PINS {0, 1, 2, 3, 4, 5}
+#define MATRIX_IO_EXPANDER_RETRY_INTERVAL 1000
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "matrix_mock.h"
+
+#ifdef __cplusplus
+};
+#endif
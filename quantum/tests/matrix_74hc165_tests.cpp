@@ -0,0 +1,67 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+
+extern matrix_row_t raw_matrix[MATRIX_ROWS];
+}
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+
+class Matrix74hc165 : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_reset();
+        matrix_init();
+    }
+};
+
+TEST_F(Matrix74hc165, ScanReadsPressedKeys) {
+    // Columns 8 to 11 are read through the second register of the chain
+    mock_keys[0][0]  = true;
+    mock_keys[0][11] = true;
+    mock_keys[1][7]  = true;
+    mock_keys[1][8]  = true;
+    mock_keys[3][5]  = true;
+
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_EQ(raw_matrix[0], 0b100000000001);
+    EXPECT_EQ(raw_matrix[1], 0b000110000000);
+    EXPECT_EQ(raw_matrix[2], 0b000000000000);
+    EXPECT_EQ(raw_matrix[3], 0b000000100000);
+    EXPECT_FALSE(matrix_scan());
+}
+
+TEST_F(Matrix74hc165, RowsUnselectedBetweenScans) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_FALSE(mock_pin_is_output(row_pins[row]));
+        EXPECT_TRUE(mock_pin_level(row_pins[row]));
+    }
+    EXPECT_TRUE(mock_pin_is_output(MATRIX_SHIFT_REGISTER_LATCH_PIN));
+    EXPECT_TRUE(mock_pin_level(MATRIX_SHIFT_REGISTER_LATCH_PIN));
+
+    mock_keys[2][3] = true;
+    mock_spi_transfers = 0;
+    matrix_scan();
+    EXPECT_EQ(mock_spi_transfers, MATRIX_ROWS);
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_FALSE(mock_pin_is_output(row_pins[row]));
+    }
+}
+
+TEST_F(Matrix74hc165, FailedTransferReadsReleased) {
+    mock_keys[1][9] = true;
+    matrix_scan();
+    EXPECT_EQ(raw_matrix[1], 0b001000000000);
+
+    mock_spi_receive_fails = true;
+    matrix_scan();
+    EXPECT_EQ(raw_matrix[1], 0);
+
+    mock_spi_receive_fails = false;
+    matrix_scan();
+    EXPECT_EQ(raw_matrix[1], 0b001000000000);
+}
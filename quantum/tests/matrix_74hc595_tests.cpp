@@ -0,0 +1,59 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+
+extern matrix_row_t raw_matrix[MATRIX_ROWS];
+}
+
+class Matrix74hc595 : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_reset();
+        matrix_init();
+    }
+};
+
+TEST_F(Matrix74hc595, ScanReadsPressedKeys) {
+    // Rows 8 and 9 are selected through the second register of the chain
+    mock_keys[0][0] = true;
+    mock_keys[7][5] = true;
+    mock_keys[8][2] = true;
+    mock_keys[9][0] = true;
+    mock_keys[9][3] = true;
+
+    EXPECT_TRUE(matrix_scan());
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t expected = 0;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            expected |= mock_keys[row][col] << col;
+        }
+        EXPECT_EQ(raw_matrix[row], expected) << "row " << (int)row;
+    }
+    EXPECT_FALSE(matrix_scan());
+}
+
+TEST_F(Matrix74hc595, KeysInOneColumnStayOnTheirRows) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row += 3) {
+        mock_keys[row][4] = true;
+    }
+
+    matrix_scan();
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_EQ(raw_matrix[row], row % 3 ? 0 : 0b010000) << "row " << (int)row;
+    }
+}
+
+TEST_F(Matrix74hc595, OneTransferPerRow) {
+    mock_spi_transfers = 0;
+    matrix_scan();
+    EXPECT_EQ(mock_spi_transfers, MATRIX_ROWS);
+
+    // The first row is selected again by the end of the scan, ready for the next one
+    mock_keys[0][1] = true;
+    matrix_scan();
+    EXPECT_EQ(raw_matrix[0], 0b000010);
+}
@@ -0,0 +1,85 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+
+extern matrix_row_t raw_matrix[MATRIX_ROWS];
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+class MatrixIoExpander : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_reset();
+        set_time(0);
+        matrix_init();
+    }
+};
+
+TEST_F(MatrixIoExpander, ScanReadsPressedKeys) {
+    mock_keys[0][0] = true;
+    mock_keys[2][5] = true;
+    mock_keys[3][1] = true;
+    mock_keys[3][4] = true;
+
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_EQ(raw_matrix[0], 0b000001);
+    EXPECT_EQ(raw_matrix[1], 0b000000);
+    EXPECT_EQ(raw_matrix[2], 0b100000);
+    EXPECT_EQ(raw_matrix[3], 0b010010);
+
+    mock_keys[3][1] = false;
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_EQ(raw_matrix[3], 0b010000);
+    EXPECT_FALSE(matrix_scan());
+}
+
+TEST_F(MatrixIoExpander, TwoTransactionsPerRow) {
+    mock_expander_transactions = 0;
+    matrix_scan();
+    EXPECT_EQ(mock_expander_transactions, 2 * MATRIX_ROWS);
+}
+
+TEST_F(MatrixIoExpander, DisconnectedExpanderReadsReleasedUntilRetry) {
+    mock_keys[1][2] = true;
+    matrix_scan();
+    EXPECT_EQ(raw_matrix[1], 0b000100);
+
+    // The first failure gives up on the expander until the retry interval has elapsed
+    mock_expander_disconnected = true;
+    matrix_scan();
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_EQ(raw_matrix[row], 0);
+    }
+
+    mock_expander_disconnected = false;
+    mock_expander_transactions = 0;
+    advance_time(MATRIX_IO_EXPANDER_RETRY_INTERVAL - 1);
+    matrix_scan();
+    EXPECT_EQ(mock_expander_transactions, 0);
+    EXPECT_EQ(raw_matrix[1], 0);
+
+    advance_time(1);
+    matrix_scan();
+    EXPECT_EQ(raw_matrix[1], 0b000100);
+}
+
+TEST_F(MatrixIoExpander, InitialisesWhileDisconnected) {
+    mock_reset();
+    mock_expander_disconnected = true;
+    matrix_init();
+
+    mock_expander_disconnected = false;
+    mock_keys[0][3]            = true;
+    matrix_scan();
+    EXPECT_EQ(raw_matrix[0], 0);
+
+    advance_time(MATRIX_IO_EXPANDER_RETRY_INTERVAL);
+    matrix_scan();
+    EXPECT_EQ(raw_matrix[0], 0b001000);
+}
@@ -0,0 +1,217 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "matrix.h"
+
+matrix_row_t raw_matrix[MATRIX_ROWS];
+matrix_row_t matrix[MATRIX_ROWS];
+
+bool mock_keys[MATRIX_ROWS][MATRIX_COLS];
+
+static bool pin_output[MOCK_PIN_COUNT];
+static bool pin_level[MOCK_PIN_COUNT];
+
+bool     mock_expander_disconnected;
+uint32_t mock_expander_transactions;
+bool     mock_spi_receive_fails;
+uint32_t mock_spi_transfers;
+
+#if defined(MATRIX_IO_EXPANDER)
+static const uint8_t row_lines[MATRIX_ROWS] = MATRIX_IO_EXPANDER_ROW_PINS;
+static const uint8_t col_lines[MATRIX_COLS] = MATRIX_IO_EXPANDER_COL_PINS;
+
+static uint16_t expander_config = 0xFFFF;
+static uint16_t expander_output = 0xFFFF;
+
+static bool row_selected(uint8_t row) {
+    uint16_t mask = 1 << row_lines[row];
+    return !(expander_config & mask) && !(expander_output & mask);
+}
+#elif defined(MATRIX_SHIFT_REGISTER_74HC595)
+static const pin_t col_lines[MATRIX_COLS] = MATRIX_COL_PINS;
+
+static const uint8_t *spi_pending;
+static uint16_t       spi_pending_length;
+static uint8_t        shift_register_outputs[MATRIX_SHIFT_REGISTER_COUNT];
+
+static bool row_selected(uint8_t row) {
+    return !((shift_register_outputs[MATRIX_SHIFT_REGISTER_COUNT - 1 - row / 8] >> (row % 8)) & 1);
+}
+#elif defined(MATRIX_SHIFT_REGISTER_74HC165)
+static const pin_t row_lines[MATRIX_ROWS] = MATRIX_ROW_PINS;
+
+static uint8_t shift_register_inputs[MATRIX_SHIFT_REGISTER_COUNT];
+static bool    spi_selected;
+
+static bool row_selected(uint8_t row) {
+    return pin_output[row_lines[row]] && !pin_level[row_lines[row]];
+}
+#endif
+
+// Level of the given column, as seen by whatever reads it
+static bool col_level(uint8_t col) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (mock_keys[row][col] && row_selected(row)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void mock_reset(void) {
+    memset(mock_keys, 0, sizeof(mock_keys));
+    memset(pin_output, 0, sizeof(pin_output));
+    memset(pin_level, 0, sizeof(pin_level));
+    memset(raw_matrix, 0, sizeof(raw_matrix));
+    memset(matrix, 0, sizeof(matrix));
+    mock_expander_disconnected = false;
+    mock_expander_transactions = 0;
+    mock_spi_receive_fails     = false;
+    mock_spi_transfers         = 0;
+#if defined(MATRIX_IO_EXPANDER)
+    expander_config = 0xFFFF;
+    expander_output = 0xFFFF;
+#elif defined(MATRIX_SHIFT_REGISTER_74HC595)
+    spi_pending = NULL;
+    memset(shift_register_outputs, 0xFF, sizeof(shift_register_outputs));
+#elif defined(MATRIX_SHIFT_REGISTER_74HC165)
+    spi_selected = false;
+    memset(shift_register_inputs, 0xFF, sizeof(shift_register_inputs));
+#endif
+}
+
+void gpio_set_pin_output(pin_t pin) {
+    pin_output[pin] = true;
+}
+
+void gpio_set_pin_input_high(pin_t pin) {
+    pin_output[pin] = false;
+    pin_level[pin]  = true;
+}
+
+void gpio_write_pin_high(pin_t pin) {
+#if defined(MATRIX_SHIFT_REGISTER_74HC165)
+    // The inputs are loaded while the latch pin is low, and held from its rising edge on
+    if (pin == MATRIX_SHIFT_REGISTER_LATCH_PIN && !pin_level[pin]) {
+        memset(shift_register_inputs, 0, sizeof(shift_register_inputs));
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            shift_register_inputs[col / 8] |= col_level(col) << (col % 8);
+        }
+    }
+#endif
+    pin_level[pin] = true;
+}
+
+void gpio_write_pin_low(pin_t pin) {
+    pin_level[pin] = false;
+}
+
+bool gpio_read_pin(pin_t pin) {
+#if defined(MATRIX_SHIFT_REGISTER_74HC595)
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_lines[col] == pin) {
+            return col_level(col);
+        }
+    }
+#endif
+    return pin_level[pin];
+}
+
+bool mock_pin_is_output(pin_t pin) {
+    return pin_output[pin];
+}
+
+bool mock_pin_level(pin_t pin) {
+    return pin_level[pin];
+}
+
+void matrix_init_kb(void) {}
+
+void matrix_scan_kb(void) {}
+
+void matrix_output_select_delay(void) {}
+
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {}
+
+#if defined(MATRIX_IO_EXPANDER)
+#    include "mcp23018.h"
+
+void mcp23018_init(uint8_t slave_addr) {}
+
+bool mcp23018_set_config(uint8_t slave_addr, mcp23018_port_t port, uint8_t conf) {
+    mock_expander_transactions++;
+    if (mock_expander_disconnected || slave_addr != MATRIX_IO_EXPANDER_ADDRESS) {
+        return false;
+    }
+    expander_config = port == mcp23018_PORTA ? (expander_config & 0xFF00) | conf : (expander_config & 0x00FF) | (conf << 8);
+    return true;
+}
+
+bool mcp23018_set_output_all(uint8_t slave_addr, uint8_t confA, uint8_t confB) {
+    mock_expander_transactions++;
+    if (mock_expander_disconnected || slave_addr != MATRIX_IO_EXPANDER_ADDRESS) {
+        return false;
+    }
+    expander_output = confA | (confB << 8);
+    return true;
+}
+
+bool mcp23018_read_pins_all(uint8_t slave_addr, uint16_t *ret) {
+    mock_expander_transactions++;
+    if (mock_expander_disconnected || slave_addr != MATRIX_IO_EXPANDER_ADDRESS) {
+        return false;
+    }
+    uint16_t pins = expander_output | expander_config;
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (!col_level(col)) {
+            pins &= ~(1 << col_lines[col]);
+        }
+    }
+    *ret = pins;
+    return true;
+}
+#else
+#    include "spi_master.h"
+
+void spi_init(void) {}
+
+bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
+#    if defined(MATRIX_SHIFT_REGISTER_74HC595)
+    return slavePin == MATRIX_SHIFT_REGISTER_LATCH_PIN && !lsbFirst;
+#    else
+    spi_selected = slavePin == MATRIX_SHIFT_REGISTER_CS_PIN && !lsbFirst;
+    return spi_selected;
+#    endif
+}
+
+#    if defined(MATRIX_SHIFT_REGISTER_74HC595)
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    mock_spi_transfers++;
+    spi_pending        = data;
+    spi_pending_length = length;
+    return SPI_STATUS_SUCCESS;
+}
+#    else
+spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    mock_spi_transfers++;
+    if (!spi_selected || mock_spi_receive_fails || length != MATRIX_SHIFT_REGISTER_COUNT) {
+        return SPI_STATUS_ERROR;
+    }
+    memcpy(data, shift_register_inputs, length);
+    return SPI_STATUS_SUCCESS;
+}
+#    endif
+
+void spi_stop(void) {
+#    if defined(MATRIX_SHIFT_REGISTER_74HC595)
+    // The outputs are latched on the rising edge of the chip select, from whatever was shifted in by then
+    if (spi_pending && spi_pending_length == MATRIX_SHIFT_REGISTER_COUNT) {
+        memcpy(shift_register_outputs, spi_pending, spi_pending_length);
+    }
+    spi_pending = NULL;
+#    else
+    spi_selected = false;
+#    endif
+}
+#endif
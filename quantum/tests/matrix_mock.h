@@ -0,0 +1,36 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint8_t pin_t;
+
+#define MOCK_PIN_COUNT 32
+
+/* The keys of a simulated matrix, with the MCU pins, the I/O expander or the shift registers of the backend under test
+ * wired to it. A selected line pulls the other side of every pressed key on it low, and anything not pulled low reads
+ * high.
+ */
+extern bool mock_keys[MATRIX_ROWS][MATRIX_COLS];
+
+void gpio_set_pin_output(pin_t pin);
+void gpio_set_pin_input_high(pin_t pin);
+void gpio_write_pin_high(pin_t pin);
+void gpio_write_pin_low(pin_t pin);
+bool gpio_read_pin(pin_t pin);
+
+bool mock_pin_is_output(pin_t pin);
+bool mock_pin_level(pin_t pin);
+
+// Makes every expander transaction fail while set
+extern bool     mock_expander_disconnected;
+extern uint32_t mock_expander_transactions;
+
+// Makes every SPI receive fail while set
+extern bool     mock_spi_receive_fails;
+extern uint32_t mock_spi_transfers;
+
+void mock_reset(void);
@@ -0,0 +1,29 @@
+matrix_io_expander_DEFS := -DMATRIX_IO_EXPANDER -DMATRIX_IO_EXPANDER_MCP23018
+matrix_io_expander_INC := $(DRIVER_PATH)/gpio
+matrix_io_expander_CONFIG := $(QUANTUM_PATH)/tests/config_io_expander.h
+
+matrix_io_expander_SRC := \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(QUANTUM_PATH)/tests/matrix_mock.c \
+	$(QUANTUM_PATH)/tests/matrix_io_expander_tests.cpp \
+	$(QUANTUM_PATH)/matrix.c
+
+matrix_74hc595_DEFS := -DMATRIX_SHIFT_REGISTER -DMATRIX_SHIFT_REGISTER_74HC595
+matrix_74hc595_CONFIG := $(QUANTUM_PATH)/tests/config_74hc595.h
+
+matrix_74hc595_SRC := \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(QUANTUM_PATH)/tests/matrix_mock.c \
+	$(QUANTUM_PATH)/tests/matrix_74hc595_tests.cpp \
+	$(QUANTUM_PATH)/matrix.c
+
+matrix_74hc165_DEFS := -DMATRIX_SHIFT_REGISTER -DMATRIX_SHIFT_REGISTER_74HC165
+matrix_74hc165_CONFIG := $(QUANTUM_PATH)/tests/config_74hc165.h
+
+matrix_74hc165_SRC := \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(QUANTUM_PATH)/tests/matrix_mock.c \
+	$(QUANTUM_PATH)/tests/matrix_74hc165_tests.cpp \
+	$(QUANTUM_PATH)/matrix.c
@@ -0,0 +1,4 @@
+TEST_LIST += \
+	matrix_io_expander \
+	matrix_74hc595 \
+	matrix_74hc165
@@ -66,6 +66,10 @@ unicode_config_t unicode_config;
 uint8_t          unicode_saved_mods;
 led_t            unicode_saved_led_state;
 
+// Nesting depth of unicode_input_session_begin() calls, and whether the current session has been set up
+static uint8_t unicode_session_depth;
+static bool    unicode_session_started;
+
 #if UNICODE_SELECTED_MODES != -1
 static uint8_t selected[]     = {UNICODE_SELECTED_MODES};
 static int8_t  selected_count = ARRAY_SIZE(selected);
@@ -207,7 +211,8 @@ void unicode_input_mode_step_reverse(void) {
     cycle_unicode_input_mode(-1);
 }
 
-__attribute__((weak)) void unicode_input_start(void) {
+// Setup and teardown that only needs doing once for a whole run of characters
+static void unicode_input_session_setup(void) {
     unicode_saved_led_state = host_keyboard_led_state();
 
     // Note the order matters here!
@@ -224,16 +229,67 @@ __attribute__((weak)) void unicode_input_start(void) {
 
     switch (unicode_config.input_mode) {
         case UNICODE_MODE_MACOS:
+            // Unicode Hex Input keeps converting digits for as long as Option is held
             register_code(UNICODE_KEY_MAC);
             break;
+        case UNICODE_MODE_WINDOWS:
+            // For increased reliability, use numpad keys for inputting digits
+            if (!unicode_saved_led_state.num_lock) {
+                tap_code(KC_NUM_LOCK);
+            }
+            break;
+    }
+}
+
+static void unicode_input_session_teardown(void) {
+    switch (unicode_config.input_mode) {
+        case UNICODE_MODE_MACOS:
+            unregister_code(UNICODE_KEY_MAC);
+            break;
         case UNICODE_MODE_LINUX:
-            tap_code16(UNICODE_KEY_LNX);
+            if (unicode_saved_led_state.caps_lock) {
+                tap_code(KC_CAPS_LOCK);
+            }
             break;
         case UNICODE_MODE_WINDOWS:
-            // For increased reliability, use numpad keys for inputting digits
             if (!unicode_saved_led_state.num_lock) {
                 tap_code(KC_NUM_LOCK);
             }
+            break;
+    }
+
+    set_mods(unicode_saved_mods); // Reregister previously set mods
+}
+
+void unicode_input_session_begin(void) {
+    unicode_session_depth++;
+}
+
+void unicode_input_session_end(void) {
+    if (unicode_session_depth == 0 || --unicode_session_depth > 0) {
+        return;
+    }
+
+    if (unicode_session_started) {
+        unicode_session_started = false;
+        unicode_input_session_teardown();
+    }
+}
+
+__attribute__((weak)) void unicode_input_start(void) {
+    if (!unicode_session_started) {
+        unicode_input_session_setup();
+        unicode_session_started = unicode_session_depth > 0;
+    } else if (unicode_config.input_mode == UNICODE_MODE_MACOS) {
+        // Option is still held from the previous character
+        return;
+    }
+
+    switch (unicode_config.input_mode) {
+        case UNICODE_MODE_LINUX:
+            tap_code16(UNICODE_KEY_LNX);
+            break;
+        case UNICODE_MODE_WINDOWS:
             register_code(KC_LEFT_ALT);
             wait_ms(UNICODE_TYPE_DELAY);
             tap_code(KC_KP_PLUS);
@@ -255,20 +311,11 @@ __attribute__((weak)) void unicode_input_start(void) {
 
 __attribute__((weak)) void unicode_input_finish(void) {
     switch (unicode_config.input_mode) {
-        case UNICODE_MODE_MACOS:
-            unregister_code(UNICODE_KEY_MAC);
-            break;
         case UNICODE_MODE_LINUX:
             tap_code(KC_SPACE);
-            if (unicode_saved_led_state.caps_lock) {
-                tap_code(KC_CAPS_LOCK);
-            }
             break;
         case UNICODE_MODE_WINDOWS:
             unregister_code(KC_LEFT_ALT);
-            if (!unicode_saved_led_state.num_lock) {
-                tap_code(KC_NUM_LOCK);
-            }
             break;
         case UNICODE_MODE_WINCOMPOSE:
             tap_code(KC_ENTER);
@@ -278,35 +325,30 @@ __attribute__((weak)) void unicode_input_finish(void) {
             break;
     }
 
-    set_mods(unicode_saved_mods); // Reregister previously set mods
+    if (!unicode_session_started) {
+        unicode_input_session_teardown();
+    }
 }
 
 __attribute__((weak)) void unicode_input_cancel(void) {
     switch (unicode_config.input_mode) {
-        case UNICODE_MODE_MACOS:
-            unregister_code(UNICODE_KEY_MAC);
-            break;
         case UNICODE_MODE_LINUX:
             tap_code(KC_ESCAPE);
-            if (unicode_saved_led_state.caps_lock) {
-                tap_code(KC_CAPS_LOCK);
-            }
             break;
         case UNICODE_MODE_WINCOMPOSE:
             tap_code(KC_ESCAPE);
             break;
         case UNICODE_MODE_WINDOWS:
             unregister_code(KC_LEFT_ALT);
-            if (!unicode_saved_led_state.num_lock) {
-                tap_code(KC_NUM_LOCK);
-            }
             break;
         case UNICODE_MODE_EMACS:
             tap_code16(LCTL(KC_G)); // C-g cancels
             break;
     }
 
-    set_mods(unicode_saved_mods); // Reregister previously set mods
+    // Cancelling always ends the session, the next character starts from scratch
+    unicode_session_started = false;
+    unicode_input_session_teardown();
 }
 
 // clang-format off
@@ -380,6 +422,7 @@ void send_unicode_string(const char *str) {
         return;
     }
 
+    unicode_input_session_begin();
     while (*str) {
         int32_t code_point = 0;
         str                = decode_utf8(str, &code_point);
@@ -388,4 +431,52 @@ void send_unicode_string(const char *str) {
             register_unicode(code_point);
         }
     }
+    unicode_input_session_end();
+}
+
+#ifdef UNICODE_QUEUE_SIZE
+STATIC_ASSERT(UNICODE_QUEUE_SIZE > 0 && UNICODE_QUEUE_SIZE <= 255, "UNICODE_QUEUE_SIZE must be between 1 and 255");
+
+static uint32_t unicode_queue[UNICODE_QUEUE_SIZE];
+static uint8_t  unicode_queue_head;
+static uint8_t  unicode_queue_count;
+
+bool send_unicode_string_async(const char *str) {
+    if (!str) {
+        return true;
+    }
+
+    // Make sure the whole string fits, so that it is never typed partially
+    uint8_t     count = 0;
+    const char *next  = str;
+    while (*next) {
+        int32_t code_point = 0;
+        next               = decode_utf8(next, &code_point);
+        if (code_point >= 0 && ++count > UNICODE_QUEUE_SIZE - unicode_queue_count) {
+            return false;
+        }
+    }
+
+    while (*str) {
+        int32_t code_point = 0;
+        str                = decode_utf8(str, &code_point);
+        if (code_point >= 0) {
+            unicode_queue[(unicode_queue_head + unicode_queue_count++) % UNICODE_QUEUE_SIZE] = code_point;
+        }
+    }
+
+    return true;
 }
+
+void unicode_task(void) {
+    if (unicode_queue_count == 0) {
+        return;
+    }
+
+    // One character per pass, so that the rest of the keyboard keeps running while a long string is typed
+    uint32_t code_point = unicode_queue[unicode_queue_head];
+    unicode_queue_head  = (unicode_queue_head + 1) % UNICODE_QUEUE_SIZE;
+    unicode_queue_count--;
+    register_unicode(code_point);
+}
+#endif
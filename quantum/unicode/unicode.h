@@ -17,6 +17,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "compiler_support.h"
 #include "unicode_keycodes.h"
@@ -105,6 +106,20 @@ void unicode_input_finish(void);
  */
 void unicode_input_cancel(void);
 
+/**
+ * \brief Start grouping characters into a single input session.
+ *
+ * Until the matching call to `unicode_input_session_end()`, the per-session parts of the input sequence, such as saving
+ * and restoring modifiers or holding Option on macOS, are only done once rather than for every character. Sessions may
+ * be nested.
+ */
+void unicode_input_session_begin(void);
+
+/**
+ * \brief End an input session started with `unicode_input_session_begin()`.
+ */
+void unicode_input_session_end(void);
+
 /**
  * \brief Send a 16-bit hex number.
  *
@@ -133,4 +148,17 @@ void register_unicode(uint32_t code_point);
  */
 void send_unicode_string(const char *str);
 
+#ifdef UNICODE_QUEUE_SIZE
+/**
+ * \brief Queue a string containing Unicode characters to be sent in the background, one character per keyboard task.
+ *
+ * \param str The string to send.
+ *
+ * \return `false` if there is not enough room left in the queue for the whole string, in which case none of it is sent.
+ */
+bool send_unicode_string_async(const char *str);
+
+void unicode_task(void);
+#endif
+
 /** \} */
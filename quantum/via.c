@@ -24,6 +24,7 @@
 
 #include "via.h"
 
+#include <string.h>
 #include "raw_hid.h"
 #include "dynamic_keymap.h"
 #include "eeconfig.h"
@@ -95,6 +96,8 @@ void via_eeprom_set_valid(bool valid) {
 // the caller also needs to check the valid state.
 __attribute__((weak)) void via_init_kb(void) {}
 
+static bool via_read_buffer_handler(uint8_t *data, uint8_t length);
+
 // Called by QMK core to initialize dynamic keymaps etc.
 void via_init(void) {
     // Let keyboard level test EEPROM valid state,
@@ -102,6 +105,10 @@ void via_init(void) {
     via_init_kb();
     via_set_layout_options_kb(via_get_layout_options());
 
+    // Bulk reads from NVM are answered from the main loop, see via_read_buffer_handler()
+    raw_hid_register_handler(id_dynamic_keymap_get_buffer, via_read_buffer_handler);
+    raw_hid_register_handler(id_dynamic_keymap_macro_get_buffer, via_read_buffer_handler);
+
     // If the EEPROM has the magic, the data is good.
     // OK to load from EEPROM.
     if (!via_eeprom_is_valid()) {
@@ -279,6 +286,45 @@ __attribute__((weak)) bool via_command_kb(uint8_t *data, uint8_t length) {
     return false;
 }
 
+// Reads a block of the keymap or macro buffer into the reply to a get_buffer command
+static void via_read_buffer(uint8_t *data) {
+    uint8_t *command_data = &(data[1]);
+    uint16_t offset       = (command_data[0] << 8) | command_data[1];
+    uint16_t size         = command_data[2]; // size <= 28
+    if (data[0] == id_dynamic_keymap_macro_get_buffer) {
+        dynamic_keymap_macro_get_buffer(offset, size, &command_data[3]);
+    } else {
+        dynamic_keymap_get_buffer(offset, size, &command_data[3]);
+    }
+}
+
+// The request being answered by via_deferred_read(), raw HID reports are always 32 bytes
+static uint8_t via_deferred_request[32];
+
+static raw_hid_stream_state_t via_deferred_read(uint8_t *data, uint8_t length, void *context) {
+    memcpy(data, via_deferred_request, sizeof(via_deferred_request));
+    via_read_buffer(data);
+    return RAW_HID_STREAM_END;
+}
+
+// Editors read the whole keymap and macro buffer in a burst of get_buffer commands. Rather than reading NVM and
+// waiting for the host to take the reply from within the receive, each read is done once the host can take it.
+static bool via_read_buffer_handler(uint8_t *data, uint8_t length) {
+    if (via_command_kb(data, length)) {
+        return false;
+    }
+
+    // The host waits for each reply before sending the next request, so a read is rarely already pending. The stream
+    // only starts from the main loop, so the request can be saved once it has been accepted.
+    if (length <= sizeof(via_deferred_request) && raw_hid_stream(via_deferred_read, NULL)) {
+        memcpy(via_deferred_request, data, length);
+        return false;
+    }
+
+    via_read_buffer(data);
+    return true;
+}
+
 void raw_hid_receive(uint8_t *data, uint8_t length) {
     uint8_t *command_id   = &(data[0]);
     uint8_t *command_data = &(data[1]);
@@ -408,9 +454,7 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
             break;
         }
         case id_dynamic_keymap_macro_get_buffer: {
-            uint16_t offset = (command_data[0] << 8) | command_data[1];
-            uint16_t size   = command_data[2]; // size <= 28
-            dynamic_keymap_macro_get_buffer(offset, size, &command_data[3]);
+            via_read_buffer(data);
             break;
         }
         case id_dynamic_keymap_macro_set_buffer: {
@@ -428,9 +472,7 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
             break;
         }
         case id_dynamic_keymap_get_buffer: {
-            uint16_t offset = (command_data[0] << 8) | command_data[1];
-            uint16_t size   = command_data[2]; // size <= 28
-            dynamic_keymap_get_buffer(offset, size, &command_data[3]);
+            via_read_buffer(data);
             break;
         }
         case id_dynamic_keymap_set_buffer: {
@@ -7,3 +7,8 @@ void virtser_recv(const uint8_t ch);
 
 /* Call this to send a character over the Virtual Serial Device */
 void virtser_send(const uint8_t byte);
+
+/* Call this to send several bytes at once, e.g. a whole steno stroke. They are
+ * enqueued together and flushed to the host straight away rather than waiting
+ * for the next virtser_task() */
+void virtser_send_buffer(const uint8_t *data, uint8_t length);
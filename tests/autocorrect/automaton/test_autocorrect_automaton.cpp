@@ -0,0 +1,216 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include "keycode.h"
+#include "test_common.hpp"
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::InSequence;
+
+class AutoCorrectAutomaton : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+    }
+    // Convenience function to tap `key`.
+    void TapKey(KeymapKey key) {
+        key.press();
+        run_one_scan_loop();
+        key.release();
+        run_one_scan_loop();
+    }
+
+    // Taps in order each key in `keys`.
+    template <typename... Ts>
+    void TapKeys(Ts... keys) {
+        for (KeymapKey key : {keys...}) {
+            TapKey(key);
+        }
+    }
+};
+
+// Test that typing "fales" autocorrects to "false"
+TEST_F(AutoCorrectAutomaton, fales_to_false_autocorrection) {
+    TestDriver driver;
+    auto       key_f = KeymapKey(0, 0, 0, KC_F);
+    auto       key_a = KeymapKey(0, 1, 0, KC_A);
+    auto       key_l = KeymapKey(0, 2, 0, KC_L);
+    auto       key_e = KeymapKey(0, 3, 0, KC_E);
+    auto       key_s = KeymapKey(0, 4, 0, KC_S);
+
+    set_keymap({key_f, key_a, key_l, key_e, key_s});
+
+    // Allow any number of empty reports.
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_F)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+    }
+
+    TapKeys(key_f, key_a, key_l, key_e, key_s);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Test that  typing "ture" autocorrect to "true"
+TEST_F(AutoCorrectAutomaton, ture_to_true_autocorrect) {
+    TestDriver driver;
+    auto       key_t_code = KeymapKey(0, 0, 0, KC_T);
+    auto       key_r      = KeymapKey(0, 1, 0, KC_R);
+    auto       key_u      = KeymapKey(0, 2, 0, KC_U);
+    auto       key_e      = KeymapKey(0, 3, 0, KC_E);
+    auto       key_space  = KeymapKey(0, 4, 0, KC_SPACE);
+
+    set_keymap({key_t_code, key_r, key_u, key_e, key_space});
+
+    // Allow any number of empty reports.
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_SPACE)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_T)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_U)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_R)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE))).Times(2);
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_R)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_U)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+    }
+
+    TapKeys(key_space, key_t_code, key_u, key_r, key_e);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Test that  typing "overture" does not autocorrect
+TEST_F(AutoCorrectAutomaton, overture_should_not_autocorrect) {
+    TestDriver driver;
+    auto       key_t_code = KeymapKey(0, 0, 0, KC_T);
+    auto       key_r      = KeymapKey(0, 1, 0, KC_R);
+    auto       key_u      = KeymapKey(0, 2, 0, KC_U);
+    auto       key_e      = KeymapKey(0, 3, 0, KC_E);
+    auto       key_o      = KeymapKey(0, 4, 0, KC_O);
+    auto       key_v      = KeymapKey(0, 5, 0, KC_V);
+
+    set_keymap({key_t_code, key_r, key_u, key_e, key_o, key_v});
+
+    // Allow any number of empty reports.
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_O)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_V)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_R)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_T)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_U)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_R)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+    }
+
+    TapKeys(key_o, key_v, key_e, key_r, key_t_code, key_u, key_r, key_e);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Test that backspace steps the automaton back, so "fitlr<bs>er" still
+// autocorrects to "filter"
+TEST_F(AutoCorrectAutomaton, backspace_restores_state) {
+    TestDriver driver;
+    auto       key_f    = KeymapKey(0, 0, 0, KC_F);
+    auto       key_i    = KeymapKey(0, 1, 0, KC_I);
+    auto       key_t    = KeymapKey(0, 2, 0, KC_T);
+    auto       key_l    = KeymapKey(0, 3, 0, KC_L);
+    auto       key_e    = KeymapKey(0, 4, 0, KC_E);
+    auto       key_r    = KeymapKey(0, 5, 0, KC_R);
+    auto       key_bspc = KeymapKey(0, 6, 0, KC_BSPC);
+
+    set_keymap({key_f, key_i, key_t, key_l, key_e, key_r, key_bspc});
+
+    // Allow any number of empty reports.
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_F)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_I)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_T)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_R)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE))).Times(3);
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_T)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_R)));
+    }
+
+    TapKeys(key_f, key_i, key_t, key_l, key_r, key_bspc, key_e, key_r);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Test that a typo is still found after the buffer has wrapped around
+TEST_F(AutoCorrectAutomaton, typo_after_buffer_wraps) {
+    TestDriver driver;
+    auto       key_f = KeymapKey(0, 0, 0, KC_F);
+    auto       key_a = KeymapKey(0, 1, 0, KC_A);
+    auto       key_l = KeymapKey(0, 2, 0, KC_L);
+    auto       key_e = KeymapKey(0, 3, 0, KC_E);
+    auto       key_s = KeymapKey(0, 4, 0, KC_S);
+
+    set_keymap({key_f, key_a, key_l, key_e, key_s});
+
+    // Allow any number of empty reports.
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S))).Times(24);
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_F)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+    }
+
+    for (int i = 0; i < 24; ++i) {
+        TapKey(key_s);
+    }
+    TapKeys(key_f, key_a, key_l, key_e, key_s);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Measures the matcher on its own, bypassing the rest of the keyboard stack,
+// compare against the trie variant in tests/autocorrect.
+TEST_F(AutoCorrectAutomaton, benchmark_automaton) {
+    TestDriver  driver;
+    const char *text       = "the quick brown fox jumps over the lazy dog while a tired listener waits ";
+    keyrecord_t record     = {};
+    size_t      keystrokes = 0;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    record.event.pressed = true;
+    auto start           = std::chrono::steady_clock::now();
+    for (int round = 0; round < 10000; ++round) {
+        for (const char *c = text; *c; ++c, ++keystrokes) {
+            process_autocorrect(*c == ' ' ? KC_SPC : KC_A + (*c - 'a'), &record);
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "autocorrect automaton: " << elapsed.count() / keystrokes << " ns/keystroke" << std::endl;
+
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,25 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Generated code.
+
+#pragma once
+
+// Autocorrection dictionary (5 entries):
+//   :guage    -> gauge
+//   fales     -> false
+//   thier     -> their
+//   becuase   -> because
+//   :the:the: -> the
+
+#define AUTOCORRECT_MIN_LENGTH 5 // "fales"
+#define AUTOCORRECT_MAX_LENGTH 9 // ":the:the:"
+#define DICTIONARY_SIZE 1879
+
+#define AUTOCORRECT_AUTOMATON
+#define AUTOCORRECT_AUTOMATON_STATES 32
+#define AUTOCORRECT_AUTOMATON_WORD_SIZE 2
+#define AUTOCORRECT_AUTOMATON_START 1
+
+// Automaton image written to autocorrect_data.bin, flash it at AUTOCORRECT_AUTOMATON_FLASH_ADDRESS.
+#define AUTOCORRECT_AUTOMATON_EXTERNAL_FLASH
@@ -0,0 +1,9 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Away from zero, so that a missing address offset reads the wrong data
+#define AUTOCORRECT_AUTOMATON_FLASH_ADDRESS 0x1000
@@ -0,0 +1,161 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "flash.h"
+#include "autocorrect_data.h"
+#include "autocorrect_flash_image.h"
+}
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::InSequence;
+
+// A mock flash chip holding the automaton image at AUTOCORRECT_AUTOMATON_FLASH_ADDRESS, erased everywhere else
+static int  flash_init_calls       = 0;
+static int  flash_reads            = 0;
+static bool flash_read_before_init = false;
+
+extern "C" {
+void flash_init(void) {
+    ++flash_init_calls;
+}
+
+flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len) {
+    ++flash_reads;
+    if (flash_init_calls == 0) {
+        flash_read_before_init = true;
+        return FLASH_STATUS_ERROR;
+    }
+
+    uint8_t *out = (uint8_t *)buf;
+    for (size_t i = 0; i < len; ++i, ++addr) {
+        bool in_image = addr >= AUTOCORRECT_AUTOMATON_FLASH_ADDRESS && addr < AUTOCORRECT_AUTOMATON_FLASH_ADDRESS + DICTIONARY_SIZE;
+        out[i]        = in_image ? autocorrect_flash_image[addr - AUTOCORRECT_AUTOMATON_FLASH_ADDRESS] : 0xFF;
+    }
+    return FLASH_STATUS_SUCCESS;
+}
+}
+
+class AutoCorrectAutomatonFlash : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+    }
+
+    void TearDown() override {
+        // However many keys were looked up, the driver was initialized lazily and only once
+        EXPECT_FALSE(flash_read_before_init);
+        EXPECT_GT(flash_reads, 0);
+        EXPECT_EQ(flash_init_calls, 1);
+    }
+
+    // Convenience function to tap `key`.
+    void TapKey(KeymapKey key) {
+        key.press();
+        run_one_scan_loop();
+        key.release();
+        run_one_scan_loop();
+    }
+
+    // Taps in order each key in `keys`.
+    template <typename... Ts>
+    void TapKeys(Ts... keys) {
+        for (KeymapKey key : {keys...}) {
+            TapKey(key);
+        }
+    }
+};
+
+// Test that typing "fales" autocorrects to "false", with the correction read back from flash
+TEST_F(AutoCorrectAutomatonFlash, fales_to_false_autocorrection) {
+    TestDriver driver;
+    auto       key_f = KeymapKey(0, 0, 0, KC_F);
+    auto       key_a = KeymapKey(0, 1, 0, KC_A);
+    auto       key_l = KeymapKey(0, 2, 0, KC_L);
+    auto       key_e = KeymapKey(0, 3, 0, KC_E);
+    auto       key_s = KeymapKey(0, 4, 0, KC_S);
+
+    set_keymap({key_f, key_a, key_l, key_e, key_s});
+
+    // Allow any number of empty reports.
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_F)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+    }
+
+    TapKeys(key_f, key_a, key_l, key_e, key_s);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Test that typing "becuase" autocorrects to "because"
+TEST_F(AutoCorrectAutomatonFlash, becuase_to_because_autocorrection) {
+    TestDriver driver;
+    auto       key_b = KeymapKey(0, 0, 0, KC_B);
+    auto       key_e = KeymapKey(0, 1, 0, KC_E);
+    auto       key_c = KeymapKey(0, 2, 0, KC_C);
+    auto       key_u = KeymapKey(0, 3, 0, KC_U);
+    auto       key_a = KeymapKey(0, 4, 0, KC_A);
+    auto       key_s = KeymapKey(0, 5, 0, KC_S);
+
+    set_keymap({key_b, key_e, key_c, key_u, key_a, key_s});
+
+    // Allow any number of empty reports.
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_B)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_C)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_U)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE))).Times(3);
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_U)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+    }
+
+    TapKeys(key_b, key_e, key_c, key_u, key_a, key_s, key_e);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Test that typing "false" does not autocorrect
+TEST_F(AutoCorrectAutomatonFlash, false_should_not_autocorrect) {
+    TestDriver driver;
+    auto       key_f = KeymapKey(0, 0, 0, KC_F);
+    auto       key_a = KeymapKey(0, 1, 0, KC_A);
+    auto       key_l = KeymapKey(0, 2, 0, KC_L);
+    auto       key_s = KeymapKey(0, 3, 0, KC_S);
+    auto       key_e = KeymapKey(0, 4, 0, KC_E);
+
+    set_keymap({key_f, key_a, key_l, key_s, key_e});
+
+    // Allow any number of empty reports.
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_F)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+    }
+
+    TapKeys(key_f, key_a, key_l, key_s, key_e);
+
+    VERIFY_AND_CLEAR(driver);
+}
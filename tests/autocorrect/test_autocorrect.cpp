@@ -1,6 +1,8 @@
 // Copyright 2021 Christopher Courtney, aka Drashna Jael're  (@drashna) <drashna@live.com>
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <chrono>
+#include <iostream>
 #include "keycode.h"
 #include "test_common.hpp"
 
@@ -202,3 +204,26 @@ TEST_F(AutoCorrect, overture_should_not_autocorrect) {
 
     VERIFY_AND_CLEAR(driver);
 }
+
+// Measures the matcher on its own, bypassing the rest of the keyboard stack,
+// compare against the automaton variant in tests/autocorrect/automaton.
+TEST_F(AutoCorrect, benchmark_trie) {
+    TestDriver  driver;
+    const char *text       = "the quick brown fox jumps over the lazy dog while a tired listener waits ";
+    keyrecord_t record     = {};
+    size_t      keystrokes = 0;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    record.event.pressed = true;
+    auto start           = std::chrono::steady_clock::now();
+    for (int round = 0; round < 10000; ++round) {
+        for (const char *c = text; *c; ++c, ++keystrokes) {
+            process_autocorrect(*c == ' ' ? KC_SPC : KC_A + (*c - 'a'), &record);
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "autocorrect trie: " << elapsed.count() / keystrokes << " ns/keystroke" << std::endl;
+
+    VERIFY_AND_CLEAR(driver);
+}
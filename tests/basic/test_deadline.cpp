@@ -0,0 +1,100 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "deadline.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class Deadline : public TestFixture {
+   public:
+    void TearDown() override {
+        for (uint8_t id = 0; id < DEADLINE_COUNT; ++id) {
+            deadline_clear((deadline_id_t)id);
+        }
+        TestFixture::TearDown();
+    }
+};
+
+TEST_F(Deadline, NextReturnsEarliestDeadline) {
+    uint16_t when = 0;
+
+    EXPECT_FALSE(deadline_next(&when));
+
+    deadline_set(DEADLINE_LEADER, 300);
+    deadline_set(DEADLINE_COMBO, 100);
+    deadline_set(DEADLINE_CAPS_WORD, 200);
+    EXPECT_TRUE(deadline_next(&when));
+    EXPECT_EQ(when, 100);
+
+    deadline_clear(DEADLINE_COMBO);
+    EXPECT_TRUE(deadline_next(&when));
+    EXPECT_EQ(when, 200);
+
+    // Moving a deadline later reorders it behind the others
+    deadline_set(DEADLINE_CAPS_WORD, 400);
+    EXPECT_TRUE(deadline_next(&when));
+    EXPECT_EQ(when, 300);
+
+    deadline_clear(DEADLINE_LEADER);
+    deadline_clear(DEADLINE_CAPS_WORD);
+    EXPECT_FALSE(deadline_next(&when));
+}
+
+TEST_F(Deadline, OrdersDeadlinesAcrossTimerWrap) {
+    uint16_t when = 0;
+
+    deadline_set(DEADLINE_LEADER, 0x0010);
+    deadline_set(DEADLINE_COMBO, 0xFFF0);
+    EXPECT_TRUE(deadline_next(&when));
+    EXPECT_EQ(when, 0xFFF0);
+}
+
+TEST_F(Deadline, ExpiresAtScheduledTime) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    deadline_set(DEADLINE_COMBO, timer_read() + 10);
+    EXPECT_TRUE(deadline_is_set(DEADLINE_COMBO));
+    EXPECT_FALSE(deadline_pending());
+
+    idle_for(9);
+    EXPECT_FALSE(deadline_expired(DEADLINE_COMBO));
+    idle_for(1);
+    EXPECT_TRUE(deadline_expired(DEADLINE_COMBO));
+    EXPECT_TRUE(deadline_pending());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Deadline, TappingTermScheduledOnlyWhileUnsettled) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 7, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(deadline_is_set(DEADLINE_TAPPING));
+    VERIFY_AND_CLEAR(driver);
+
+    // The hold is settled by the tick at the end of the tapping term
+    EXPECT_REPORT(driver, (KC_LSFT));
+    idle_for(TAPPING_TERM);
+    EXPECT_FALSE(deadline_is_set(DEADLINE_TAPPING));
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    EXPECT_FALSE(deadline_is_set(DEADLINE_TAPPING));
+    VERIFY_AND_CLEAR(driver);
+}
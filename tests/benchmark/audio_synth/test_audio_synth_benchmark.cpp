@@ -0,0 +1,182 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "synth.h"
+}
+
+#define SAMPLE_RATE 24576
+#define BLOCK_SIZE 32
+#define WAVETABLE_LENGTH 256
+#define OFF_VALUE 2047
+#define NOTE_BLOCKS 80
+
+// Frequencies of the notes in the test melody, in Hz
+#define C5 523.25f
+#define E5 659.25f
+#define G5 783.99f
+#define A4 440.0f
+
+static uint16_t wavetable[WAVETABLE_LENGTH];
+
+struct melody_step_t {
+    std::vector<float> tones;
+    int                blocks;
+};
+
+// A single note, a chord where the first note moves, a rest, then a lower note which is released at the end
+static const std::vector<melody_step_t> melody = {
+    {{C5}, NOTE_BLOCKS}, {{E5, G5}, NOTE_BLOCKS}, {{}, NOTE_BLOCKS / 2}, {{A4}, NOTE_BLOCKS}, {{}, NOTE_BLOCKS / 2},
+};
+
+class AudioSynthBenchmark : public ::testing::Test {
+   public:
+    static void SetUpTestSuite() {
+        // A 12-bit sine wave centred on OFF_VALUE
+        for (int i = 0; i < WAVETABLE_LENGTH; ++i) {
+            wavetable[i] = (uint16_t)lround(OFF_VALUE - OFF_VALUE * cos(2 * M_PI * i / WAVETABLE_LENGTH));
+        }
+    }
+
+    void SetUp() override {
+        audio_synth_init(wavetable, WAVETABLE_LENGTH, SAMPLE_RATE, OFF_VALUE);
+    }
+
+    void set_tones(const std::vector<float> &tones) {
+        std::vector<uint32_t> frequencies;
+        for (float tone : tones) {
+            frequencies.push_back(AUDIO_SYNTH_FREQUENCY(tone));
+        }
+        audio_synth_set_tones(frequencies.data(), frequencies.size());
+    }
+
+    // Renders the melody a block at a time, the same way the DAC driver fills each half of its DMA buffer
+    std::vector<uint16_t> render_melody() {
+        std::vector<uint16_t> samples;
+        for (const auto &step : melody) {
+            set_tones(step.tones);
+            for (int b = 0; b < step.blocks; ++b) {
+                samples.resize(samples.size() + BLOCK_SIZE);
+                audio_synth_render(&samples[samples.size() - BLOCK_SIZE], BLOCK_SIZE);
+            }
+        }
+        return samples;
+    }
+
+    // Signal power at the given frequency, using the Goertzel algorithm over a Hann window
+    static double power_at(const uint16_t *samples, size_t count, double frequency) {
+        double coeff = 2 * cos(2 * M_PI * frequency / SAMPLE_RATE);
+        double s1 = 0, s2 = 0;
+        for (size_t i = 0; i < count; ++i) {
+            double window = 0.5 - 0.5 * cos(2 * M_PI * i / (count - 1));
+            double s0     = ((double)samples[i] - OFF_VALUE) * window + coeff * s1 - s2;
+            s2        = s1;
+            s1        = s0;
+        }
+        return (s1 * s1 + s2 * s2 - coeff * s1 * s2) / count;
+    }
+
+    // Checks the given tones dominate a section of output, compared to the notes a semitone either side of them
+    static void expect_tones(const uint16_t *samples, size_t count, const std::vector<float> &tones) {
+        for (float tone : tones) {
+            double power = power_at(samples, count, tone);
+            EXPECT_GT(power, 100 * power_at(samples, count, tone * 1.0595)) << "tone " << tone;
+            EXPECT_GT(power, 100 * power_at(samples, count, tone / 1.0595)) << "tone " << tone;
+        }
+    }
+
+    static uint32_t crc32(const std::vector<uint16_t> &samples) {
+        uint32_t crc = 0xFFFFFFFF;
+        for (uint16_t sample : samples) {
+            for (int i = 0; i < 2; ++i) {
+                crc ^= (sample >> (8 * i)) & 0xFF;
+                for (int bit = 0; bit < 8; ++bit) {
+                    crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+                }
+            }
+        }
+        return ~crc;
+    }
+};
+
+TEST_F(AudioSynthBenchmark, renders_melody) {
+    std::vector<uint16_t> samples = render_melody();
+    const size_t          note    = NOTE_BLOCKS * BLOCK_SIZE;
+    const size_t          settle  = SAMPLE_RATE * (AUDIO_SYNTH_RELEASE_MS + 2) / 1000;
+
+    // Once the attack is done, a lone note matches the wavetable stepped through at the exact frequency, allowing for
+    // the Q16.16 phase landing either side of a wavetable entry boundary
+    double phase = 0;
+    for (size_t i = 0; i < note; ++i) {
+        if (i >= settle) {
+            int before = wavetable[(size_t)(phase + WAVETABLE_LENGTH - 0.05) % WAVETABLE_LENGTH];
+            int after  = wavetable[(size_t)(phase + 0.05) % WAVETABLE_LENGTH];
+            EXPECT_TRUE(abs(samples[i] - before) <= 1 || abs(samples[i] - after) <= 1) << "sample " << i;
+        }
+        phase = fmod(phase + (double)C5 * WAVETABLE_LENGTH / SAMPLE_RATE, WAVETABLE_LENGTH);
+    }
+
+    expect_tones(&samples[settle], note - settle, {C5});
+    expect_tones(&samples[note + settle], note - settle, {E5, G5});
+    expect_tones(&samples[5 * note / 2 + settle], note - settle, {A4});
+
+    // The rest is silent once the chord has faded out
+    for (size_t i = 2 * note + settle; i < 5 * note / 2; ++i) {
+        EXPECT_EQ(samples[i], OFF_VALUE) << "sample " << i;
+    }
+
+    // Starting, stopping and changing tones never jumps further than the steepest part of the highest tone's waveform
+    int max_step = (int)ceil(2 * M_PI * G5 * OFF_VALUE / SAMPLE_RATE) + 2 * OFF_VALUE * 2 * M_PI / WAVETABLE_LENGTH;
+    for (size_t i = 1; i < samples.size(); ++i) {
+        ASSERT_LE(abs((int)samples[i] - (int)samples[i - 1]), max_step) << "sample " << i;
+    }
+
+    // The output finishes exactly at the off value, with nothing left playing
+    EXPECT_TRUE(audio_synth_is_silent());
+    EXPECT_EQ(samples.back(), OFF_VALUE);
+
+    // Rendering is integer-only, so the output is bit-exact on every platform
+    EXPECT_EQ(crc32(samples), 0xB958D920u);
+}
+
+TEST_F(AudioSynthBenchmark, voices_are_reused) {
+    // More tones than there are voices just drops the excess
+    std::vector<float> tones;
+    for (int i = 0; i < AUDIO_SYNTH_MAX_VOICES + 4; ++i) {
+        tones.push_back(220.0f * (i + 1));
+    }
+    set_tones(tones);
+    std::vector<uint16_t> samples(BLOCK_SIZE);
+    audio_synth_render(samples.data(), BLOCK_SIZE);
+    EXPECT_FALSE(audio_synth_is_silent());
+
+    // Constantly changing tones (e.g. vibrato) retune the same voices rather than running out of them
+    for (int i = 0; i < 1000; ++i) {
+        set_tones({A4 + (i % 10)});
+        audio_synth_render(samples.data(), BLOCK_SIZE);
+    }
+    set_tones({});
+    for (int i = 0; i < NOTE_BLOCKS && !audio_synth_is_silent(); ++i) {
+        audio_synth_render(samples.data(), BLOCK_SIZE);
+    }
+    EXPECT_TRUE(audio_synth_is_silent());
+}
+
+TEST_F(AudioSynthBenchmark, render_speed) {
+    std::vector<uint16_t> samples(BLOCK_SIZE);
+    set_tones({C5, E5, G5, A4});
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < SAMPLE_RATE * 10 / BLOCK_SIZE; ++i) {
+        audio_synth_render(samples.data(), BLOCK_SIZE);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "4 voices: " << (double)elapsed / (SAMPLE_RATE * 10) << "ns per sample" << std::endl;
+}
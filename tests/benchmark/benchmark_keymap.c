@@ -0,0 +1,47 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+enum tap_dances { TD_ESC_CAPS };
+
+// clang-format off
+tap_dance_action_t tap_dance_actions[] = {
+    [TD_ESC_CAPS] = ACTION_TAP_DANCE_DOUBLE(KC_ESC, KC_CAPS),
+};
+
+const uint16_t jk_combo[] = {KC_J, KC_K, COMBO_END};
+const uint16_t df_combo[] = {KC_D, KC_F, COMBO_END};
+const uint16_t we_combo[] = {KC_W, KC_E, COMBO_END};
+const uint16_t io_combo[] = {KC_I, KC_O, COMBO_END};
+
+combo_t key_combos[] = {
+    COMBO(jk_combo, KC_ESC),
+    COMBO(df_combo, KC_TAB),
+    COMBO(we_combo, KC_LBRC),
+    COMBO(io_combo, KC_RBRC),
+};
+
+// A spread of overrides so that every event has to be checked against them,
+// as on keymaps that remap most of the number row.
+const key_override_t bspc_override = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t dot_override  = ko_make_basic(MOD_MASK_SHIFT, KC_DOT, KC_EXLM);
+const key_override_t comm_override = ko_make_basic(MOD_MASK_SHIFT, KC_COMM, KC_QUES);
+const key_override_t quot_override = ko_make_basic(MOD_MASK_SHIFT, KC_QUOT, KC_GRV);
+const key_override_t one_override  = ko_make_basic(MOD_MASK_CTRL, KC_1, KC_F1);
+const key_override_t two_override  = ko_make_basic(MOD_MASK_CTRL, KC_2, KC_F2);
+const key_override_t tre_override  = ko_make_basic(MOD_MASK_CTRL, KC_3, KC_F3);
+const key_override_t for_override  = ko_make_basic(MOD_MASK_CTRL, KC_4, KC_F4);
+const key_override_t fiv_override  = ko_make_basic(MOD_MASK_CTRL, KC_5, KC_F5);
+const key_override_t six_override  = ko_make_basic(MOD_MASK_CTRL, KC_6, KC_F6);
+const key_override_t sev_override  = ko_make_basic(MOD_MASK_CTRL, KC_7, KC_F7);
+const key_override_t eig_override  = ko_make_basic(MOD_MASK_CTRL, KC_8, KC_F8);
+const key_override_t nin_override  = ko_make_basic(MOD_MASK_CTRL, KC_9, KC_F9);
+const key_override_t zer_override  = ko_make_basic(MOD_MASK_CTRL, KC_0, KC_F10);
+
+const key_override_t *key_overrides[] = {
+    &bspc_override, &dot_override, &comm_override, &quot_override,
+    &one_override, &two_override, &tre_override, &for_override, &fiv_override,
+    &six_override, &sev_override, &eig_override, &nin_override, &zer_override,
+};
+// clang-format on
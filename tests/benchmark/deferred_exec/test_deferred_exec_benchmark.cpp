@@ -0,0 +1,171 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define TABLE_SIZE 250
+
+static std::vector<uintptr_t> fired;
+
+static uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    fired.push_back((uintptr_t)cb_arg);
+    return 0;
+}
+
+static uint32_t repeat_callback(uint32_t trigger_time, void *cb_arg) {
+    fired.push_back((uintptr_t)cb_arg);
+    return (uint32_t)(uintptr_t)cb_arg;
+}
+
+class DeferredExecBenchmark : public TestFixture {
+   public:
+    void SetUp() override {
+        memset(table, 0, sizeof(table));
+        last_execution = 0;
+        fired.clear();
+    }
+
+    void run_until(uint32_t time) {
+        while (timer_read32() < time) {
+            advance_time(1);
+            deferred_exec_advanced_task(table, TABLE_SIZE, &last_execution);
+        }
+    }
+
+    deferred_executor_t table[TABLE_SIZE];
+    uint32_t            last_execution;
+};
+
+TEST_F(DeferredExecBenchmark, fires_in_deadline_order) {
+    // Scheduled in a scrambled order, expected to fire by delay
+    for (uintptr_t i = 0; i < TABLE_SIZE; ++i) {
+        uintptr_t delay = 1 + (i * 97) % TABLE_SIZE;
+        EXPECT_NE(defer_exec_advanced(table, TABLE_SIZE, delay, record_callback, (void *)delay), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer_exec_advanced(table, TABLE_SIZE, 1, record_callback, NULL), INVALID_DEFERRED_TOKEN);
+
+    run_until(TABLE_SIZE + 1);
+    ASSERT_EQ(fired.size(), TABLE_SIZE);
+    for (uintptr_t i = 0; i < TABLE_SIZE; ++i) {
+        EXPECT_EQ(fired[i], i + 1);
+    }
+
+    uint32_t next;
+    EXPECT_FALSE(deferred_exec_advanced_next(table, TABLE_SIZE, &next));
+}
+
+TEST_F(DeferredExecBenchmark, next_deadline) {
+    uint32_t next;
+    EXPECT_FALSE(deferred_exec_advanced_next(table, TABLE_SIZE, &next));
+
+    deferred_token late  = defer_exec_advanced(table, TABLE_SIZE, 500, record_callback, (void *)1);
+    deferred_token early = defer_exec_advanced(table, TABLE_SIZE, 100, record_callback, (void *)2);
+    EXPECT_TRUE(deferred_exec_advanced_next(table, TABLE_SIZE, &next));
+    EXPECT_EQ(next, 100);
+
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, TABLE_SIZE, early, 1000));
+    EXPECT_TRUE(deferred_exec_advanced_next(table, TABLE_SIZE, &next));
+    EXPECT_EQ(next, 500);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, TABLE_SIZE, late));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, TABLE_SIZE, late));
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, TABLE_SIZE, late, 10));
+    EXPECT_TRUE(deferred_exec_advanced_next(table, TABLE_SIZE, &next));
+    EXPECT_EQ(next, 1000);
+
+    run_until(1000);
+    EXPECT_EQ(fired, std::vector<uintptr_t>({2}));
+}
+
+TEST_F(DeferredExecBenchmark, repeats_and_cancels) {
+    defer_exec_advanced(table, TABLE_SIZE, 30, repeat_callback, (void *)30);
+    defer_exec_advanced(table, TABLE_SIZE, 20, repeat_callback, (void *)20);
+    deferred_token once = defer_exec_advanced(table, TABLE_SIZE, 50, record_callback, (void *)50);
+    deferred_token gone = defer_exec_advanced(table, TABLE_SIZE, 45, record_callback, (void *)45);
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, TABLE_SIZE, gone));
+
+    run_until(55);
+    EXPECT_EQ(fired, std::vector<uintptr_t>({20, 30, 20, 50}));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, TABLE_SIZE, once));
+}
+
+TEST_F(DeferredExecBenchmark, catches_up_once_per_task) {
+    defer_exec_advanced(table, TABLE_SIZE, 10, repeat_callback, (void *)10);
+
+    // A long stall only invokes the repeating executor once per task, with its original cadence retained
+    set_time(100);
+    deferred_exec_advanced_task(table, TABLE_SIZE, &last_execution);
+    EXPECT_EQ(fired.size(), 1);
+
+    uint32_t next;
+    EXPECT_TRUE(deferred_exec_advanced_next(table, TABLE_SIZE, &next));
+    EXPECT_EQ(next, 20);
+}
+
+TEST_F(DeferredExecBenchmark, overdue_repeat_does_not_starve_others) {
+    defer_exec_advanced(table, TABLE_SIZE, 1, repeat_callback, (void *)1);
+    defer_exec_advanced(table, TABLE_SIZE, 50, record_callback, (void *)50);
+
+    // Still overdue after requeueing itself, but every due executor runs once in the task
+    set_time(60);
+    deferred_exec_advanced_task(table, TABLE_SIZE, &last_execution);
+    EXPECT_EQ(fired, std::vector<uintptr_t>({1, 50}));
+
+    uint32_t next;
+    EXPECT_TRUE(deferred_exec_advanced_next(table, TABLE_SIZE, &next));
+    EXPECT_EQ(next, 2);
+}
+
+TEST_F(DeferredExecBenchmark, drains_more_due_than_basic_table) {
+    for (uintptr_t i = 0; i < TABLE_SIZE; ++i) {
+        defer_exec_advanced(table, TABLE_SIZE, 5, record_callback, (void *)i);
+    }
+
+    // Everything falls due at once; the overflow is picked up by the following tasks within the same millisecond
+    set_time(5);
+    for (int task = 0; task < TABLE_SIZE && fired.size() < TABLE_SIZE; ++task) {
+        deferred_exec_advanced_task(table, TABLE_SIZE, &last_execution);
+    }
+    EXPECT_EQ(fired.size(), TABLE_SIZE);
+    EXPECT_EQ(timer_read32(), 5);
+
+    uint32_t next;
+    EXPECT_FALSE(deferred_exec_advanced_next(table, TABLE_SIZE, &next));
+}
+
+TEST_F(DeferredExecBenchmark, churn) {
+    std::vector<deferred_token> tokens(TABLE_SIZE);
+    size_t                      operations = 0;
+
+    for (uintptr_t i = 0; i < TABLE_SIZE; ++i) {
+        tokens[i] = defer_exec_advanced(table, TABLE_SIZE, 100000 + i, record_callback, (void *)i);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < 2000; ++round) {
+        for (uintptr_t i = 0; i < TABLE_SIZE; i += 7, operations += 2) {
+            EXPECT_TRUE(cancel_deferred_exec_advanced(table, TABLE_SIZE, tokens[i]));
+            tokens[i] = defer_exec_advanced(table, TABLE_SIZE, 1000 + (i * 31 + round) % 997, record_callback, (void *)i);
+        }
+        for (uintptr_t i = 3; i < TABLE_SIZE; i += 11, ++operations) {
+            EXPECT_TRUE(extend_deferred_exec_advanced(table, TABLE_SIZE, tokens[i], 1000 + (i * 17 + round) % 991));
+        }
+        advance_time(1);
+        deferred_exec_advanced_task(table, TABLE_SIZE, &last_execution);
+        ++operations;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << TABLE_SIZE << " deferred executors: " << elapsed.count() / operations << " ns/operation" << std::endl;
+
+    EXPECT_TRUE(fired.empty());
+}
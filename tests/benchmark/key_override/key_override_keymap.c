@@ -0,0 +1,165 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// A large set of overrides, as on keymaps that remap most of the keyboard for
+// each modifier. The last one repeats the first one, so the first one always
+// wins.
+// clang-format off
+const key_override_t c_a_override       = ko_make_basic(MOD_MASK_CTRL, KC_A, KC_B);
+const key_override_t c_b_override       = ko_make_basic(MOD_MASK_CTRL, KC_B, KC_C);
+const key_override_t c_c_override       = ko_make_basic(MOD_MASK_CTRL, KC_C, KC_D);
+const key_override_t c_d_override       = ko_make_basic(MOD_MASK_CTRL, KC_D, KC_E);
+const key_override_t c_e_override       = ko_make_basic(MOD_MASK_CTRL, KC_E, KC_F);
+const key_override_t c_f_override       = ko_make_basic(MOD_MASK_CTRL, KC_F, KC_G);
+const key_override_t c_g_override       = ko_make_basic(MOD_MASK_CTRL, KC_G, KC_H);
+const key_override_t c_h_override       = ko_make_basic(MOD_MASK_CTRL, KC_H, KC_I);
+const key_override_t c_i_override       = ko_make_basic(MOD_MASK_CTRL, KC_I, KC_J);
+const key_override_t c_j_override       = ko_make_basic(MOD_MASK_CTRL, KC_J, KC_K);
+const key_override_t c_k_override       = ko_make_basic(MOD_MASK_CTRL, KC_K, KC_L);
+const key_override_t c_l_override       = ko_make_basic(MOD_MASK_CTRL, KC_L, KC_M);
+const key_override_t c_m_override       = ko_make_basic(MOD_MASK_CTRL, KC_M, KC_N);
+const key_override_t c_n_override       = ko_make_basic(MOD_MASK_CTRL, KC_N, KC_O);
+const key_override_t c_o_override       = ko_make_basic(MOD_MASK_CTRL, KC_O, KC_P);
+const key_override_t c_p_override       = ko_make_basic(MOD_MASK_CTRL, KC_P, KC_Q);
+const key_override_t c_q_override       = ko_make_basic(MOD_MASK_CTRL, KC_Q, KC_R);
+const key_override_t c_r_override       = ko_make_basic(MOD_MASK_CTRL, KC_R, KC_S);
+const key_override_t c_s_override       = ko_make_basic(MOD_MASK_CTRL, KC_S, KC_T);
+const key_override_t c_t_override       = ko_make_basic(MOD_MASK_CTRL, KC_T, KC_U);
+const key_override_t c_u_override       = ko_make_basic(MOD_MASK_CTRL, KC_U, KC_V);
+const key_override_t c_v_override       = ko_make_basic(MOD_MASK_CTRL, KC_V, KC_W);
+const key_override_t c_w_override       = ko_make_basic(MOD_MASK_CTRL, KC_W, KC_X);
+const key_override_t c_x_override       = ko_make_basic(MOD_MASK_CTRL, KC_X, KC_Y);
+const key_override_t c_y_override       = ko_make_basic(MOD_MASK_CTRL, KC_Y, KC_Z);
+const key_override_t c_z_override       = ko_make_basic(MOD_MASK_CTRL, KC_Z, KC_A);
+const key_override_t a_a_override       = ko_make_basic(MOD_MASK_ALT, KC_A, KC_C);
+const key_override_t a_b_override       = ko_make_basic(MOD_MASK_ALT, KC_B, KC_D);
+const key_override_t a_c_override       = ko_make_basic(MOD_MASK_ALT, KC_C, KC_E);
+const key_override_t a_d_override       = ko_make_basic(MOD_MASK_ALT, KC_D, KC_F);
+const key_override_t a_e_override       = ko_make_basic(MOD_MASK_ALT, KC_E, KC_G);
+const key_override_t a_f_override       = ko_make_basic(MOD_MASK_ALT, KC_F, KC_H);
+const key_override_t a_g_override       = ko_make_basic(MOD_MASK_ALT, KC_G, KC_I);
+const key_override_t a_h_override       = ko_make_basic(MOD_MASK_ALT, KC_H, KC_J);
+const key_override_t a_i_override       = ko_make_basic(MOD_MASK_ALT, KC_I, KC_K);
+const key_override_t a_j_override       = ko_make_basic(MOD_MASK_ALT, KC_J, KC_L);
+const key_override_t a_k_override       = ko_make_basic(MOD_MASK_ALT, KC_K, KC_M);
+const key_override_t a_l_override       = ko_make_basic(MOD_MASK_ALT, KC_L, KC_N);
+const key_override_t a_m_override       = ko_make_basic(MOD_MASK_ALT, KC_M, KC_O);
+const key_override_t a_n_override       = ko_make_basic(MOD_MASK_ALT, KC_N, KC_P);
+const key_override_t a_o_override       = ko_make_basic(MOD_MASK_ALT, KC_O, KC_Q);
+const key_override_t a_p_override       = ko_make_basic(MOD_MASK_ALT, KC_P, KC_R);
+const key_override_t a_q_override       = ko_make_basic(MOD_MASK_ALT, KC_Q, KC_S);
+const key_override_t a_r_override       = ko_make_basic(MOD_MASK_ALT, KC_R, KC_T);
+const key_override_t a_s_override       = ko_make_basic(MOD_MASK_ALT, KC_S, KC_U);
+const key_override_t a_t_override       = ko_make_basic(MOD_MASK_ALT, KC_T, KC_V);
+const key_override_t a_u_override       = ko_make_basic(MOD_MASK_ALT, KC_U, KC_W);
+const key_override_t a_v_override       = ko_make_basic(MOD_MASK_ALT, KC_V, KC_X);
+const key_override_t a_w_override       = ko_make_basic(MOD_MASK_ALT, KC_W, KC_Y);
+const key_override_t a_x_override       = ko_make_basic(MOD_MASK_ALT, KC_X, KC_Z);
+const key_override_t a_y_override       = ko_make_basic(MOD_MASK_ALT, KC_Y, KC_A);
+const key_override_t a_z_override       = ko_make_basic(MOD_MASK_ALT, KC_Z, KC_B);
+const key_override_t g_a_override       = ko_make_basic(MOD_MASK_GUI, KC_A, KC_D);
+const key_override_t g_b_override       = ko_make_basic(MOD_MASK_GUI, KC_B, KC_E);
+const key_override_t g_c_override       = ko_make_basic(MOD_MASK_GUI, KC_C, KC_F);
+const key_override_t g_d_override       = ko_make_basic(MOD_MASK_GUI, KC_D, KC_G);
+const key_override_t g_e_override       = ko_make_basic(MOD_MASK_GUI, KC_E, KC_H);
+const key_override_t g_f_override       = ko_make_basic(MOD_MASK_GUI, KC_F, KC_I);
+const key_override_t g_g_override       = ko_make_basic(MOD_MASK_GUI, KC_G, KC_J);
+const key_override_t g_h_override       = ko_make_basic(MOD_MASK_GUI, KC_H, KC_K);
+const key_override_t g_i_override       = ko_make_basic(MOD_MASK_GUI, KC_I, KC_L);
+const key_override_t g_j_override       = ko_make_basic(MOD_MASK_GUI, KC_J, KC_M);
+const key_override_t g_k_override       = ko_make_basic(MOD_MASK_GUI, KC_K, KC_N);
+const key_override_t g_l_override       = ko_make_basic(MOD_MASK_GUI, KC_L, KC_O);
+const key_override_t g_m_override       = ko_make_basic(MOD_MASK_GUI, KC_M, KC_P);
+const key_override_t g_n_override       = ko_make_basic(MOD_MASK_GUI, KC_N, KC_Q);
+const key_override_t g_o_override       = ko_make_basic(MOD_MASK_GUI, KC_O, KC_R);
+const key_override_t g_p_override       = ko_make_basic(MOD_MASK_GUI, KC_P, KC_S);
+const key_override_t g_q_override       = ko_make_basic(MOD_MASK_GUI, KC_Q, KC_T);
+const key_override_t g_r_override       = ko_make_basic(MOD_MASK_GUI, KC_R, KC_U);
+const key_override_t g_s_override       = ko_make_basic(MOD_MASK_GUI, KC_S, KC_V);
+const key_override_t g_t_override       = ko_make_basic(MOD_MASK_GUI, KC_T, KC_W);
+const key_override_t g_u_override       = ko_make_basic(MOD_MASK_GUI, KC_U, KC_X);
+const key_override_t g_v_override       = ko_make_basic(MOD_MASK_GUI, KC_V, KC_Y);
+const key_override_t g_w_override       = ko_make_basic(MOD_MASK_GUI, KC_W, KC_Z);
+const key_override_t g_x_override       = ko_make_basic(MOD_MASK_GUI, KC_X, KC_A);
+const key_override_t g_y_override       = ko_make_basic(MOD_MASK_GUI, KC_Y, KC_B);
+const key_override_t g_z_override       = ko_make_basic(MOD_MASK_GUI, KC_Z, KC_C);
+const key_override_t ca_a_override      = ko_make_basic(MOD_MASK_CA, KC_A, KC_E);
+const key_override_t ca_b_override      = ko_make_basic(MOD_MASK_CA, KC_B, KC_F);
+const key_override_t ca_c_override      = ko_make_basic(MOD_MASK_CA, KC_C, KC_G);
+const key_override_t ca_d_override      = ko_make_basic(MOD_MASK_CA, KC_D, KC_H);
+const key_override_t ca_e_override      = ko_make_basic(MOD_MASK_CA, KC_E, KC_I);
+const key_override_t ca_f_override      = ko_make_basic(MOD_MASK_CA, KC_F, KC_J);
+const key_override_t ca_g_override      = ko_make_basic(MOD_MASK_CA, KC_G, KC_K);
+const key_override_t ca_h_override      = ko_make_basic(MOD_MASK_CA, KC_H, KC_L);
+const key_override_t ca_i_override      = ko_make_basic(MOD_MASK_CA, KC_I, KC_M);
+const key_override_t ca_j_override      = ko_make_basic(MOD_MASK_CA, KC_J, KC_N);
+const key_override_t ca_k_override      = ko_make_basic(MOD_MASK_CA, KC_K, KC_O);
+const key_override_t ca_l_override      = ko_make_basic(MOD_MASK_CA, KC_L, KC_P);
+const key_override_t ca_m_override      = ko_make_basic(MOD_MASK_CA, KC_M, KC_Q);
+const key_override_t ca_n_override      = ko_make_basic(MOD_MASK_CA, KC_N, KC_R);
+const key_override_t ca_o_override      = ko_make_basic(MOD_MASK_CA, KC_O, KC_S);
+const key_override_t ca_p_override      = ko_make_basic(MOD_MASK_CA, KC_P, KC_T);
+const key_override_t ca_q_override      = ko_make_basic(MOD_MASK_CA, KC_Q, KC_U);
+const key_override_t ca_r_override      = ko_make_basic(MOD_MASK_CA, KC_R, KC_V);
+const key_override_t ca_s_override      = ko_make_basic(MOD_MASK_CA, KC_S, KC_W);
+const key_override_t ca_t_override      = ko_make_basic(MOD_MASK_CA, KC_T, KC_X);
+const key_override_t ca_u_override      = ko_make_basic(MOD_MASK_CA, KC_U, KC_Y);
+const key_override_t ca_v_override      = ko_make_basic(MOD_MASK_CA, KC_V, KC_Z);
+const key_override_t ca_w_override      = ko_make_basic(MOD_MASK_CA, KC_W, KC_A);
+const key_override_t ca_x_override      = ko_make_basic(MOD_MASK_CA, KC_X, KC_B);
+const key_override_t ca_y_override      = ko_make_basic(MOD_MASK_CA, KC_Y, KC_C);
+const key_override_t ca_z_override      = ko_make_basic(MOD_MASK_CA, KC_Z, KC_D);
+const key_override_t s_1_override       = ko_make_basic(MOD_MASK_SHIFT, KC_1, KC_F1);
+const key_override_t s_2_override       = ko_make_basic(MOD_MASK_SHIFT, KC_2, KC_F2);
+const key_override_t s_3_override       = ko_make_basic(MOD_MASK_SHIFT, KC_3, KC_F3);
+const key_override_t s_4_override       = ko_make_basic(MOD_MASK_SHIFT, KC_4, KC_F4);
+const key_override_t s_5_override       = ko_make_basic(MOD_MASK_SHIFT, KC_5, KC_F5);
+const key_override_t s_6_override       = ko_make_basic(MOD_MASK_SHIFT, KC_6, KC_F6);
+const key_override_t s_7_override       = ko_make_basic(MOD_MASK_SHIFT, KC_7, KC_F7);
+const key_override_t s_8_override       = ko_make_basic(MOD_MASK_SHIFT, KC_8, KC_F8);
+const key_override_t s_9_override       = ko_make_basic(MOD_MASK_SHIFT, KC_9, KC_F9);
+const key_override_t s_0_override       = ko_make_basic(MOD_MASK_SHIFT, KC_0, KC_F10);
+const key_override_t cs_1_override      = ko_make_basic(MOD_MASK_CS, KC_1, KC_F11);
+const key_override_t cs_2_override      = ko_make_basic(MOD_MASK_CS, KC_2, KC_F12);
+const key_override_t cs_3_override      = ko_make_basic(MOD_MASK_CS, KC_3, KC_F13);
+const key_override_t cs_4_override      = ko_make_basic(MOD_MASK_CS, KC_4, KC_F14);
+const key_override_t cs_5_override      = ko_make_basic(MOD_MASK_CS, KC_5, KC_F15);
+const key_override_t cs_6_override      = ko_make_basic(MOD_MASK_CS, KC_6, KC_F16);
+const key_override_t cs_7_override      = ko_make_basic(MOD_MASK_CS, KC_7, KC_F17);
+const key_override_t cs_8_override      = ko_make_basic(MOD_MASK_CS, KC_8, KC_F18);
+const key_override_t cs_9_override      = ko_make_basic(MOD_MASK_CS, KC_9, KC_F19);
+const key_override_t cs_0_override      = ko_make_basic(MOD_MASK_CS, KC_0, KC_F20);
+const key_override_t s_comm_override    = ko_make_basic(MOD_MASK_SHIFT, KC_COMM, KC_QUES);
+const key_override_t s_dot_override     = ko_make_basic(MOD_MASK_SHIFT, KC_DOT, KC_EXLM);
+const key_override_t s_bspc_override    = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t c_bspc_override    = ko_make_basic(MOD_MASK_CTRL, KC_BSPC, KC_DEL);
+const key_override_t c_a_shadowed      = ko_make_basic(MOD_MASK_CTRL, KC_A, KC_Z);
+
+const key_override_t *key_overrides[] = {
+    &c_a_override, &c_b_override, &c_c_override, &c_d_override, &c_e_override, &c_f_override,
+    &c_g_override, &c_h_override, &c_i_override, &c_j_override, &c_k_override, &c_l_override,
+    &c_m_override, &c_n_override, &c_o_override, &c_p_override, &c_q_override, &c_r_override,
+    &c_s_override, &c_t_override, &c_u_override, &c_v_override, &c_w_override, &c_x_override,
+    &c_y_override, &c_z_override, &a_a_override, &a_b_override, &a_c_override, &a_d_override,
+    &a_e_override, &a_f_override, &a_g_override, &a_h_override, &a_i_override, &a_j_override,
+    &a_k_override, &a_l_override, &a_m_override, &a_n_override, &a_o_override, &a_p_override,
+    &a_q_override, &a_r_override, &a_s_override, &a_t_override, &a_u_override, &a_v_override,
+    &a_w_override, &a_x_override, &a_y_override, &a_z_override, &g_a_override, &g_b_override,
+    &g_c_override, &g_d_override, &g_e_override, &g_f_override, &g_g_override, &g_h_override,
+    &g_i_override, &g_j_override, &g_k_override, &g_l_override, &g_m_override, &g_n_override,
+    &g_o_override, &g_p_override, &g_q_override, &g_r_override, &g_s_override, &g_t_override,
+    &g_u_override, &g_v_override, &g_w_override, &g_x_override, &g_y_override, &g_z_override,
+    &ca_a_override, &ca_b_override, &ca_c_override, &ca_d_override, &ca_e_override, &ca_f_override,
+    &ca_g_override, &ca_h_override, &ca_i_override, &ca_j_override, &ca_k_override, &ca_l_override,
+    &ca_m_override, &ca_n_override, &ca_o_override, &ca_p_override, &ca_q_override, &ca_r_override,
+    &ca_s_override, &ca_t_override, &ca_u_override, &ca_v_override, &ca_w_override, &ca_x_override,
+    &ca_y_override, &ca_z_override, &s_1_override, &s_2_override, &s_3_override, &s_4_override,
+    &s_5_override, &s_6_override, &s_7_override, &s_8_override, &s_9_override, &s_0_override,
+    &cs_1_override, &cs_2_override, &cs_3_override, &cs_4_override, &cs_5_override, &cs_6_override,
+    &cs_7_override, &cs_8_override, &cs_9_override, &cs_0_override, &s_comm_override, &s_dot_override,
+    &s_bspc_override, &c_bspc_override,
+    &c_a_shadowed,
+};
+// clang-format on
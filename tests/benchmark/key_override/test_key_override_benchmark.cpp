@@ -0,0 +1,139 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_benchmark.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::AtLeast;
+
+static const std::string text = "the quick brown fox jumps over the lazy dog. pack my box with five dozen liquor jugs, "
+                                "sphinx of black quartz judge my vow\n";
+
+// Matrix positions of the modifiers in the keymap below.
+enum { MOD_ROW = 3, SHIFT_COL = 0, CTRL_COL = 1, ALT_COL = 2, GUI_COL = 3 };
+
+class KeyOverrideBenchmark : public BenchmarkFixture {
+   public:
+    void SetUp() override {
+        static const uint16_t rows[][MATRIX_COLS] = {
+            {KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y, KC_U, KC_I, KC_O, KC_P},
+            {KC_A, KC_S, KC_D, KC_F, KC_G, KC_H, KC_J, KC_K, KC_L, KC_SCLN},
+            {KC_Z, KC_X, KC_C, KC_V, KC_B, KC_N, KC_M, KC_COMM, KC_DOT, KC_SLSH},
+            {KC_LSFT, KC_LCTL, KC_LALT, KC_LGUI, KC_SPC, KC_ENT, KC_BSPC, KC_1, KC_2, KC_3},
+        };
+
+        for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+            for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+                add_key(KeymapKey(0, col, row, rows[row][col]));
+            }
+        }
+    }
+
+    // Types `text` while holding the modifier in column `mod_col`, so that
+    // every key press is checked against the overrides for that modifier.
+    std::vector<TraceEvent> shortcut_trace(uint8_t mod_col) {
+        std::vector<TraceEvent> trace = {{0, mod_col, MOD_ROW, true}};
+
+        for (auto& event : trace_from_text(text)) {
+            trace.push_back({event.time + 10, event.col, event.row, event.pressed});
+        }
+        trace.push_back({trace.back().time + 10, mod_col, MOD_ROW, false});
+        return trace;
+    }
+};
+
+TEST_F(KeyOverrideBenchmark, activates_override) {
+    TestDriver driver;
+    auto       ctrl = KeymapKey(0, CTRL_COL, MOD_ROW, KC_LCTL);
+    auto       a    = KeymapKey(0, 0, 1, KC_A);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_B)).Times(AtLeast(1));
+    EXPECT_REPORT(driver, (KC_Z)).Times(0);
+    tap_combo({ctrl, a});
+    VERIFY_AND_CLEAR(driver);
+}
+
+// key_override_reindex() is part of the API with or without the index
+TEST_F(KeyOverrideBenchmark, activates_override_after_reindex) {
+    TestDriver driver;
+    auto       ctrl = KeymapKey(0, CTRL_COL, MOD_ROW, KC_LCTL);
+    auto       a    = KeymapKey(0, 0, 1, KC_A);
+
+    key_override_reindex();
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_B)).Times(AtLeast(1));
+    EXPECT_REPORT(driver, (KC_Z)).Times(0);
+    tap_combo({ctrl, a});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideBenchmark, activates_override_on_modifier) {
+    TestDriver driver;
+    auto       shift = KeymapKey(0, SHIFT_COL, MOD_ROW, KC_LSFT);
+    auto       one   = KeymapKey(0, 7, MOD_ROW, KC_1);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_F1)).Times(AtLeast(1));
+    one.press();
+    run_one_scan_loop();
+    shift.press();
+    idle_for(1000);
+    shift.release();
+    run_one_scan_loop();
+    one.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Calls the key override handler directly, with a modifier held that the
+// pressed keys have no override for, so every event misses all overrides.
+TEST_F(KeyOverrideBenchmark, lookup) {
+    TestDriver  driver;
+    keyrecord_t record = {};
+    size_t      events = 0;
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    register_mods(MOD_BIT(KC_LALT));
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < 10000; ++round) {
+        for (uint16_t keycode = KC_1; keycode <= KC_0; ++keycode, events += 2) {
+            record.event.pressed = true;
+            process_key_override(keycode, &record);
+            record.event.pressed = false;
+            process_key_override(keycode, &record);
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "key override lookup: " << elapsed.count() / events << " ns/event" << std::endl;
+    unregister_mods(MOD_BIT(KC_LALT));
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideBenchmark, typing) {
+    TestDriver driver;
+
+    auto result = replay(driver, "128 key overrides, typing", trace_from_text(text), 20);
+
+    EXPECT_GT(result.events, 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrideBenchmark, shortcuts) {
+    TestDriver driver;
+
+    for (uint8_t mod_col : {CTRL_COL, ALT_COL, GUI_COL}) {
+        auto result = replay(driver, "128 key overrides, shortcuts", shortcut_trace(mod_col), 20);
+
+        EXPECT_GT(result.events, 0);
+    }
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,148 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+#include "qp_internal.h"
+void qp_internal_animation_tick(void);
+void advance_time(uint32_t ms);
+}
+
+#define SURFACE_WIDTH 16
+#define SURFACE_HEIGHT 16
+
+// A 3x3 white square on a black 16x16 mono2 background, moving diagonally, generated by `qmk painter-convert-graphics`.
+// Source positions/durations: (0,100ms) (1,100ms) (1,100ms) (4,60000ms) (4,60000ms) (5,100ms)
+//        Frame:    0|   1|   2|   3|   4
+// Duration(ms):  100| 200|60000|60000| 100
+//        Delta:    0|   1|   1|   1|   1
+// Frame   1: (  0,   0) - (  3,   3)
+// Frame   2: (  1,   1) - (  6,   6)
+// Frame   3: unchanged
+// Frame   4: (  4,   4) - (  7,   7)
+static const uint8_t moving_square[] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0xC5, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0xFF,
+    0xFF, 0x10, 0x00, 0x10, 0x00, 0x05, 0x00, 0x01, 0xFE, 0x14, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+    0x48, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x64, 0x00, 0x05, 0xFA, 0x08, 0x00, 0x00,
+    0x84, 0x07, 0x00, 0x07, 0x00, 0x07, 0x1B, 0x00, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0xFF, 0xC8, 0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00,
+    0x05, 0xFA, 0x02, 0x00, 0x00, 0xE0, 0xEE, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFF,
+    0x60, 0xEA, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x06, 0x00, 0x06, 0x00, 0x05,
+    0xFA, 0x05, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x0E, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0xFF, 0x60, 0xEA, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xFA, 0x00, 0x00, 0x00, 0x02, 0xFD, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFF, 0x64,
+    0x00, 0x04, 0xFB, 0x08, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x07, 0x00, 0x07, 0x00, 0x05, 0xFA,
+    0x02, 0x00, 0x00, 0xE0, 0xEE,
+};
+
+static uint8_t framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_WIDTH, SURFACE_HEIGHT, 16)];
+
+// The surface's pixdata and viewport calls are counted so the amount of data sent per frame can be checked
+static painter_driver_vtable_t      counting_vtable;
+static painter_driver_pixdata_func  surface_pixdata    = nullptr;
+static painter_driver_viewport_func surface_viewport   = nullptr;
+static uint32_t                     pixels_transferred = 0;
+static uint32_t                     viewports_set      = 0;
+
+static bool counting_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    pixels_transferred += native_pixel_count;
+    return surface_pixdata(device, pixel_data, native_pixel_count);
+}
+
+static bool counting_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    ++viewports_set;
+    return surface_viewport(device, left, top, right, bottom);
+}
+
+class PainterAnimationBenchmark : public ::testing::Test {
+   public:
+    static void SetUpTestSuite() {
+        surface = qp_make_rgb565_surface(SURFACE_WIDTH, SURFACE_HEIGHT, framebuffer);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+        painter_driver_t *driver = (painter_driver_t *)surface;
+        counting_vtable          = *driver->driver_vtable;
+        surface_pixdata          = counting_vtable.pixdata;
+        surface_viewport         = counting_vtable.viewport;
+        counting_vtable.pixdata  = counting_pixdata;
+        counting_vtable.viewport = counting_viewport;
+        driver->driver_vtable    = &counting_vtable;
+    }
+
+    void SetUp() override {
+        memset(framebuffer, 0, sizeof(framebuffer));
+        pixels_transferred = 0;
+        viewports_set      = 0;
+    }
+
+    // Runs the animation for the given amount of time, returning the number of pixels sent to the surface
+    uint32_t run_for(uint32_t ms) {
+        pixels_transferred = 0;
+        for (uint32_t i = 0; i < ms; ++i) {
+            advance_time(1);
+            qp_internal_animation_tick();
+        }
+        return pixels_transferred;
+    }
+
+    // Checks the surface only contains the square with its top left corner at the given position
+    bool square_at(uint16_t pos) {
+        const uint16_t *pixels = (const uint16_t *)framebuffer;
+        for (uint16_t y = 0; y < SURFACE_HEIGHT; ++y) {
+            for (uint16_t x = 0; x < SURFACE_WIDTH; ++x) {
+                bool inside = x >= pos && x <= pos + 2 && y >= pos && y <= pos + 2;
+                if (pixels[y * SURFACE_WIDTH + x] != (inside ? 0xFFFF : 0x0000)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    static painter_device_t surface;
+};
+
+painter_device_t PainterAnimationBenchmark::surface = nullptr;
+
+TEST_F(PainterAnimationBenchmark, only_changed_areas_are_drawn) {
+    painter_image_handle_t image = qp_load_image_mem(moving_square);
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->frame_count, 5);
+
+    // The first frame is drawn in full
+    deferred_token token = qp_animate(surface, 0, 0, image);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(pixels_transferred, SURFACE_WIDTH * SURFACE_HEIGHT);
+    EXPECT_TRUE(square_at(0));
+
+    // Each following frame only covers the area the square moved through
+    EXPECT_EQ(run_for(100), 4 * 4);
+    EXPECT_TRUE(square_at(1));
+
+    // The duplicate frame was folded into the previous frame's delay
+    EXPECT_EQ(run_for(199), 0);
+    EXPECT_EQ(run_for(1), 6 * 6);
+    EXPECT_TRUE(square_at(4));
+
+    // Delays too long to fold leave an empty frame behind, which never touches the display
+    viewports_set = 0;
+    EXPECT_EQ(run_for(60000), 0);
+    EXPECT_EQ(viewports_set, 0);
+    EXPECT_TRUE(square_at(4));
+
+    EXPECT_EQ(run_for(60000), 4 * 4);
+    EXPECT_TRUE(square_at(5));
+
+    // Looping back around redraws the first frame in full
+    EXPECT_EQ(run_for(100), SURFACE_WIDTH * SURFACE_HEIGHT);
+    EXPECT_TRUE(square_at(0));
+
+    qp_stop_animation(token);
+    EXPECT_TRUE(qp_close_image(image));
+}
@@ -0,0 +1,205 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+#include "qp_stream.h"
+#include "flash.h"
+}
+
+#define SURFACE_WIDTH 320
+#define SURFACE_HEIGHT 16
+#define GLYPH_SIZE 8
+#define GLYPH_COUNT 256
+#define FIRST_CODE_POINT 0x4E00
+
+// Emulated external flash, counting the number of read transactions issued
+static std::vector<uint8_t> flash_contents;
+static uint32_t             flash_transactions = 0;
+static uint32_t             flash_inits        = 0;
+
+extern "C" void flash_init(void) {
+    flash_inits++;
+}
+
+extern "C" flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len) {
+    flash_transactions++;
+    if (addr + len > flash_contents.size()) {
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+    memcpy(buf, &flash_contents[addr], len);
+    return FLASH_STATUS_SUCCESS;
+}
+
+static void put(std::vector<uint8_t> &data, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) {
+        data.push_back((value >> (8 * i)) & 0xFF);
+    }
+}
+
+// Builds a QFF font containing only a unicode glyph table of 8x8 1bpp glyphs, starting at FIRST_CODE_POINT.
+static std::vector<uint8_t> make_font(uint8_t seed) {
+    std::vector<uint8_t> font;
+    auto                 header = [&font](uint8_t type_id, uint32_t length) {
+        put(font, type_id, 1);
+        put(font, (uint8_t)~type_id, 1);
+        put(font, length, 3);
+    };
+
+    const uint32_t glyph_bytes = GLYPH_SIZE * GLYPH_SIZE / 8;
+    const uint32_t total_size  = 25 + (5 + GLYPH_COUNT * 6) + (5 + GLYPH_COUNT * glyph_bytes);
+
+    // Font descriptor
+    header(0x00, 20);
+    put(font, 0x464651, 3);    // magic
+    put(font, 0x01, 1);        // version
+    put(font, total_size, 4);  // total size
+    put(font, ~total_size, 4); // negated total size
+    put(font, GLYPH_SIZE, 1);  // line height
+    put(font, 0, 1);           // no ascii table
+    put(font, GLYPH_COUNT, 2); // unicode glyph count
+    put(font, 0x00, 1);        // GRAYSCALE_1BPP
+    put(font, 0, 1);           // flags
+    put(font, 0, 1);           // uncompressed
+    put(font, 0, 1);           // transparency index
+
+    // Unicode glyph table
+    header(0x02, GLYPH_COUNT * 6);
+    for (uint32_t i = 0; i < GLYPH_COUNT; ++i) {
+        put(font, FIRST_CODE_POINT + i, 3);
+        put(font, GLYPH_SIZE | ((i * glyph_bytes) << 6), 3);
+    }
+
+    // Glyph data, each glyph with a distinct pattern
+    header(0x04, GLYPH_COUNT * glyph_bytes);
+    for (uint32_t i = 0; i < GLYPH_COUNT; ++i) {
+        for (uint32_t b = 0; b < glyph_bytes; ++b) {
+            put(font, (uint8_t)(i * 37 + b * 11 + seed), 1);
+        }
+    }
+
+    return font;
+}
+
+// Packs the supplied assets behind an asset index, as written by `qmk painter-pack-assets`
+static std::vector<uint8_t> make_asset_index(const std::vector<std::vector<uint8_t>> &assets) {
+    std::vector<uint8_t> data;
+    put(data, QP_FLASH_ASSET_INDEX_MAGIC, 4);
+    put(data, assets.size(), 2);
+    put(data, 0, 2);
+    uint32_t offset = sizeof(qp_flash_asset_index_v1_t) + assets.size() * sizeof(qp_flash_asset_entry_v1_t);
+    for (auto &asset : assets) {
+        put(data, offset, 4);
+        put(data, asset.size(), 4);
+        offset += asset.size();
+    }
+    for (auto &asset : assets) {
+        data.insert(data.end(), asset.begin(), asset.end());
+    }
+    return data;
+}
+
+static std::string make_text(const std::vector<uint32_t> &code_points) {
+    std::string text;
+    for (auto cp : code_points) {
+        text.push_back((char)(0xE0 | (cp >> 12)));
+        text.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+        text.push_back((char)(0x80 | (cp & 0x3F)));
+    }
+    return text;
+}
+
+static uint8_t framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_WIDTH, SURFACE_HEIGHT, 16)];
+
+class PainterFlashBenchmark : public ::testing::Test {
+   public:
+    // Surfaces come from a fixed pool, so the one surface is shared across tests
+    static void SetUpTestSuite() {
+        surface = qp_make_rgb565_surface(SURFACE_WIDTH, SURFACE_HEIGHT, framebuffer);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    }
+
+    void SetUp() override {
+        fonts          = {make_font(1), make_font(7)};
+        flash_contents = make_asset_index(fonts);
+
+        std::vector<uint32_t> code_points;
+        for (uint32_t i = 0; i < SURFACE_WIDTH / GLYPH_SIZE; ++i) {
+            code_points.push_back(FIRST_CODE_POINT + (i * 151) % GLYPH_COUNT);
+        }
+        text = make_text(code_points);
+    }
+
+    std::vector<uint8_t> render(painter_font_handle_t font) {
+        EXPECT_NE(font, nullptr);
+        memset(framebuffer, 0, sizeof(framebuffer));
+        EXPECT_EQ(qp_drawtext(surface, 0, 0, font, text.c_str()), SURFACE_WIDTH);
+        qp_close_font(font);
+        return std::vector<uint8_t>(framebuffer, framebuffer + sizeof(framebuffer));
+    }
+
+    std::vector<std::vector<uint8_t>> fonts;
+    std::string                       text;
+
+    static painter_device_t surface;
+};
+
+painter_device_t PainterFlashBenchmark::surface = nullptr;
+
+TEST_F(PainterFlashBenchmark, assets_render_identically_to_memory) {
+    for (uint16_t id = 0; id < fonts.size(); ++id) {
+        auto from_flash  = render(qp_load_font_flash_asset(id));
+        auto from_memory = render(qp_load_font_mem(fonts[id].data()));
+        EXPECT_TRUE(std::any_of(from_memory.begin(), from_memory.end(), [](uint8_t b) { return b != 0; }));
+        EXPECT_EQ(from_flash, from_memory);
+    }
+
+    // Distinct assets really are distinct
+    EXPECT_NE(render(qp_load_font_flash_asset(0)), render(qp_load_font_flash_asset(1)));
+
+    // The flash driver was initialized on first use, and only then
+    EXPECT_EQ(flash_inits, 1);
+}
+
+TEST_F(PainterFlashBenchmark, missing_assets_fail) {
+    EXPECT_EQ(qp_load_font_flash_asset(fonts.size()), nullptr);
+
+    uint32_t address = 0, length = 0;
+    EXPECT_TRUE(qp_flash_asset_find(1, &address, &length));
+    EXPECT_EQ(address, sizeof(qp_flash_asset_index_v1_t) + 2 * sizeof(qp_flash_asset_entry_v1_t) + fonts[0].size());
+    EXPECT_EQ(length, fonts[1].size());
+
+    // Corrupt the index, which has already been read ahead
+    flash_contents[0] ^= 0xFF;
+    EXPECT_FALSE(qp_flash_asset_find(0, &address, &length));
+    EXPECT_EQ(qp_load_font_flash_asset(0), nullptr);
+}
+
+TEST_F(PainterFlashBenchmark, reads_are_batched) {
+    painter_font_handle_t font = qp_load_font_flash_asset(0);
+    ASSERT_NE(font, nullptr);
+
+    flash_transactions = 0;
+    const int rounds   = 100;
+    auto      start    = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        qp_drawtext(surface, 0, 0, font, text.c_str());
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    qp_close_font(font);
+
+    uint32_t glyphs = rounds * (SURFACE_WIDTH / GLYPH_SIZE);
+    std::cout << "drawtext from flash: " << elapsed.count() / glyphs << " ns/glyph, " << (double)flash_transactions / glyphs << " flash transactions/glyph" << std::endl;
+
+    // Each glyph needs a binary search of the glyph table and a read of its pixel data -- without read-ahead, each byte would be its own transaction
+    EXPECT_LT(flash_transactions, glyphs * 16);
+}
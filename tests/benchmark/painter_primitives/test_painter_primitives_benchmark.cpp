@@ -0,0 +1,233 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+}
+
+#define SURFACE_SIZE 128
+
+static uint8_t framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_SIZE, SURFACE_SIZE, 16)];
+
+// Per-pixel reference implementations of the primitives, as they were drawn before being grouped into spans.
+static void reference_line(painter_device_t device, int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    if (x0 == x1 || y0 == y1) {
+        qp_rect(device, x0, y0, x1, y1, 0, 0, 255, true);
+        return;
+    }
+    int16_t x = x0, y = y0;
+    int16_t slopex = x0 < x1 ? 1 : -1, slopey = y0 < y1 ? 1 : -1;
+    int16_t dx = abs(x1 - x0), dy = -abs(y1 - y0);
+    int16_t e = dx + dy;
+    while (x != x1 || y != y1) {
+        qp_setpixel(device, x, y, 0, 0, 255);
+        int16_t e2 = 2 * e;
+        if (e2 >= dy) {
+            e += dy;
+            x += slopex;
+        }
+        if (e2 <= dx) {
+            e += dx;
+            y += slopey;
+        }
+    }
+    qp_setpixel(device, x, y, 0, 0, 255);
+}
+
+static void reference_hline(painter_device_t device, int16_t l, int16_t r, int16_t y) {
+    qp_rect(device, std::min(l, r), y, std::max(l, r), y, 0, 0, 255, true);
+}
+
+static void reference_circle(painter_device_t device, int16_t cx, int16_t cy, int16_t radius, bool filled) {
+    auto plot = [&](int16_t ox, int16_t oy) {
+        if (filled) {
+            reference_hline(device, cx - ox, cx + ox, cy + oy);
+            reference_hline(device, cx - ox, cx + ox, cy - oy);
+            reference_hline(device, cx - oy, cx + oy, cy + ox);
+            reference_hline(device, cx - oy, cx + oy, cy - ox);
+        } else {
+            for (auto p : {std::make_pair(ox, oy), std::make_pair(oy, ox)}) {
+                qp_setpixel(device, cx + p.first, cy + p.second, 0, 0, 255);
+                qp_setpixel(device, cx - p.first, cy + p.second, 0, 0, 255);
+                qp_setpixel(device, cx + p.first, cy - p.second, 0, 0, 255);
+                qp_setpixel(device, cx - p.first, cy - p.second, 0, 0, 255);
+            }
+        }
+    };
+    int16_t xcalc = 0, ycalc = radius, err = ((5 - (radius >> 2)) >> 2);
+    plot(xcalc, ycalc);
+    while (xcalc < ycalc) {
+        xcalc++;
+        if (err < 0) {
+            err += (xcalc << 1) + 1;
+        } else {
+            ycalc--;
+            err += ((xcalc - ycalc) << 1) + 1;
+        }
+        plot(xcalc, ycalc);
+    }
+}
+
+static void reference_ellipse(painter_device_t device, int16_t cx, int16_t cy, int16_t sizex, int16_t sizey, bool filled) {
+    auto plot = [&](int16_t ox, int16_t oy) {
+        if (filled) {
+            reference_hline(device, cx - ox, cx + ox, cy + oy);
+            reference_hline(device, cx - ox, cx + ox, cy - oy);
+        } else {
+            qp_setpixel(device, cx + ox, cy + oy, 0, 0, 255);
+            qp_setpixel(device, cx - ox, cy + oy, 0, 0, 255);
+            qp_setpixel(device, cx + ox, cy - oy, 0, 0, 255);
+            qp_setpixel(device, cx - ox, cy - oy, 0, 0, 255);
+        }
+    };
+    int32_t aa = sizex * sizex, bb = sizey * sizey, fa = 4 * aa, fb = 4 * bb;
+    int16_t dx = 0, dy = sizey;
+    for (int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
+        plot(dx, dy);
+        if (delta >= 0) {
+            delta += fa * (1 - dy);
+            dy--;
+        }
+        delta += bb * (4 * dx + 6);
+    }
+    dx = sizex;
+    dy = 0;
+    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
+        plot(dx, dy);
+        if (delta >= 0) {
+            delta += fb * (1 - dx);
+            dx--;
+        }
+        delta += aa * (4 * dy + 6);
+    }
+}
+
+class PainterPrimitivesBenchmark : public ::testing::Test {
+   public:
+    // Surfaces come from a fixed pool, so the one surface is shared across tests
+    static void SetUpTestSuite() {
+        surface = qp_make_rgb565_surface(SURFACE_SIZE, SURFACE_SIZE, framebuffer);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    }
+
+    std::vector<uint8_t> render(std::function<void()> draw) {
+        memset(framebuffer, 0, sizeof(framebuffer));
+        draw();
+        return std::vector<uint8_t>(framebuffer, framebuffer + sizeof(framebuffer));
+    }
+
+    void expect_identical(std::function<void()> spans, std::function<void()> reference) {
+        auto actual   = render(spans);
+        auto expected = render(reference);
+        EXPECT_TRUE(std::any_of(expected.begin(), expected.end(), [](uint8_t b) { return b != 0; }));
+        EXPECT_EQ(actual, expected);
+    }
+
+    uint16_t pixel(uint16_t x, uint16_t y) {
+        return ((uint16_t)framebuffer[(y * SURFACE_SIZE + x) * 2] << 8) | framebuffer[(y * SURFACE_SIZE + x) * 2 + 1];
+    }
+
+    void benchmark(const char *name, std::function<void()> draw) {
+        const int rounds = 500;
+        auto      start  = std::chrono::steady_clock::now();
+        for (int round = 0; round < rounds; ++round) {
+            draw();
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << name << ": " << elapsed.count() / rounds << " ns/shape" << std::endl;
+    }
+
+    static painter_device_t surface;
+};
+
+painter_device_t PainterPrimitivesBenchmark::surface = nullptr;
+
+TEST_F(PainterPrimitivesBenchmark, lines_match_per_pixel_reference) {
+    const int16_t c = SURFACE_SIZE / 2;
+    for (int16_t i = 0; i < SURFACE_SIZE; i += 7) {
+        for (auto end : std::vector<std::pair<int16_t, int16_t>>{{i, 0}, {i, SURFACE_SIZE - 1}, {0, i}, {SURFACE_SIZE - 1, i}}) {
+            expect_identical([&] { qp_line(surface, c, c, end.first, end.second, 0, 0, 255); }, [&] { reference_line(surface, c, c, end.first, end.second); });
+            expect_identical([&] { qp_line(surface, end.first, end.second, c, c, 0, 0, 255); }, [&] { reference_line(surface, end.first, end.second, c, c); });
+        }
+    }
+}
+
+TEST_F(PainterPrimitivesBenchmark, circles_match_per_pixel_reference) {
+    const int16_t c = SURFACE_SIZE / 2;
+    for (int16_t radius = 0; radius < SURFACE_SIZE / 2; ++radius) {
+        for (bool filled : {false, true}) {
+            expect_identical([&] { qp_circle(surface, c, c, radius, 0, 0, 255, filled); }, [&] { reference_circle(surface, c, c, radius, filled); });
+        }
+    }
+}
+
+TEST_F(PainterPrimitivesBenchmark, ellipses_match_per_pixel_reference) {
+    const int16_t c = SURFACE_SIZE / 2;
+    for (int16_t sizex = 1; sizex < SURFACE_SIZE / 2; sizex += 3) {
+        for (int16_t sizey = 1; sizey < SURFACE_SIZE / 2; sizey += 5) {
+            for (bool filled : {false, true}) {
+                expect_identical([&] { qp_ellipse(surface, c, c, sizex, sizey, 0, 0, 255, filled); }, [&] { reference_ellipse(surface, c, c, sizex, sizey, filled); });
+            }
+        }
+    }
+}
+
+TEST_F(PainterPrimitivesBenchmark, antialiased_lines) {
+    // Diagonals and axis-aligned lines have full coverage, so match the aliased line
+    expect_identical([&] { qp_line_aa(surface, 10, 10, 100, 100, 0, 0, 255, 0, 0, 0); }, [&] { qp_line(surface, 10, 10, 100, 100, 0, 0, 255); });
+    expect_identical([&] { qp_line_aa(surface, 100, 20, 10, 20, 0, 0, 255, 0, 0, 0); }, [&] { qp_line(surface, 100, 20, 10, 20, 0, 0, 255); });
+
+    // Endpoints are fully covered, with intermediate columns blended across two rows
+    for (auto line : {std::vector<int16_t>{5, 10, 120, 50}, std::vector<int16_t>{120, 50, 5, 10}}) {
+        render([&] { qp_line_aa(surface, line[0], line[1], line[2], line[3], 0, 0, 255, 0, 0, 0); });
+        EXPECT_EQ(pixel(5, 10), 0xFFFF);
+        EXPECT_EQ(pixel(120, 50), 0xFFFF);
+        int blended_columns = 0;
+        for (uint16_t x = 5; x <= 120; ++x) {
+            int lit = 0, partial = 0;
+            for (uint16_t y = 0; y < SURFACE_SIZE; ++y) {
+                uint16_t p = pixel(x, y);
+                lit += p != 0 ? 1 : 0;
+                partial += (p != 0 && p != 0xFFFF) ? 1 : 0;
+            }
+            EXPECT_GE(lit, 1);
+            EXPECT_LE(lit, 2);
+            blended_columns += partial > 0 ? 1 : 0;
+        }
+        EXPECT_GT(blended_columns, 0);
+    }
+
+    // Steep lines are blended across two columns
+    render([&] { qp_line_aa(surface, 10, 5, 50, 120, 0, 0, 255, 0, 0, 0); });
+    for (uint16_t y = 5; y <= 120; ++y) {
+        int lit = 0;
+        for (uint16_t x = 0; x < SURFACE_SIZE; ++x) {
+            lit += pixel(x, y) != 0 ? 1 : 0;
+        }
+        EXPECT_GE(lit, 1);
+        EXPECT_LE(lit, 2);
+    }
+}
+
+TEST_F(PainterPrimitivesBenchmark, primitives) {
+    const int16_t c = SURFACE_SIZE / 2;
+    benchmark("line, spans", [&] { qp_line(surface, 0, 10, SURFACE_SIZE - 1, 30, 0, 0, 255); });
+    benchmark("line, per-pixel", [&] { reference_line(surface, 0, 10, SURFACE_SIZE - 1, 30); });
+    benchmark("line, anti-aliased", [&] { qp_line_aa(surface, 0, 10, SURFACE_SIZE - 1, 30, 0, 0, 255, 0, 0, 0); });
+    benchmark("circle, spans", [&] { qp_circle(surface, c, c, 60, 0, 0, 255, false); });
+    benchmark("circle, per-pixel", [&] { reference_circle(surface, c, c, 60, false); });
+    benchmark("filled circle, spans", [&] { qp_circle(surface, c, c, 60, 0, 0, 255, true); });
+    benchmark("filled circle, per-line", [&] { reference_circle(surface, c, c, 60, true); });
+    benchmark("ellipse, spans", [&] { qp_ellipse(surface, c, c, 60, 20, 0, 0, 255, false); });
+    benchmark("ellipse, per-pixel", [&] { reference_ellipse(surface, c, c, 60, 20, false); });
+}
@@ -0,0 +1,135 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+#include "qp_surface_internal.h"
+}
+
+#define SURFACE_WIDTH 240
+#define SURFACE_HEIGHT 120
+
+static uint8_t bottom_framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_WIDTH, SURFACE_HEIGHT, 16)];
+static uint8_t top_framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_WIDTH, SURFACE_HEIGHT, 16)];
+static uint8_t target_framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_WIDTH, SURFACE_HEIGHT, 16)];
+
+// The target is a surface, with its pixdata counted so the amount of data sent to it can be checked
+static painter_driver_vtable_t     counting_vtable;
+static painter_driver_pixdata_func surface_pixdata    = nullptr;
+static uint32_t                    pixels_transferred = 0;
+
+static bool counting_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    pixels_transferred += native_pixel_count;
+    return surface_pixdata(device, pixel_data, native_pixel_count);
+}
+
+class PainterSurfaceBenchmark : public ::testing::Test {
+   public:
+    // Surfaces come from a fixed pool, so they're shared across tests
+    static void SetUpTestSuite() {
+        bottom = qp_make_rgb565_surface(SURFACE_WIDTH, SURFACE_HEIGHT, bottom_framebuffer);
+        top    = qp_make_rgb565_surface(SURFACE_WIDTH, SURFACE_HEIGHT, top_framebuffer);
+        target = qp_make_rgb565_surface(SURFACE_WIDTH, SURFACE_HEIGHT, target_framebuffer);
+        ASSERT_TRUE(qp_init(bottom, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(top, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(target, QP_ROTATION_0));
+
+        painter_driver_t *target_driver = (painter_driver_t *)target;
+        counting_vtable                 = *target_driver->driver_vtable;
+        surface_pixdata                 = counting_vtable.pixdata;
+        counting_vtable.pixdata         = counting_pixdata;
+        target_driver->driver_vtable    = &counting_vtable;
+    }
+
+    void SetUp() override {
+        qp_init(bottom, QP_ROTATION_0);
+        qp_init(top, QP_ROTATION_0);
+        memset(target_framebuffer, 0, sizeof(target_framebuffer));
+        qp_flush(bottom);
+        qp_flush(top);
+        pixels_transferred = 0;
+    }
+
+    uint16_t pixel(const uint8_t *framebuffer, uint16_t x, uint16_t y) {
+        return ((const uint16_t *)framebuffer)[y * SURFACE_WIDTH + x];
+    }
+
+    static painter_device_t bottom;
+    static painter_device_t top;
+    static painter_device_t target;
+};
+
+painter_device_t PainterSurfaceBenchmark::bottom = nullptr;
+painter_device_t PainterSurfaceBenchmark::top    = nullptr;
+painter_device_t PainterSurfaceBenchmark::target = nullptr;
+
+TEST_F(PainterSurfaceBenchmark, opposite_corners_only_transfer_dirty_tiles) {
+    // A "clock" in the top left and a "WPM counter" in the bottom right
+    qp_rect(bottom, 2, 2, 21, 9, 0, 0, 255, true);
+    qp_rect(bottom, 220, 110, 237, 117, 85, 255, 255, true);
+    ASSERT_TRUE(qp_surface_draw(bottom, target, 0, 0, false));
+
+    std::cout << "opposite corners: " << pixels_transferred << " pixels transferred, bounding box would be " << (237 - 2 + 1) * (117 - 2 + 1) << std::endl;
+#if SURFACE_DIRTY_TILE_SIZE > 0
+    // Each update straddles at most 2x2 tiles
+    EXPECT_LE(pixels_transferred, 2 * 4 * SURFACE_DIRTY_TILE_SIZE * SURFACE_DIRTY_TILE_SIZE);
+#endif
+    EXPECT_EQ(memcmp(bottom_framebuffer, target_framebuffer, sizeof(target_framebuffer)), 0);
+
+    // Nothing left to draw
+    pixels_transferred = 0;
+    ASSERT_TRUE(qp_surface_draw(bottom, target, 0, 0, false));
+    EXPECT_EQ(pixels_transferred, 0);
+}
+
+TEST_F(PainterSurfaceBenchmark, scattered_updates_match_entire_surface) {
+    for (uint16_t i = 0; i < 40; ++i) {
+        uint16_t x = (i * 97) % SURFACE_WIDTH;
+        uint16_t y = (i * 53) % SURFACE_HEIGHT;
+        qp_line(bottom, x, y, (x + i * 7) % SURFACE_WIDTH, (y + i * 3) % SURFACE_HEIGHT, i * 5, 255, 255);
+    }
+    qp_circle(bottom, 120, 60, 50, 170, 255, 255, false);
+    ASSERT_TRUE(qp_surface_draw(bottom, target, 0, 0, false));
+    EXPECT_LT(pixels_transferred, SURFACE_WIDTH * SURFACE_HEIGHT);
+    EXPECT_EQ(memcmp(bottom_framebuffer, target_framebuffer, sizeof(target_framebuffer)), 0);
+
+    // Whole-surface draws still send everything
+    pixels_transferred = 0;
+    qp_setpixel(bottom, 0, 0, 0, 0, 255);
+    ASSERT_TRUE(qp_surface_draw(bottom, target, 0, 0, true));
+    EXPECT_EQ(pixels_transferred, SURFACE_WIDTH * SURFACE_HEIGHT);
+}
+
+TEST_F(PainterSurfaceBenchmark, layers_composite_over_transparent_pixels) {
+    // Bottom layer is a solid red background, top layer is transparent (black) apart from a white rectangle
+    qp_rect(bottom, 0, 0, SURFACE_WIDTH - 1, SURFACE_HEIGHT - 1, 0, 255, 255, true);
+    qp_rect(top, 100, 50, 139, 69, 0, 0, 255, true);
+    painter_device_t layers[] = {bottom, top};
+    ASSERT_TRUE(qp_surface_draw_layers(layers, 2, target, 0, 0, 0, 0, 0, false));
+
+    uint16_t red   = pixel(bottom_framebuffer, 0, 0);
+    uint16_t white = pixel(top_framebuffer, 100, 50);
+    EXPECT_NE(red, white);
+    EXPECT_EQ(pixel(target_framebuffer, 0, 0), red);
+    EXPECT_EQ(pixel(target_framebuffer, 99, 50), red);
+    EXPECT_EQ(pixel(target_framebuffer, 100, 50), white);
+    EXPECT_EQ(pixel(target_framebuffer, 139, 69), white);
+    EXPECT_EQ(pixel(target_framebuffer, 140, 69), red);
+
+    // Only the top layer changed, so only its dirty area is redrawn
+    pixels_transferred = 0;
+    qp_rect(top, 100, 50, 139, 69, 0, 0, 0, true);
+    ASSERT_TRUE(qp_surface_draw_layers(layers, 2, target, 0, 0, 0, 0, 0, false));
+    EXPECT_LE(pixels_transferred, 40 * 20);
+    EXPECT_EQ(pixel(target_framebuffer, 100, 50), red);
+    EXPECT_EQ(memcmp(bottom_framebuffer, target_framebuffer, sizeof(target_framebuffer)), 0);
+
+    // An empty stack of layers is rejected
+    EXPECT_FALSE(qp_surface_draw_layers(layers, 0, target, 0, 0, 0, 0, 0, false));
+}
@@ -0,0 +1,157 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+}
+
+#define SURFACE_WIDTH 320
+#define SURFACE_HEIGHT 16
+#define GLYPH_SIZE 8
+#define GLYPH_COUNT 2048
+#define FIRST_CODE_POINT 0x4E00
+
+// Builds a QFF font containing only a unicode glyph table of 8x8 1bpp glyphs, starting at FIRST_CODE_POINT.
+static std::vector<uint8_t> make_font(bool sorted) {
+    std::vector<uint8_t> font;
+    auto                 put = [&font](uint32_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            font.push_back((value >> (8 * i)) & 0xFF);
+        }
+    };
+    auto header = [&put](uint8_t type_id, uint32_t length) {
+        put(type_id, 1);
+        put((uint8_t)~type_id, 1);
+        put(length, 3);
+    };
+
+    const uint32_t glyph_bytes = GLYPH_SIZE * GLYPH_SIZE / 8;
+    const uint32_t total_size  = 25 + (5 + GLYPH_COUNT * 6) + (5 + GLYPH_COUNT * glyph_bytes);
+
+    // Font descriptor
+    header(0x00, 20);
+    put(0x464651, 3);     // magic
+    put(0x01, 1);         // version
+    put(total_size, 4);   // total size
+    put(~total_size, 4);  // negated total size
+    put(GLYPH_SIZE, 1);   // line height
+    put(0, 1);            // no ascii table
+    put(GLYPH_COUNT, 2);  // unicode glyph count
+    put(0x00, 1);         // GRAYSCALE_1BPP
+    put(0, 1);            // flags
+    put(0, 1);            // uncompressed
+    put(0, 1);            // transparency index
+
+    // Unicode glyph table
+    header(0x02, GLYPH_COUNT * 6);
+    for (uint32_t n = 0; n < GLYPH_COUNT; ++n) {
+        uint32_t i = sorted ? n : (GLYPH_COUNT - 1 - n);
+        put(FIRST_CODE_POINT + i, 3);
+        put(GLYPH_SIZE | ((i * glyph_bytes) << 6), 3);
+    }
+
+    // Glyph data, each glyph with a distinct pattern
+    header(0x04, GLYPH_COUNT * glyph_bytes);
+    for (uint32_t i = 0; i < GLYPH_COUNT; ++i) {
+        for (uint32_t b = 0; b < glyph_bytes; ++b) {
+            put((uint8_t)(i * 37 + b * 11 + 1), 1);
+        }
+    }
+
+    return font;
+}
+
+// Encodes a string of the supplied code points as UTF-8.
+static std::string make_text(const std::vector<uint32_t> &code_points) {
+    std::string text;
+    for (auto cp : code_points) {
+        text.push_back((char)(0xE0 | (cp >> 12)));
+        text.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+        text.push_back((char)(0x80 | (cp & 0x3F)));
+    }
+    return text;
+}
+
+static uint8_t framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_WIDTH, SURFACE_HEIGHT, 16)];
+
+class PainterTextBenchmark : public ::testing::Test {
+   public:
+    // Surfaces come from a fixed pool, so the one surface is shared across tests
+    static void SetUpTestSuite() {
+        surface = qp_make_rgb565_surface(SURFACE_WIDTH, SURFACE_HEIGHT, framebuffer);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    }
+
+    void SetUp() override {
+        sorted_font   = make_font(true);
+        unsorted_font = make_font(false);
+
+        // A line of glyphs scattered across the font, with some repetition as in real text
+        std::vector<uint32_t> code_points;
+        for (uint32_t i = 0; i < SURFACE_WIDTH / GLYPH_SIZE; ++i) {
+            code_points.push_back(FIRST_CODE_POINT + (i % 13) * 151 % GLYPH_COUNT);
+        }
+        text = make_text(code_points);
+    }
+
+    std::vector<uint8_t> render(const std::vector<uint8_t> &font_data) {
+        painter_font_handle_t font = qp_load_font_mem(font_data.data());
+        EXPECT_NE(font, nullptr);
+        memset(framebuffer, 0, sizeof(framebuffer));
+        EXPECT_EQ(qp_drawtext(surface, 0, 0, font, text.c_str()), SURFACE_WIDTH);
+        qp_close_font(font);
+        return std::vector<uint8_t>(framebuffer, framebuffer + sizeof(framebuffer));
+    }
+
+    void benchmark(const char *name, const std::vector<uint8_t> &font_data) {
+        painter_font_handle_t font   = qp_load_font_mem(font_data.data());
+        const int             rounds = 200;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < rounds; ++round) {
+            qp_drawtext(surface, 0, 0, font, text.c_str());
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << name << ": " << elapsed.count() / (rounds * (SURFACE_WIDTH / GLYPH_SIZE)) << " ns/glyph" << std::endl;
+        qp_close_font(font);
+    }
+
+    std::vector<uint8_t> sorted_font;
+    std::vector<uint8_t> unsorted_font;
+    std::string          text;
+
+    static painter_device_t surface;
+};
+
+painter_device_t PainterTextBenchmark::surface = nullptr;
+
+TEST_F(PainterTextBenchmark, sorted_and_unsorted_tables_render_identically) {
+    auto sorted   = render(sorted_font);
+    auto unsorted = render(unsorted_font);
+
+    EXPECT_TRUE(std::any_of(sorted.begin(), sorted.end(), [](uint8_t b) { return b != 0; }));
+    EXPECT_EQ(sorted, unsorted);
+}
+
+TEST_F(PainterTextBenchmark, missing_glyph_fails) {
+    painter_font_handle_t font = qp_load_font_mem(sorted_font.data());
+
+    EXPECT_EQ(qp_textwidth(font, make_text({FIRST_CODE_POINT + 3, FIRST_CODE_POINT + 7}).c_str()), 2 * GLYPH_SIZE);
+    EXPECT_EQ(qp_textwidth(font, make_text({FIRST_CODE_POINT - 1}).c_str()), 0);
+    EXPECT_EQ(qp_textwidth(font, make_text({FIRST_CODE_POINT + GLYPH_COUNT}).c_str()), 0);
+    qp_close_font(font);
+}
+
+TEST_F(PainterTextBenchmark, drawtext) {
+    benchmark("drawtext, sorted unicode table", sorted_font);
+    benchmark("drawtext, unsorted unicode table", unsorted_font);
+}
@@ -0,0 +1,89 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdlib>
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_benchmark.hpp"
+
+// Pangrams and common English, typed fast enough that keys overlap.
+static const std::string text = "the quick brown fox jumps over the lazy dog. pack my box with five dozen liquor jugs, "
+                                "sphinx of black quartz judge my vow. The five boxing wizards jump quickly\n";
+
+class Benchmark : public BenchmarkFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+    }
+
+    // A 40% layout on the 4x10 test matrix, with `home_row` replacing the
+    // default second row.
+    void set_qwerty_keymap(std::initializer_list<uint16_t> home_row) {
+        static const uint16_t rows[][MATRIX_COLS] = {
+            {KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y, KC_U, KC_I, KC_O, KC_P},
+            {KC_A, KC_S, KC_D, KC_F, KC_G, KC_H, KC_J, KC_K, KC_L, KC_SCLN},
+            {KC_Z, KC_X, KC_C, KC_V, KC_B, KC_N, KC_M, KC_COMM, KC_DOT, KC_SLSH},
+            {KC_LSFT, KC_LCTL, TD(0), KC_QUOT, KC_SPC, KC_ENT, KC_BSPC, KC_1, KC_2, KC_3},
+        };
+
+        keymap.clear();
+        for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+            for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+                uint16_t keycode = rows[row][col];
+                if (row == 1 && home_row.size() == MATRIX_COLS) {
+                    keycode = home_row.begin()[col];
+                }
+                add_key(KeymapKey(0, col, row, keycode));
+            }
+        }
+    }
+};
+
+TEST_F(Benchmark, typing_all_features) {
+    TestDriver driver;
+
+    set_qwerty_keymap({});
+    auto result = replay(driver, "all features, 80 wpm", trace_from_text(text, 80), 20);
+
+    EXPECT_GT(result.events, 0);
+    EXPECT_GT(result.keyboard_reports, 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Benchmark, typing_fast_rollover) {
+    TestDriver driver;
+
+    set_qwerty_keymap({});
+    auto result = replay(driver, "all features, 150 wpm rollover", trace_from_text(text, 150, 120), 20);
+
+    EXPECT_GT(result.events, 0);
+    EXPECT_GT(result.keyboard_reports, 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Benchmark, typing_home_row_mods) {
+    TestDriver driver;
+
+    set_qwerty_keymap({LGUI_T(KC_A), LALT_T(KC_S), LCTL_T(KC_D), LSFT_T(KC_F), KC_G, KC_H, RSFT_T(KC_J), RCTL_T(KC_K), RALT_T(KC_L), RGUI_T(KC_SCLN)});
+    auto result = replay(driver, "home row mods, 80 wpm", trace_from_text(text, 80), 20);
+
+    EXPECT_GT(result.events, 0);
+    EXPECT_GT(result.keyboard_reports, 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Replays a recorded trace, see load_trace() for the file format.
+TEST_F(Benchmark, recorded_trace) {
+    const char *path = std::getenv("QMK_BENCHMARK_TRACE");
+    if (!path) {
+        GTEST_SKIP() << "set QMK_BENCHMARK_TRACE to replay a recorded trace";
+    }
+
+    TestDriver driver;
+
+    set_qwerty_keymap({});
+    auto result = replay(driver, path, load_trace(path));
+
+    EXPECT_GT(result.events, 0);
+    VERIFY_AND_CLEAR(driver);
+}
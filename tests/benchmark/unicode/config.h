@@ -0,0 +1,9 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// A little time for the host to see each tap, as most real setups need
+#define TAP_CODE_DELAY 1
@@ -0,0 +1,106 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include "test_common.hpp"
+
+extern "C" {
+#include "utf8.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+
+// Sixteen characters from the Basic Multilingual Plane, which every input mode can type
+#define TEXT "ΨΩαβγδεζηθικλμνξ"
+#define TEXT_LENGTH 16
+
+struct unicode_run_t {
+    uint32_t ms;
+    uint32_t reports;
+    uint64_t cpu_ns;
+};
+
+class UnicodeBenchmark : public TestFixture {
+   public:
+    unicode_run_t run(uint8_t mode, bool batched, TestDriver &driver) {
+        set_unicode_input_mode(mode);
+
+        uint32_t reports = 0;
+        EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber()).WillRepeatedly([&reports](report_keyboard_t &) { reports++; });
+
+        uint32_t start_ms = timer_read32();
+        auto     start    = std::chrono::steady_clock::now();
+        if (batched) {
+            send_unicode_string(TEXT);
+        } else {
+            // Each character in its own input sequence, as it was before strings were grouped into sessions
+            const char *str = TEXT;
+            while (*str) {
+                int32_t code_point = 0;
+                str                = decode_utf8(str, &code_point);
+                register_unicode(code_point);
+            }
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+        testing::Mock::VerifyAndClearExpectations(&driver);
+        return {timer_read32() - start_ms, reports, (uint64_t)elapsed};
+    }
+
+    void compare(uint8_t mode, const char *name, bool caps_lock) {
+        TestDriver driver;
+        led_t      leds = {.caps_lock = caps_lock};
+        driver.set_leds(leds.raw);
+
+        unicode_run_t single  = run(mode, false, driver);
+        unicode_run_t batched = run(mode, true, driver);
+
+        std::cout << name << (caps_lock ? " (caps lock on)" : "") << ": " << TEXT_LENGTH * 1000.0 / single.ms << " -> " << TEXT_LENGTH * 1000.0 / batched.ms << " chars/s, " << (double)single.reports / TEXT_LENGTH << " -> " << (double)batched.reports / TEXT_LENGTH << " reports/char, " << batched.cpu_ns / TEXT_LENGTH << "ns CPU per char" << std::endl;
+
+        // Grouping into a session never costs anything over typing each character on its own
+        EXPECT_LE(batched.ms, single.ms) << name;
+        EXPECT_LE(batched.reports, single.reports) << name;
+        last_single  = single;
+        last_batched = batched;
+    }
+
+    unicode_run_t last_single;
+    unicode_run_t last_batched;
+};
+
+TEST_F(UnicodeBenchmark, macos) {
+    compare(UNICODE_MODE_MACOS, "macOS", false);
+
+    // Option is only pressed and released once, and only the first character waits for the input method
+    EXPECT_EQ(last_batched.reports, last_single.reports - 2 * (TEXT_LENGTH - 1));
+    EXPECT_LT(last_batched.ms * 2, last_single.ms);
+}
+
+TEST_F(UnicodeBenchmark, ibus) {
+    compare(UNICODE_MODE_LINUX, "Linux", false);
+}
+
+TEST_F(UnicodeBenchmark, ibus_caps_lock) {
+    compare(UNICODE_MODE_LINUX, "Linux", true);
+
+    // Caps Lock is only turned off and back on once
+    EXPECT_EQ(last_batched.reports, last_single.reports - 4 * (TEXT_LENGTH - 1));
+}
+
+TEST_F(UnicodeBenchmark, windows) {
+    compare(UNICODE_MODE_WINDOWS, "HexNumpad", false);
+
+    // Num Lock is only turned on and back off once
+    EXPECT_EQ(last_batched.reports, last_single.reports - 4 * (TEXT_LENGTH - 1));
+}
+
+TEST_F(UnicodeBenchmark, wincompose) {
+    compare(UNICODE_MODE_WINCOMPOSE, "WinCompose", false);
+}
+
+TEST_F(UnicodeBenchmark, emacs) {
+    compare(UNICODE_MODE_EMACS, "Emacs", false);
+}
@@ -0,0 +1,190 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdint>
+#include <vector>
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "raw_hid.h"
+}
+
+using testing::_;
+using testing::ElementsAre;
+using testing::InSequence;
+
+namespace {
+
+std::vector<std::vector<uint8_t>> received;
+bool                              send_ready;
+uint8_t                          *handled_data;
+uint8_t                           stream_remaining;
+
+std::vector<uint8_t> report(std::initializer_list<uint8_t> bytes) {
+    std::vector<uint8_t> data(bytes);
+    data.resize(32);
+    return data;
+}
+
+bool echo_incremented(uint8_t *data, uint8_t length) {
+    handled_data = data;
+    data[1]++;
+    return true;
+}
+
+bool ignore(uint8_t *data, uint8_t length) {
+    return false;
+}
+
+raw_hid_stream_state_t count_down(uint8_t *data, uint8_t length, void *context) {
+    data[0] = *(uint8_t *)context;
+    data[1] = --stream_remaining;
+    return stream_remaining ? RAW_HID_STREAM_SEND : RAW_HID_STREAM_END;
+}
+
+raw_hid_stream_state_t after_a_while(uint8_t *data, uint8_t length, void *context) {
+    if (timer_elapsed32(*(uint32_t *)context) < 50) {
+        return RAW_HID_STREAM_WAIT;
+    }
+    data[0] = 0x40;
+    return RAW_HID_STREAM_END;
+}
+
+bool stream_three(uint8_t *data, uint8_t length) {
+    static uint8_t command_id;
+    command_id       = data[0];
+    stream_remaining = 3;
+    EXPECT_TRUE(raw_hid_stream(count_down, &command_id));
+    return false;
+}
+
+} // namespace
+
+extern "C" {
+void raw_hid_receive(uint8_t *data, uint8_t length) {
+    received.push_back(std::vector<uint8_t>(data, data + length));
+}
+
+bool raw_hid_send_ready(void) {
+    return send_ready;
+}
+} // extern "C"
+
+class RawHid : public TestFixture {
+   public:
+    void SetUp() override {
+        received.clear();
+        send_ready   = true;
+        handled_data = nullptr;
+        for (uint8_t command_id : {0x10, 0x20, 0x30, 0x40, 0x50, 0x60}) {
+            raw_hid_register_handler(command_id, NULL);
+        }
+    }
+
+    void dispatch(std::vector<uint8_t> data) {
+        raw_hid_dispatch(data.data(), data.size());
+    }
+};
+
+TEST_F(RawHid, UnregisteredCommandsGoToRawHidReceive) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_raw_hid_mock(_)).Times(0);
+    dispatch(report({0x10, 0x01}));
+
+    EXPECT_THAT(received, ElementsAre(report({0x10, 0x01})));
+}
+
+TEST_F(RawHid, HandlerRepliesInPlace) {
+    TestDriver driver;
+    ASSERT_TRUE(raw_hid_register_handler(0x20, echo_incremented));
+
+    std::vector<uint8_t> data = report({0x20, 0x05});
+    EXPECT_CALL(driver, send_raw_hid_mock(report({0x20, 0x06})));
+    raw_hid_dispatch(data.data(), data.size());
+
+    EXPECT_EQ(handled_data, data.data());
+    EXPECT_TRUE(received.empty());
+}
+
+TEST_F(RawHid, HandlersCanBeReplacedAndRemoved) {
+    TestDriver driver;
+    ASSERT_TRUE(raw_hid_register_handler(0x20, echo_incremented));
+    ASSERT_TRUE(raw_hid_register_handler(0x20, ignore));
+
+    EXPECT_CALL(driver, send_raw_hid_mock(_)).Times(0);
+    dispatch(report({0x20}));
+    EXPECT_TRUE(received.empty());
+
+    ASSERT_TRUE(raw_hid_register_handler(0x20, NULL));
+    dispatch(report({0x20}));
+    EXPECT_THAT(received, ElementsAre(report({0x20})));
+}
+
+TEST_F(RawHid, HandlerTableIsBounded) {
+    for (uint8_t i = 0; i < RAW_HID_HANDLER_COUNT; i++) {
+        ASSERT_TRUE(raw_hid_register_handler(0x10 * (i + 1), ignore));
+    }
+    EXPECT_FALSE(raw_hid_register_handler(0x60, ignore));
+
+    // Replacing a registered handler still works, and removing one makes room
+    EXPECT_TRUE(raw_hid_register_handler(0x10, echo_incremented));
+    EXPECT_TRUE(raw_hid_register_handler(0x20, NULL));
+    EXPECT_TRUE(raw_hid_register_handler(0x60, ignore));
+}
+
+TEST_F(RawHid, StreamedReplySendsOneReportPerTask) {
+    TestDriver driver;
+    InSequence s;
+    ASSERT_TRUE(raw_hid_register_handler(0x30, stream_three));
+
+    EXPECT_CALL(driver, send_raw_hid_mock(_)).Times(0);
+    dispatch(report({0x30}));
+    EXPECT_FALSE(raw_hid_stream(count_down, NULL));
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_raw_hid_mock(report({0x30, 2})));
+    raw_hid_stream_task();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    // Nothing is sent while the host has not taken the previous report
+    send_ready = false;
+    EXPECT_CALL(driver, send_raw_hid_mock(_)).Times(0);
+    raw_hid_stream_task();
+    raw_hid_stream_task();
+
+    // Commands are still handled while a stream is in progress
+    dispatch(report({0x10}));
+    EXPECT_THAT(received, ElementsAre(report({0x10})));
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    send_ready = true;
+    EXPECT_CALL(driver, send_raw_hid_mock(report({0x30, 1})));
+    EXPECT_CALL(driver, send_raw_hid_mock(report({0x30, 0})));
+    raw_hid_stream_task();
+    raw_hid_stream_task();
+    raw_hid_stream_task();
+}
+
+TEST_F(RawHid, DeferredReply) {
+    TestDriver driver;
+    uint32_t   start = timer_read32();
+    ASSERT_TRUE(raw_hid_stream(after_a_while, &start));
+
+    EXPECT_CALL(driver, send_raw_hid_mock(_)).Times(0);
+    for (int i = 0; i < 50; i++) {
+        raw_hid_stream_task();
+        run_one_scan_loop();
+    }
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_raw_hid_mock(report({0x40})));
+    raw_hid_stream_task();
+    raw_hid_stream_task();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_TRUE(raw_hid_stream(after_a_while, &start));
+    EXPECT_CALL(driver, send_raw_hid_mock(report({0x40})));
+    raw_hid_stream_task();
+}
@@ -0,0 +1,6 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+STENO_ENABLE = yes
+STENO_PROTOCOL = all
+VIRTSER_ENABLE = yes
@@ -0,0 +1,135 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdint>
+#include <vector>
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::ElementsAre;
+using testing::InSequence;
+
+namespace {
+
+struct Stroke {
+    uint32_t             time;
+    std::vector<uint8_t> bytes;
+};
+
+std::vector<Stroke> strokes;
+
+} // namespace
+
+extern "C" {
+void virtser_init(void) {}
+
+void virtser_send_buffer(const uint8_t *data, uint8_t length) {
+    strokes.push_back({timer_read32(), std::vector<uint8_t>(data, data + length)});
+}
+} // extern "C"
+
+class Steno : public TestFixture {
+   public:
+    void SetUp() override {
+        strokes.clear();
+        steno_set_mode(STENO_MODE_GEMINI);
+    }
+};
+
+TEST_F(Steno, GeminiStrokeIsOnePacket) {
+    TestDriver driver;
+    KeymapKey  key_s(0, 0, 0, STN_S1);
+    KeymapKey  key_t(0, 1, 0, STN_TL);
+    KeymapKey  key_a(0, 2, 0, STN_A);
+    KeymapKey  key_z(0, 3, 0, STN_ZR);
+    set_keymap({key_s, key_t, key_a, key_z});
+
+    EXPECT_NO_REPORT(driver);
+    tap_combo({key_s, key_t, key_a, key_z});
+
+    ASSERT_EQ(strokes.size(), 1);
+    // Sent on the scan that released the last key, with the start of packet bit on the first byte only
+    EXPECT_EQ(strokes[0].time, timer_read32() - 1);
+    EXPECT_THAT(strokes[0].bytes, ElementsAre(0x80, 0x50, 0x20, 0x00, 0x00, 0x01));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Steno, GeminiRolledChordWaitsForLastRelease) {
+    TestDriver driver;
+    KeymapKey  key_s(0, 0, 0, STN_S1);
+    KeymapKey  key_t(0, 1, 0, STN_TL);
+    set_keymap({key_s, key_t});
+
+    EXPECT_NO_REPORT(driver);
+    key_s.press();
+    run_one_scan_loop();
+    key_t.press();
+    run_one_scan_loop();
+    key_s.release();
+    idle_for(10);
+    EXPECT_TRUE(strokes.empty());
+
+    key_t.release();
+    run_one_scan_loop();
+    ASSERT_EQ(strokes.size(), 1);
+    EXPECT_EQ(strokes[0].time, timer_read32() - 1);
+    EXPECT_THAT(strokes[0].bytes, ElementsAre(0x80, 0x50, 0x00, 0x00, 0x00, 0x00));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Steno, GeminiBurstOfChords) {
+    TestDriver driver;
+    KeymapKey  key_s(0, 0, 0, STN_S1);
+    KeymapKey  key_t(0, 1, 0, STN_TL);
+    KeymapKey  key_e(0, 2, 0, STN_E);
+    KeymapKey  key_d(0, 3, 0, STN_DR);
+    set_keymap({key_s, key_t, key_e, key_d});
+
+    EXPECT_NO_REPORT(driver);
+
+    // Back to back strokes with no idle time in between, as a fast writer would produce
+    const int             burst = 50;
+    std::vector<uint32_t> released;
+    for (int i = 0; i < burst; i++) {
+        if (i % 2) {
+            tap_combo({key_e, key_d});
+        } else {
+            tap_combo({key_s, key_t});
+        }
+        released.push_back(timer_read32() - 1);
+    }
+
+    ASSERT_EQ(strokes.size(), burst);
+    for (int i = 0; i < burst; i++) {
+        EXPECT_EQ(strokes[i].time, released[i]);
+        if (i % 2) {
+            EXPECT_THAT(strokes[i].bytes, ElementsAre(0x80, 0x00, 0x00, 0x08, 0x01, 0x00));
+        } else {
+            EXPECT_THAT(strokes[i].bytes, ElementsAre(0x80, 0x50, 0x00, 0x00, 0x00, 0x00));
+        }
+    }
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Steno, BoltStrokeSkipsEmptyGroups) {
+    TestDriver driver;
+    KeymapKey  key_s(0, 0, 0, STN_S1);
+    KeymapKey  key_t(0, 1, 0, STN_TL);
+    KeymapKey  key_z(0, 2, 0, STN_ZR);
+    set_keymap({key_s, key_t, key_z});
+    steno_set_mode(STENO_MODE_BOLT);
+
+    EXPECT_NO_REPORT(driver);
+    tap_combo({key_s, key_t, key_z});
+    tap_combo({key_z});
+
+    ASSERT_EQ(strokes.size(), 2);
+    // Only the groups with keys pressed are sent, and every stroke ends with a null byte
+    EXPECT_THAT(strokes[0].bytes, ElementsAre(0x03, 0xC8, 0x00));
+    EXPECT_THAT(strokes[1].bytes, ElementsAre(0xC8, 0x00));
+    EXPECT_EQ(strokes[1].time, timer_read32() - 1);
+    VERIFY_AND_CLEAR(driver);
+}
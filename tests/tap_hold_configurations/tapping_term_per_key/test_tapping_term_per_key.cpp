@@ -0,0 +1,72 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+static uint16_t tapping_term = TAPPING_TERM;
+
+uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+    return tapping_term;
+}
+
+class TappingTermPerKey : public TestFixture {
+   public:
+    void SetUp() override {
+        tapping_term = TAPPING_TERM;
+    }
+};
+
+// The term returned by get_tapping_term() can change while the key is held, without any other key event
+TEST_F(TappingTermPerKey, shortened_term_applies_to_held_key) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_hold_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_hold_key});
+
+    EXPECT_NO_REPORT(driver);
+    mod_tap_hold_key.press();
+    idle_for(TAPPING_TERM / 2);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The key is past the new term, so it is held on the next tick rather than at the original term. */
+    tapping_term = TAPPING_TERM / 4;
+    EXPECT_REPORT(driver, (KC_LSFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TappingTermPerKey, lengthened_term_applies_to_held_key) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_hold_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_hold_key});
+
+    EXPECT_NO_REPORT(driver);
+    mod_tap_hold_key.press();
+    idle_for(TAPPING_TERM / 2);
+    tapping_term = TAPPING_TERM * 2;
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Released within the new term, so still a tap. */
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
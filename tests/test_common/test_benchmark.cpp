@@ -0,0 +1,184 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_benchmark.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include "gmock/gmock.h"
+#include "test_matrix.h"
+
+extern "C" {
+#include "quantum.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+double BenchmarkResult::events_per_second() const {
+    return cpu_ns ? events * 1e9 / cpu_ns : 0;
+}
+
+double BenchmarkResult::ns_per_event() const {
+    return events ? (double)cpu_ns / events : 0;
+}
+
+double BenchmarkResult::ns_per_scan_loop() const {
+    return scan_loops ? (double)cpu_ns / scan_loops : 0;
+}
+
+std::ostream& operator<<(std::ostream& os, const BenchmarkResult& result) {
+    return os << "[ BENCH    ] " << result.name << ": " << result.events << " events, " << result.scan_loops << " scan loops, " << std::fixed << std::setprecision(0) << result.events_per_second() << " events/s, " << result.ns_per_event() << " ns/event, " << result.ns_per_scan_loop() << " ns/scan loop, reports: " << result.keyboard_reports << " keyboard, " << result.mouse_reports << " mouse, " << result.extra_reports << " extra" << std::defaultfloat;
+}
+
+std::vector<TraceEvent> load_trace(const std::string& path) {
+    std::vector<TraceEvent> trace;
+    std::ifstream           file(path);
+    std::string             line;
+
+    EXPECT_TRUE(file.is_open()) << "unable to open trace " << path;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        uint32_t           time;
+        unsigned           row, col;
+        char               direction;
+        if (!(fields >> time >> row >> col >> direction) || row >= MATRIX_ROWS || col >= MATRIX_COLS) {
+            ADD_FAILURE() << "invalid trace line: " << line;
+            continue;
+        }
+        trace.push_back({time, (uint8_t)col, (uint8_t)row, direction == 'd'});
+    }
+
+    std::stable_sort(trace.begin(), trace.end(), [](const TraceEvent& a, const TraceEvent& b) { return a.time < b.time; });
+    return trace;
+}
+
+std::vector<TraceEvent> BenchmarkFixture::trace_from_text(const std::string& text, unsigned wpm, unsigned hold_ms) {
+    std::vector<TraceEvent> trace;
+    const uint32_t          interval = 60000 / (wpm * 5);
+    uint32_t                time     = 0;
+
+    auto find_position = [&](uint16_t keycode) -> const KeymapKey* {
+        auto key = std::find_if(keymap.begin(), keymap.end(), [&](const KeymapKey& candidate) {
+            if (candidate.layer != 0) {
+                return false;
+            }
+            // Tap-hold keys type their tap keycode.
+            if (IS_QK_MOD_TAP(candidate.code)) {
+                return QK_MOD_TAP_GET_TAP_KEYCODE(candidate.code) == keycode;
+            }
+            if (IS_QK_LAYER_TAP(candidate.code)) {
+                return QK_LAYER_TAP_GET_TAP_KEYCODE(candidate.code) == keycode;
+            }
+            return candidate.code == keycode;
+        });
+        if (key == keymap.end()) {
+            ADD_FAILURE() << "no key for keycode " << keycode << " on layer 0";
+            return nullptr;
+        }
+        return &(*key);
+    };
+
+    for (char c : text) {
+        uint16_t keycode = KC_NO;
+        bool     shifted = false;
+        if (c >= 'a' && c <= 'z') {
+            keycode = KC_A + (c - 'a');
+        } else if (c >= 'A' && c <= 'Z') {
+            keycode = KC_A + (c - 'A');
+            shifted = true;
+        } else if (c >= '1' && c <= '9') {
+            keycode = KC_1 + (c - '1');
+        } else {
+            switch (c) {
+                case '0':
+                    keycode = KC_0;
+                    break;
+                case ' ':
+                    keycode = KC_SPACE;
+                    break;
+                case '\n':
+                    keycode = KC_ENTER;
+                    break;
+                case '.':
+                    keycode = KC_DOT;
+                    break;
+                case ',':
+                    keycode = KC_COMMA;
+                    break;
+                case '\'':
+                    keycode = KC_QUOTE;
+                    break;
+                default:
+                    ADD_FAILURE() << "unsupported character '" << c << "' in trace text";
+                    continue;
+            }
+        }
+
+        const KeymapKey* key   = find_position(keycode);
+        const KeymapKey* shift = shifted ? find_position(KC_LEFT_SHIFT) : nullptr;
+        if (!key || (shifted && !shift)) {
+            continue;
+        }
+
+        if (shift) {
+            trace.push_back({time, shift->position.col, shift->position.row, true});
+            time += interval / 4;
+        }
+        trace.push_back({time, key->position.col, key->position.row, true});
+        trace.push_back({time + hold_ms, key->position.col, key->position.row, false});
+        if (shift) {
+            trace.push_back({time + hold_ms + interval / 4, shift->position.col, shift->position.row, false});
+        }
+        time += interval;
+    }
+
+    std::stable_sort(trace.begin(), trace.end(), [](const TraceEvent& a, const TraceEvent& b) { return a.time < b.time; });
+    return trace;
+}
+
+BenchmarkResult BenchmarkFixture::replay(TestDriver& driver, const std::string& name, const std::vector<TraceEvent>& trace, unsigned repeat) {
+    BenchmarkResult result;
+    result.name = name;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly([&](report_keyboard_t&) { ++result.keyboard_reports; });
+    EXPECT_CALL(driver, send_nkro_mock(_)).WillRepeatedly([&](report_nkro_t&) { ++result.keyboard_reports; });
+    EXPECT_CALL(driver, send_mouse_mock(_)).WillRepeatedly([&](report_mouse_t&) { ++result.mouse_reports; });
+    EXPECT_CALL(driver, send_extra_mock(_)).WillRepeatedly([&](report_extra_t&) { ++result.extra_reports; });
+
+    // Leave time after the last event for pending tap-hold and combo decisions.
+    const uint32_t tail = TAPPING_TERM * 2;
+
+    for (unsigned round = 0; round < repeat; ++round) {
+        auto     event = trace.begin();
+        uint32_t end   = trace.empty() ? 0 : trace.back().time + tail;
+
+        for (uint32_t now = 0; now <= end; ++now) {
+            for (; event != trace.end() && event->time <= now; ++event, ++result.events) {
+                if (event->pressed) {
+                    press_key(event->col, event->row);
+                } else {
+                    release_key(event->col, event->row);
+                }
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            keyboard_task();
+            housekeeping_task();
+            result.cpu_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            ++result.scan_loops;
+            advance_time(1);
+        }
+    }
+
+    std::cout << result << std::endl;
+    return result;
+}
@@ -0,0 +1,67 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+
+/**
+ * @brief A single timestamped matrix transition of a typing trace.
+ */
+struct TraceEvent {
+    uint32_t time; // milliseconds since the start of the trace
+    uint8_t  col;
+    uint8_t  row;
+    bool     pressed;
+};
+
+/**
+ * @brief Counters collected while replaying a trace.
+ */
+struct BenchmarkResult {
+    std::string name;
+    uint64_t    events           = 0;
+    uint64_t    scan_loops       = 0;
+    uint64_t    cpu_ns           = 0;
+    uint64_t    keyboard_reports = 0;
+    uint64_t    mouse_reports    = 0;
+    uint64_t    extra_reports    = 0;
+
+    double events_per_second() const;
+    double ns_per_event() const;
+    double ns_per_scan_loop() const;
+};
+
+std::ostream& operator<<(std::ostream& os, const BenchmarkResult& result);
+
+/**
+ * @brief Loads a recorded trace, one event per line in the form
+ * `<time_ms> <row> <col> <d|u>`. Blank lines and lines starting with '#' are
+ * ignored.
+ */
+std::vector<TraceEvent> load_trace(const std::string& path);
+
+/**
+ * @brief Test fixture that replays typing traces through the full quantum
+ * stack and measures how long `keyboard_task()` spends processing them.
+ */
+class BenchmarkFixture : public TestFixture {
+   public:
+    /**
+     * @brief Synthesizes a trace that types `text` at `wpm` words per minute,
+     * holding each key for `hold_ms`. Characters are looked up in the layer 0
+     * keymap; `A`-`Z` are typed with the keymap's left shift key.
+     */
+    std::vector<TraceEvent> trace_from_text(const std::string& text, unsigned wpm = 80, unsigned hold_ms = 40);
+
+    /**
+     * @brief Replays `trace` `repeat` times, running one scan loop per
+     * millisecond of trace time, and returns the collected counters.
+     */
+    BenchmarkResult replay(TestDriver& driver, const std::string& name, const std::vector<TraceEvent>& trace, unsigned repeat = 1);
+};
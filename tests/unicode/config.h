@@ -6,3 +6,4 @@
 #include "test_common.h"
 
 #define UNICODE_SELECTED_MODES UNICODE_MODE_LINUX, UNICODE_MODE_MACOS
+#define UNICODE_QUEUE_SIZE 4
@@ -1,6 +1,8 @@
 // Copyright 2023 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string>
+
 #include "keyboard_report_util.hpp"
 #include "keycode.h"
 #include "test_common.hpp"
@@ -84,3 +86,103 @@ TEST_F(Unicode, sends_unicode_string) {
 
     VERIFY_AND_CLEAR(driver);
 }
+
+TEST_F(Unicode, holds_alt_for_whole_macos_string) {
+    TestDriver driver;
+
+    set_unicode_input_mode(UNICODE_MODE_MACOS);
+
+    {
+        testing::InSequence s;
+
+        // Alt+03A803A9 ΨΩ
+        EXPECT_REPORT(driver, (KC_LEFT_ALT));
+        for (uint16_t key : {KC_0, KC_3, KC_A, KC_8, KC_0, KC_3, KC_A, KC_9}) {
+            EXPECT_REPORT(driver, (key, KC_LEFT_ALT));
+            EXPECT_REPORT(driver, (KC_LEFT_ALT));
+        }
+        EXPECT_EMPTY_REPORT(driver);
+    }
+
+    send_unicode_string("ΨΩ");
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Unicode, toggles_caps_lock_once_for_linux_string) {
+    TestDriver driver;
+
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+    led_t caps_lock = {.caps_lock = true};
+    driver.set_leds(caps_lock.raw);
+
+    {
+        testing::InSequence s;
+
+        EXPECT_REPORT(driver, (KC_CAPS_LOCK));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_UNICODE(driver, 0x03A8);
+        EXPECT_UNICODE(driver, 0x03A9);
+        EXPECT_REPORT(driver, (KC_CAPS_LOCK));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+
+    send_unicode_string("ΨΩ");
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Unicode, restores_mods_after_string) {
+    TestDriver driver;
+    KeymapKey  key_shift(0, 0, 0, KC_LEFT_SHIFT);
+    set_keymap({key_shift});
+
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    key_shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        testing::InSequence s;
+
+        EXPECT_UNICODE(driver, 0x03A8);
+        EXPECT_UNICODE(driver, 0x03A9);
+    }
+
+    send_unicode_string("ΨΩ");
+    EXPECT_EQ(get_mods(), MOD_BIT(KC_LEFT_SHIFT));
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Unicode, sends_queued_string_one_character_per_task) {
+    TestDriver driver;
+
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+
+    EXPECT_NO_REPORT(driver);
+    // Long enough that a byte-wide count would wrap around to fit
+    EXPECT_FALSE(send_unicode_string_async(std::string(257, 'x').c_str()));
+    EXPECT_TRUE(send_unicode_string_async("ΨΩ"));
+    // Only two of the four slots are left
+    EXPECT_FALSE(send_unicode_string_async("ＱＭＫ"));
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_UNICODE(driver, 0x03A8);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_UNICODE(driver, 0x03A9);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
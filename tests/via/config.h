@@ -0,0 +1,9 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// The test harness' default EEPROM is too small for dynamic keymaps
+#define TRANSIENT_EEPROM_SIZE 1024
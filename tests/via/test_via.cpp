@@ -0,0 +1,103 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdint>
+#include <vector>
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "via.h"
+#include "raw_hid.h"
+#include "dynamic_keymap.h"
+}
+
+using testing::_;
+
+namespace {
+
+bool send_ready;
+
+std::vector<uint8_t> report(std::initializer_list<uint8_t> bytes) {
+    std::vector<uint8_t> data(bytes);
+    data.resize(32);
+    return data;
+}
+
+// The reply to a get_buffer command, read directly from the dynamic keymap
+std::vector<uint8_t> keymap_buffer_reply(uint16_t offset, uint8_t size) {
+    std::vector<uint8_t> data = report({id_dynamic_keymap_get_buffer, (uint8_t)(offset >> 8), (uint8_t)(offset & 0xFF), size});
+    dynamic_keymap_get_buffer(offset, size, &data[4]);
+    return data;
+}
+
+} // namespace
+
+extern "C" {
+bool raw_hid_send_ready(void) {
+    return send_ready;
+}
+} // extern "C"
+
+class Via : public TestFixture {
+   public:
+    void SetUp() override {
+        send_ready = true;
+    }
+
+    void dispatch(std::vector<uint8_t> data) {
+        raw_hid_dispatch(data.data(), data.size());
+    }
+};
+
+TEST_F(Via, GetBufferIsAnsweredOnceTheHostCanTakeIt) {
+    TestDriver driver;
+
+    // Neither the NVM read nor the reply happen from within the receive
+    send_ready = false;
+    EXPECT_CALL(driver, send_raw_hid_mock(_)).Times(0);
+    dispatch(report({id_dynamic_keymap_get_buffer, 0x00, 0x04, 28}));
+    raw_hid_stream_task();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    send_ready = true;
+    EXPECT_CALL(driver, send_raw_hid_mock(keymap_buffer_reply(4, 28)));
+    raw_hid_stream_task();
+    raw_hid_stream_task();
+}
+
+TEST_F(Via, GetBufferIsAnsweredDirectlyWhileAnotherIsPending) {
+    TestDriver driver;
+    testing::InSequence s;
+
+    send_ready = false;
+    EXPECT_CALL(driver, send_raw_hid_mock(keymap_buffer_reply(32, 16)));
+    dispatch(report({id_dynamic_keymap_get_buffer, 0x00, 0x00, 28}));
+    dispatch(report({id_dynamic_keymap_get_buffer, 0x00, 0x20, 16}));
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    send_ready = true;
+    EXPECT_CALL(driver, send_raw_hid_mock(keymap_buffer_reply(0, 28)));
+    raw_hid_stream_task();
+}
+
+TEST_F(Via, OtherCommandsAreStillAnsweredDirectly) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_raw_hid_mock(report({id_get_protocol_version, VIA_PROTOCOL_VERSION >> 8, VIA_PROTOCOL_VERSION & 0xFF})));
+    dispatch(report({id_get_protocol_version}));
+}
+
+TEST_F(Via, MacroGetBufferIsDeferredToo) {
+    TestDriver driver;
+
+    std::vector<uint8_t> reply = report({id_dynamic_keymap_macro_get_buffer, 0x00, 0x00, 28});
+    dynamic_keymap_macro_get_buffer(0, 28, &reply[4]);
+
+    EXPECT_CALL(driver, send_raw_hid_mock(_)).Times(0);
+    dispatch(report({id_dynamic_keymap_macro_get_buffer, 0x00, 0x00, 28}));
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_CALL(driver, send_raw_hid_mock(reply));
+    raw_hid_stream_task();
+}
@@ -0,0 +1,7 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Stands in for the version.h generated for keyboard builds
+#define QMK_BUILDDATE "2025-01-01-00:00:00"
@@ -5,6 +5,7 @@ CHIBIOS_DIR = $(PROTOCOL_DIR)/chibios
 SRC += $(CHIBIOS_DIR)/usb_main.c
 SRC += $(CHIBIOS_DIR)/chibios.c
 SRC += usb_descriptor.c
+SRC += usb_high_speed.c
 SRC += $(CHIBIOS_DIR)/usb_driver.c
 SRC += $(CHIBIOS_DIR)/usb_endpoints.c
 SRC += $(CHIBIOS_DIR)/usb_report_handling.c
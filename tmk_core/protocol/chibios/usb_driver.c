@@ -339,3 +339,46 @@ bool usb_endpoint_out_receive(usb_endpoint_out_t *endpoint, uint8_t *data, size_
 
     return received == size;
 }
+
+/**
+ * @brief Gives access to the oldest received packet without copying it out of
+ * the endpoint's buffers. Must be followed by `usb_endpoint_out_release` once
+ * the packet has been processed, and not mixed with partial reads from
+ * `usb_endpoint_out_receive`.
+ *
+ * @param endpoint USB OUT endpoint to receive the packet from
+ * @param size receives the size of the packet
+ * @return pointer to the packet, which may be modified in place, or NULL if
+ * none has been received
+ */
+uint8_t *usb_endpoint_out_acquire(usb_endpoint_out_t *endpoint, size_t *size) {
+    osalDbgCheck((endpoint != NULL) && (size != NULL));
+
+    osalSysLock();
+    if (usbGetDriverStateI(endpoint->config.usbp) != USB_ACTIVE || bqIsSuspendedX(&endpoint->ibqueue) || ibqGetFullBufferTimeoutS(&endpoint->ibqueue, TIME_IMMEDIATE) != MSG_OK) {
+        osalSysUnlock();
+        return NULL;
+    }
+    osalSysUnlock();
+
+    *size = endpoint->ibqueue.top - endpoint->ibqueue.ptr;
+    return endpoint->ibqueue.ptr;
+}
+
+/**
+ * @brief Hands the packet returned by `usb_endpoint_out_acquire` back to the
+ * endpoint, so that it can be used to receive another one. Does nothing if the
+ * endpoint was suspended or reset in the meantime.
+ *
+ * @param endpoint USB OUT endpoint the packet was received from
+ */
+void usb_endpoint_out_release(usb_endpoint_out_t *endpoint) {
+    osalDbgCheck(endpoint != NULL);
+
+    osalSysLock();
+    // A suspend or reset while the packet was out has already emptied the queue
+    if (endpoint->ibqueue.ptr != NULL && !bqIsSuspendedX(&endpoint->ibqueue)) {
+        ibqReleaseEmptyBufferS(&endpoint->ibqueue);
+    }
+    osalSysUnlock();
+}
@@ -198,6 +198,8 @@ void usb_endpoint_out_start(usb_endpoint_out_t *endpoint);
 void usb_endpoint_out_stop(usb_endpoint_out_t *endpoint);
 
 bool usb_endpoint_out_receive(usb_endpoint_out_t *endpoint, uint8_t *data, size_t size, sysinterval_t timeout);
+uint8_t *usb_endpoint_out_acquire(usb_endpoint_out_t *endpoint, size_t *size);
+void     usb_endpoint_out_release(usb_endpoint_out_t *endpoint);
 
 void usb_endpoint_out_suspend_cb(usb_endpoint_out_t *endpoint);
 void usb_endpoint_out_wakeup_cb(usb_endpoint_out_t *endpoint);
@@ -526,10 +526,21 @@ void send_raw_hid(uint8_t *data, uint8_t length) {
     send_report(USB_ENDPOINT_IN_RAW, data, length);
 }
 
+bool raw_hid_send_ready(void) {
+    return usb_endpoint_in_is_inactive(&usb_endpoints_in[USB_ENDPOINT_IN_RAW]);
+}
+
 void raw_hid_task(void) {
-    uint8_t buffer[RAW_EPSIZE];
-    while (receive_report(USB_ENDPOINT_OUT_RAW, buffer, sizeof(buffer))) {
-        raw_hid_receive(buffer, sizeof(buffer));
+    usb_endpoint_out_t *endpoint = &usb_endpoints_out[USB_ENDPOINT_OUT_RAW];
+    uint8_t            *buffer;
+    size_t              size;
+
+    // Reports are processed in place, in the buffers they were received into
+    while ((buffer = usb_endpoint_out_acquire(endpoint, &size)) != NULL) {
+        if (size == RAW_EPSIZE) {
+            raw_hid_dispatch(buffer, RAW_EPSIZE);
+        }
+        usb_endpoint_out_release(endpoint);
     }
 }
 
@@ -537,8 +548,8 @@ void raw_hid_task(void) {
 
 #ifdef MIDI_ENABLE
 
-void send_midi_packet(MIDI_EventPacket_t *event) {
-    send_report(USB_ENDPOINT_IN_MIDI, (uint8_t *)event, sizeof(MIDI_EventPacket_t));
+void send_midi_packets(MIDI_EventPacket_t *events, uint8_t count) {
+    send_report(USB_ENDPOINT_IN_MIDI, (uint8_t *)events, count * sizeof(MIDI_EventPacket_t));
 }
 
 bool recv_midi_packet(MIDI_EventPacket_t *const event) {
@@ -584,6 +595,21 @@ void virtser_send(const uint8_t byte) {
     send_report_buffered(USB_ENDPOINT_IN_CDC_DATA, (void *)&byte, sizeof(byte));
 }
 
+void virtser_send_buffer(const uint8_t *data, uint8_t length) {
+    // Each write may be at most one endpoint buffer, which a whole stroke normally fits into
+    while (length > 0) {
+        uint8_t chunk = length < CDC_EPSIZE ? length : CDC_EPSIZE;
+        if (!send_report_buffered(USB_ENDPOINT_IN_CDC_DATA, (void *)data, chunk)) {
+            break;
+        }
+        data += chunk;
+        length -= chunk;
+    }
+
+    // Flush even if a write failed, so that the chunks already queued aren't left to go out in front of the next buffer
+    flush_report_buffered(USB_ENDPOINT_IN_CDC_DATA, false);
+}
+
 __attribute__((weak)) void virtser_recv(uint8_t c) {
     // Ignore by default
 }
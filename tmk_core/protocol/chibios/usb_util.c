@@ -25,3 +25,14 @@ void usb_disconnect(void) {
 bool usb_connected_state(void) {
     return usbGetDriverStateI(&USB_DRIVER) == USB_ACTIVE;
 }
+
+#ifdef USB_HIGH_SPEED_ENABLE
+bool usb_is_high_speed(void) {
+#    if defined(DSTS_ENUMSPD_MASK)
+    // Only the OTG peripherals can run at high-speed, and they report the speed the host enumerated them at
+    return (USB_DRIVER.otg->DSTS & DSTS_ENUMSPD_MASK) == DSTS_ENUMSPD_HS_480;
+#    else
+    return false;
+#    endif
+}
+#endif
@@ -176,10 +176,21 @@ void raw_hid_task(void) {
         Endpoint_ClearOUT();
 
         if (data_read) {
-            raw_hid_receive(data, sizeof(data));
+            raw_hid_dispatch(data, sizeof(data));
         }
     }
 }
+
+bool raw_hid_send_ready(void) {
+    if (USB_DeviceState != DEVICE_STATE_Configured) return false;
+
+    uint8_t ep = Endpoint_GetCurrentEndpoint();
+    Endpoint_SelectEndpoint(RAW_IN_EPNUM);
+    bool ready = Endpoint_IsReadWriteAllowed();
+    Endpoint_SelectEndpoint(ep);
+
+    return ready;
+}
 #endif
 
 /*******************************************************************************
@@ -676,8 +687,19 @@ USB_ClassInfo_MIDI_Device_t USB_MIDI_Interface = {
 
 // clang-format on
 
-void send_midi_packet(MIDI_EventPacket_t *event) {
-    MIDI_Device_SendEventPacket(&USB_MIDI_Interface, event);
+void send_midi_packets(MIDI_EventPacket_t *events, uint8_t count) {
+    if (USB_DeviceState != DEVICE_STATE_Configured) {
+        return;
+    }
+
+    uint8_t ep = Endpoint_GetCurrentEndpoint();
+    Endpoint_SelectEndpoint(USB_MIDI_Interface.Config.DataINEndpoint.Address);
+
+    if (Endpoint_Write_Stream_LE(events, count * sizeof(MIDI_EventPacket_t), NULL) == ENDPOINT_RWSTREAM_NoError) {
+        MIDI_Device_Flush(&USB_MIDI_Interface);
+    }
+
+    Endpoint_SelectEndpoint(ep);
 }
 
 bool recv_midi_packet(MIDI_EventPacket_t *const event) {
@@ -751,6 +773,37 @@ void virtser_send(const uint8_t byte) {
         Endpoint_SelectEndpoint(ep);
     }
 }
+
+/** \brief Virtual Serial Send Buffer
+ *
+ * Writes all of the bytes into the endpoint before flushing, so that they reach the host together
+ */
+void virtser_send_buffer(const uint8_t *data, uint8_t length) {
+    uint8_t timeout = 255;
+    uint8_t ep      = Endpoint_GetCurrentEndpoint();
+
+    if (cdc_device.State.ControlLineStates.HostToDevice & CDC_CONTROL_LINE_OUT_DTR) {
+        /* IN packet */
+        Endpoint_SelectEndpoint(cdc_device.Config.DataINEndpoint.Address);
+
+        if (!Endpoint_IsEnabled() || !Endpoint_IsConfigured()) {
+            Endpoint_SelectEndpoint(ep);
+            return;
+        }
+
+        while (timeout-- && !Endpoint_IsReadWriteAllowed())
+            _delay_us(40);
+
+        Endpoint_Write_Stream_LE(data, length, NULL);
+        CDC_Device_Flush(&cdc_device);
+
+        if (Endpoint_IsINReady()) {
+            Endpoint_ClearIN();
+        }
+
+        Endpoint_SelectEndpoint(ep);
+    }
+}
 #endif
 
 /*******************************************************************************
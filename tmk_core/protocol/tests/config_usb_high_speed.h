@@ -0,0 +1,19 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define VENDOR_ID 0xFEED
+#define PRODUCT_ID 0x0000
+#define DEVICE_VER 0x0001
+#define MANUFACTURER "QMK"
+#define PRODUCT "High-speed test"
+
+#define MATRIX_ROWS 1
+#define MATRIX_COLS 1
+
+// Normally provided by the ChibiOS USB driver
+#define USB_MAX_ENDPOINTS 8
+
+// Slower than default at full-speed, to tell it apart from the endpoints with a fixed polling rate
+#define USB_POLLING_INTERVAL_MS 2
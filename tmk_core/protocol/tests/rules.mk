@@ -0,0 +1,10 @@
+# The real descriptors, built as for ChibiOS where string descriptors are UTF-16
+usb_high_speed_DEFS := -fshort-wchar -DPROTOCOL_CHIBIOS -DUSB_HIGH_SPEED_ENABLE -DFIXED_CONTROL_ENDPOINT_SIZE=64 -DFIXED_NUM_CONFIGURATIONS=1 \
+	-DMOUSE_ENABLE -DEXTRAKEY_ENABLE -DSHARED_EP_ENABLE -DRAW_ENABLE -DCONSOLE_ENABLE
+usb_high_speed_INC := $(TMK_PATH)/protocol/chibios/lufa_utils
+usb_high_speed_CONFIG := $(TMK_PATH)/protocol/tests/config_usb_high_speed.h
+
+usb_high_speed_SRC := \
+    $(TMK_PATH)/protocol/tests/usb_high_speed_tests.cpp \
+    $(TMK_PATH)/protocol/usb_descriptor.c \
+    $(TMK_PATH)/protocol/usb_high_speed.c
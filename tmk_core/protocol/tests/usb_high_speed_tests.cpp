@@ -0,0 +1,290 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "usb_descriptor.h"
+#include "usb_high_speed.h"
+
+static bool high_speed;
+
+bool usb_is_high_speed(void) {
+    return high_speed;
+}
+}
+
+using testing::ElementsAre;
+using testing::HasSubstr;
+using testing::IsEmpty;
+
+#define DTYPE_CONFIGURATION 0x02
+#define DTYPE_INTERFACE 0x04
+#define DTYPE_ENDPOINT 0x05
+#define DTYPE_HID 0x21
+
+#define EP_INTERRUPT 0x03
+#define EP_BULK 0x02
+#define EP_ISOCHRONOUS 0x01
+
+// Endpoint numbers for the hand-built descriptors, which exercise what the keyboard's own descriptor can't
+#define KEYBOARD_EP 1
+#define CONSOLE_EP 4
+#define AUDIO_EP 5
+#define BULK_EP 6
+
+class Descriptor {
+   public:
+    Descriptor() {
+        bytes = {9, DTYPE_CONFIGURATION, 0, 0, 0, 1, 0, 0xA0, 250};
+    }
+
+    Descriptor &interface(uint8_t endpoints) {
+        bytes.insert(bytes.end(), {9, DTYPE_INTERFACE, interfaces++, 0, endpoints, 0x03, 0, 0, 0});
+        bytes.insert(bytes.end(), {9, DTYPE_HID, 0x11, 0x01, 0, 1, 0x22, 0x3F, 0});
+        return *this;
+    }
+
+    Descriptor &endpoint(uint8_t address, uint8_t type, uint16_t size, uint8_t interval) {
+        bytes.insert(bytes.end(), {7, DTYPE_ENDPOINT, address, type, (uint8_t)(size & 0xFF), (uint8_t)(size >> 8), interval});
+        return *this;
+    }
+
+    std::vector<uint8_t> build() {
+        std::vector<uint8_t> result = bytes;
+        result[2]                   = result.size() & 0xFF;
+        result[3]                   = result.size() >> 8;
+        result[4]                   = interfaces;
+        return result;
+    }
+
+    // Returns the bInterval of the given endpoint address
+    static uint8_t interval(const std::vector<uint8_t> &descriptor, uint8_t address) {
+        for (size_t i = 0; i < descriptor.size(); i += descriptor[i]) {
+            if (descriptor[i + 1] == DTYPE_ENDPOINT && descriptor[i + 2] == address) {
+                return descriptor[i + 6];
+            }
+        }
+        ADD_FAILURE() << "no endpoint " << +address;
+        return 0;
+    }
+
+    // Checks a configuration descriptor against the rules of USB 2.0 chapter 9 for the given speed, returning what is wrong with it
+    static std::vector<std::string> problems(const std::vector<uint8_t> &descriptor, bool high_speed) {
+        std::vector<std::string> result;
+        auto                     check = [&result](bool ok, size_t offset, const std::string &problem) {
+            if (!ok) {
+                result.push_back("at " + std::to_string(offset) + ": " + problem);
+            }
+        };
+
+        if (descriptor.size() < 9) {
+            return {"too short"};
+        }
+        check(descriptor[1] == DTYPE_Configuration || descriptor[1] == DTYPE_Other, 0, "not a configuration descriptor");
+        check((descriptor[2] | descriptor[3] << 8) == descriptor.size(), 0, "wrong total length");
+
+        uint8_t interfaces = 0;
+        for (size_t i = 0; i < descriptor.size(); i += descriptor[i]) {
+            uint8_t length = descriptor[i];
+            if (length < 2 || i + length > descriptor.size()) {
+                check(false, i, "bad length");
+                return result;
+            }
+
+            if (descriptor[i + 1] == DTYPE_INTERFACE) {
+                interfaces++;
+            } else if (descriptor[i + 1] == DTYPE_ENDPOINT) {
+                check(length == 7, i, "bad endpoint length");
+                uint8_t  address  = descriptor[i + 2];
+                uint16_t size     = descriptor[i + 4] | descriptor[i + 5] << 8;
+                uint8_t  interval = descriptor[i + 6];
+
+                check((address & 0x0F) != 0, i, "endpoint 0 in a configuration");
+                switch (descriptor[i + 3] & 0x03) {
+                    case EP_INTERRUPT:
+                        check(size <= (high_speed ? 1024 : 64), i, "interrupt packet size too large");
+                        check(interval >= 1 && (!high_speed || interval <= 16), i, "interrupt interval out of range");
+                        break;
+                    case EP_BULK:
+                        if (high_speed) {
+                            check(size == 512, i, "bulk packet size must be 512");
+                        } else {
+                            check(size == 8 || size == 16 || size == 32 || size == 64, i, "bulk packet size must be 8, 16, 32 or 64");
+                        }
+                        break;
+                    case EP_ISOCHRONOUS:
+                        check(size <= (high_speed ? 1024 : 1023), i, "isochronous packet size too large");
+                        check(interval >= 1 && interval <= 16, i, "isochronous interval out of range");
+                        break;
+                    default:
+                        check(false, i, "control endpoint in a configuration");
+                        break;
+                }
+            }
+        }
+
+        check(interfaces == descriptor[4], 0, "wrong number of interfaces");
+        return result;
+    }
+
+   private:
+    std::vector<uint8_t> bytes;
+    uint8_t              interfaces = 0;
+};
+
+static std::vector<uint8_t> to_high_speed(std::vector<uint8_t> descriptor, uint16_t fast_endpoints, uint32_t fast_interval_us) {
+    usb_descriptor_to_high_speed(descriptor.data(), descriptor.size(), fast_endpoints, fast_interval_us);
+    return descriptor;
+}
+
+// Polling period in microseconds of a high-speed bInterval
+static uint32_t period_us(uint8_t interval) {
+    return USB_HIGH_SPEED_MICROFRAME_US << (interval - 1);
+}
+
+TEST(UsbHighSpeed, Interval) {
+    EXPECT_EQ(usb_high_speed_interval(0), 1);
+    EXPECT_EQ(usb_high_speed_interval(125), 1);
+    EXPECT_EQ(usb_high_speed_interval(249), 1);
+    EXPECT_EQ(usb_high_speed_interval(250), 2);
+    EXPECT_EQ(usb_high_speed_interval(500), 3);
+    EXPECT_EQ(usb_high_speed_interval(999), 3);
+    EXPECT_EQ(usb_high_speed_interval(1000), 4);
+    EXPECT_EQ(usb_high_speed_interval(10000), 7);
+    EXPECT_EQ(usb_high_speed_interval(255000), 11);
+    EXPECT_EQ(usb_high_speed_interval(UINT32_MAX), 16);
+}
+
+TEST(UsbHighSpeed, SlowerPollingRates) {
+    std::vector<uint8_t> full_speed = Descriptor()
+                                          .interface(1)
+                                          .endpoint(0x80 | KEYBOARD_EP, EP_INTERRUPT, 8, 10)
+                                          .interface(1)
+                                          .endpoint(0x80 | CONSOLE_EP, EP_INTERRUPT, 32, 255)
+                                          .interface(1)
+                                          .endpoint(0x80 | AUDIO_EP, EP_ISOCHRONOUS, 192, 1)
+                                          .build();
+    EXPECT_THAT(Descriptor::problems(full_speed, false), IsEmpty());
+
+    // 4 kHz keyboard reports
+    std::vector<uint8_t> high_speed = to_high_speed(full_speed, 1 << KEYBOARD_EP, 250);
+    EXPECT_THAT(Descriptor::problems(high_speed, true), IsEmpty());
+
+    EXPECT_EQ(period_us(Descriptor::interval(high_speed, 0x80 | KEYBOARD_EP)), 250u);
+    // Periods which aren't a power of two microframes are rounded down, so are never polled less often than at full-speed
+    EXPECT_EQ(period_us(Descriptor::interval(high_speed, 0x80 | CONSOLE_EP)), 128000u);
+    // Isochronous intervals are already exponents, just of frames instead of microframes
+    EXPECT_EQ(period_us(Descriptor::interval(high_speed, 0x80 | AUDIO_EP)), 1000u);
+}
+
+TEST(UsbHighSpeed, BulkEndpointsAreTooSmall) {
+    // Why VIRTSER and MIDI can't be used at high-speed, where bulk endpoints must take 512 byte packets
+    std::vector<uint8_t> full_speed = Descriptor().interface(1).endpoint(0x80 | KEYBOARD_EP, EP_INTERRUPT, 8, 1).interface(2).endpoint(0x80 | BULK_EP, EP_BULK, 64, 0).endpoint(BULK_EP, EP_BULK, 64, 0).build();
+    EXPECT_THAT(Descriptor::problems(full_speed, false), IsEmpty());
+
+    std::vector<uint8_t> high_speed = to_high_speed(full_speed, 1 << KEYBOARD_EP, 125);
+    EXPECT_THAT(Descriptor::problems(high_speed, true), ElementsAre(HasSubstr("512"), HasSubstr("512")));
+}
+
+// Fetches a descriptor the way the USB stack does for a GET_DESCRIPTOR request
+static std::vector<uint8_t> get_descriptor(uint8_t type) {
+    const void *address = nullptr;
+    uint16_t    size    = get_usb_descriptor(type << 8, 0, 0xFFFF, &address);
+    if (address == nullptr) {
+        return {};
+    }
+    return std::vector<uint8_t>((const uint8_t *)address, (const uint8_t *)address + size);
+}
+
+// The keyboard's own descriptor, as built from usb_descriptor.c with the features enabled by this test's rules.mk
+class UsbHighSpeedDescriptor : public testing::TestWithParam<bool> {
+   protected:
+    void SetUp() override {
+        high_speed = GetParam();
+    }
+
+    void expect_full_speed(const std::vector<uint8_t> &descriptor) {
+        EXPECT_THAT(Descriptor::problems(descriptor, false), IsEmpty());
+        EXPECT_EQ(Descriptor::interval(descriptor, ENDPOINT_DIR_IN | KEYBOARD_IN_EPNUM), USB_POLLING_INTERVAL_MS);
+        EXPECT_EQ(Descriptor::interval(descriptor, ENDPOINT_DIR_IN | MOUSE_IN_EPNUM), USB_POLLING_INTERVAL_MS);
+        EXPECT_EQ(Descriptor::interval(descriptor, ENDPOINT_DIR_IN | SHARED_IN_EPNUM), USB_POLLING_INTERVAL_MS);
+        EXPECT_EQ(Descriptor::interval(descriptor, ENDPOINT_DIR_IN | RAW_IN_EPNUM), 1);
+        EXPECT_EQ(Descriptor::interval(descriptor, ENDPOINT_DIR_OUT | RAW_OUT_EPNUM), 1);
+        EXPECT_EQ(Descriptor::interval(descriptor, ENDPOINT_DIR_IN | CONSOLE_IN_EPNUM), 1);
+    }
+
+    void expect_high_speed(const std::vector<uint8_t> &descriptor) {
+        EXPECT_THAT(Descriptor::problems(descriptor, true), IsEmpty());
+        // Keyboard, mouse and shared reports go out every USB_POLLING_INTERVAL_US, everything else stays at its full-speed rate
+        EXPECT_EQ(period_us(Descriptor::interval(descriptor, ENDPOINT_DIR_IN | KEYBOARD_IN_EPNUM)), USB_POLLING_INTERVAL_US);
+        EXPECT_EQ(period_us(Descriptor::interval(descriptor, ENDPOINT_DIR_IN | MOUSE_IN_EPNUM)), USB_POLLING_INTERVAL_US);
+        EXPECT_EQ(period_us(Descriptor::interval(descriptor, ENDPOINT_DIR_IN | SHARED_IN_EPNUM)), USB_POLLING_INTERVAL_US);
+        EXPECT_EQ(period_us(Descriptor::interval(descriptor, ENDPOINT_DIR_IN | RAW_IN_EPNUM)), 1000u);
+        EXPECT_EQ(period_us(Descriptor::interval(descriptor, ENDPOINT_DIR_OUT | RAW_OUT_EPNUM)), 1000u);
+        EXPECT_EQ(period_us(Descriptor::interval(descriptor, ENDPOINT_DIR_IN | CONSOLE_IN_EPNUM)), 1000u);
+    }
+};
+
+TEST_P(UsbHighSpeedDescriptor, CurrentConfiguration) {
+    std::vector<uint8_t> descriptor = get_descriptor(DTYPE_Configuration);
+    ASSERT_EQ(descriptor.size(), sizeof(USB_Descriptor_Configuration_t));
+    EXPECT_EQ(descriptor[1], DTYPE_Configuration);
+
+    if (high_speed) {
+        expect_high_speed(descriptor);
+    } else {
+        expect_full_speed(descriptor);
+    }
+}
+
+TEST_P(UsbHighSpeedDescriptor, OtherSpeedConfiguration) {
+    std::vector<uint8_t> descriptor = get_descriptor(DTYPE_Other);
+    ASSERT_EQ(descriptor.size(), sizeof(USB_Descriptor_Configuration_t));
+    EXPECT_EQ(descriptor[1], DTYPE_Other);
+
+    if (high_speed) {
+        expect_full_speed(descriptor);
+    } else {
+        expect_high_speed(descriptor);
+    }
+}
+
+TEST_P(UsbHighSpeedDescriptor, SpeedsDifferOnlyInEndpoints) {
+    std::vector<uint8_t> current = get_descriptor(DTYPE_Configuration);
+    std::vector<uint8_t> other   = get_descriptor(DTYPE_Other);
+    ASSERT_EQ(current.size(), other.size());
+
+    EXPECT_TRUE(std::equal(&current[2], &current[current[0]], &other[2]));
+    for (size_t i = current[0]; i < current.size(); i += current[i]) {
+        if (current[i + 1] != DTYPE_Endpoint) {
+            EXPECT_TRUE(std::equal(&current[i], &current[i + current[i]], &other[i])) << "at " << i;
+        }
+    }
+}
+
+TEST_P(UsbHighSpeedDescriptor, DeviceQualifierMatchesDevice) {
+    std::vector<uint8_t> device    = get_descriptor(DTYPE_Device);
+    std::vector<uint8_t> qualifier = get_descriptor(DTYPE_DeviceQualifier);
+    ASSERT_EQ(device.size(), sizeof(USB_Descriptor_Device_t));
+    ASSERT_EQ(qualifier.size(), 10u);
+
+    const USB_Descriptor_Device_t          *d = (const USB_Descriptor_Device_t *)device.data();
+    const USB_Descriptor_DeviceQualifier_t *q = (const USB_Descriptor_DeviceQualifier_t *)qualifier.data();
+    EXPECT_EQ(q->Header.Size, 10);
+    EXPECT_EQ(q->Header.Type, DTYPE_DeviceQualifier);
+    // Both must claim USB 2.0 for the host to ask for the other speed at all
+    EXPECT_EQ(d->USBSpecification, 0x0200);
+    EXPECT_EQ(q->USBSpecification, 0x0200);
+    EXPECT_EQ(q->Class, d->Class);
+    EXPECT_EQ(q->SubClass, d->SubClass);
+    EXPECT_EQ(q->Protocol, d->Protocol);
+    EXPECT_EQ(q->Endpoint0Size, d->Endpoint0Size);
+    EXPECT_EQ(q->NumberOfConfigurations, d->NumberOfConfigurations);
+    EXPECT_EQ(q->Reserved, 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(BothSpeeds, UsbHighSpeedDescriptor, testing::Values(false, true), [](const testing::TestParamInfo<bool> &info) { return info.param ? "HighSpeed" : "FullSpeed"; });
@@ -49,6 +49,12 @@
 #    include "os_detection.h"
 #endif
 
+#ifdef USB_HIGH_SPEED_ENABLE
+#    include <string.h>
+#    include "usb_high_speed.h"
+#    include "usb_util.h"
+#endif
+
 #if defined(SERIAL_NUMBER) || (defined(SERIAL_NUMBER_USE_HARDWARE_ID) && SERIAL_NUMBER_USE_HARDWARE_ID == TRUE)
 
 #    define HAS_SERIAL_NUMBER
@@ -1099,6 +1105,74 @@ const USB_Descriptor_Configuration_t PROGMEM ConfigurationDescriptor = {
 #endif
 };
 
+#ifdef USB_HIGH_SPEED_ENABLE
+#    if !defined(PROTOCOL_CHIBIOS)
+#        error "USB_HIGH_SPEED_ENABLE is only supported by ChibiOS"
+#    endif
+#    if defined(MIDI_ENABLE) || defined(VIRTSER_ENABLE)
+#        error "USB_HIGH_SPEED_ENABLE does not support MIDI or VIRTSER, as their bulk endpoints are smaller than high-speed allows"
+#    endif
+
+/*
+ * Device qualifier descriptor, describing the device when running at the other speed
+ */
+const USB_Descriptor_DeviceQualifier_t PROGMEM DeviceQualifierDescriptor = {
+    .Header = {
+        .Size                   = sizeof(USB_Descriptor_DeviceQualifier_t),
+        .Type                   = DTYPE_DeviceQualifier
+    },
+    .USBSpecification           = VERSION_BCD(2, 0, 0),
+    .Class                      = USB_CSCP_NoDeviceClass,
+    .SubClass                   = USB_CSCP_NoDeviceSubclass,
+    .Protocol                   = USB_CSCP_NoDeviceProtocol,
+    .Endpoint0Size              = FIXED_CONTROL_ENDPOINT_SIZE,
+    .NumberOfConfigurations     = FIXED_NUM_CONFIGURATIONS,
+    .Reserved                   = 0
+};
+
+// clang-format on
+
+// Endpoints polled every USB_POLLING_INTERVAL_MS at full-speed, which are polled every USB_POLLING_INTERVAL_US instead
+static const uint16_t fast_endpoints = 0
+#    ifndef KEYBOARD_SHARED_EP
+                                       | (1 << KEYBOARD_IN_EPNUM)
+#    endif
+#    if defined(MOUSE_ENABLE) && !defined(MOUSE_SHARED_EP)
+                                       | (1 << MOUSE_IN_EPNUM)
+#    endif
+#    ifdef SHARED_EP_ENABLE
+                                       | (1 << SHARED_IN_EPNUM)
+#    endif
+#    if defined(JOYSTICK_ENABLE) && !defined(JOYSTICK_SHARED_EP)
+                                       | (1 << JOYSTICK_IN_EPNUM)
+#    endif
+#    if defined(DIGITIZER_ENABLE) && !defined(DIGITIZER_SHARED_EP)
+                                       | (1 << DIGITIZER_IN_EPNUM)
+#    endif
+    ;
+
+static USB_Descriptor_Configuration_t SpeedConfigurationDescriptor;
+
+/*
+ * Returns the configuration descriptor for the given speed, as either the current (DTYPE_Configuration) or the other
+ * speed (DTYPE_Other) configuration.
+ */
+static const void* get_configuration_descriptor(bool high_speed, uint8_t type) {
+    if (!high_speed && type == DTYPE_Configuration) {
+        return &ConfigurationDescriptor;
+    }
+
+    memcpy(&SpeedConfigurationDescriptor, &ConfigurationDescriptor, sizeof(USB_Descriptor_Configuration_t));
+    SpeedConfigurationDescriptor.Config.Header.Type = type;
+    if (high_speed) {
+        usb_descriptor_to_high_speed((uint8_t*)&SpeedConfigurationDescriptor, sizeof(USB_Descriptor_Configuration_t), fast_endpoints, USB_POLLING_INTERVAL_US);
+    }
+    return &SpeedConfigurationDescriptor;
+}
+
+// clang-format off
+#endif // USB_HIGH_SPEED_ENABLE
+
 /*
  * String descriptors
  */
@@ -1208,10 +1282,26 @@ uint16_t get_usb_descriptor(const uint16_t wValue, const uint16_t wIndex, const
 
             break;
         case DTYPE_Configuration:
+#ifdef USB_HIGH_SPEED_ENABLE
+            Address = get_configuration_descriptor(usb_is_high_speed(), DTYPE_Configuration);
+#else
             Address = &ConfigurationDescriptor;
+#endif
+            Size    = sizeof(USB_Descriptor_Configuration_t);
+
+            break;
+#ifdef USB_HIGH_SPEED_ENABLE
+        case DTYPE_DeviceQualifier:
+            Address = &DeviceQualifierDescriptor;
+            Size    = sizeof(USB_Descriptor_DeviceQualifier_t);
+
+            break;
+        case DTYPE_Other:
+            Address = get_configuration_descriptor(!usb_is_high_speed(), DTYPE_Other);
             Size    = sizeof(USB_Descriptor_Configuration_t);
 
             break;
+#endif
         case DTYPE_String:
             switch (DescriptorIndex) {
                 case 0x00:
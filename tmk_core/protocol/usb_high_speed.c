@@ -0,0 +1,52 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "usb_high_speed.h"
+
+#define USB_DESCRIPTOR_ENDPOINT 0x05
+
+#define USB_ENDPOINT_OFFSET_ADDRESS 2
+#define USB_ENDPOINT_OFFSET_ATTRIBUTES 3
+#define USB_ENDPOINT_OFFSET_INTERVAL 6
+
+#define USB_ENDPOINT_TYPE_MASK 0x03
+#define USB_ENDPOINT_TYPE_ISOCHRONOUS 0x01
+#define USB_ENDPOINT_TYPE_INTERRUPT 0x03
+
+uint8_t usb_high_speed_interval(uint32_t microseconds) {
+    uint8_t interval = 1;
+    while (interval < 16 && ((uint32_t)USB_HIGH_SPEED_MICROFRAME_US << interval) <= microseconds) {
+        interval++;
+    }
+    return interval;
+}
+
+void usb_descriptor_to_high_speed(uint8_t *descriptor, uint16_t length, uint16_t fast_endpoints, uint32_t fast_interval_us) {
+    for (uint16_t offset = 0; offset + 1 < length && descriptor[offset] > 0; offset += descriptor[offset]) {
+        uint8_t *entry = &descriptor[offset];
+        if (entry[1] != USB_DESCRIPTOR_ENDPOINT || offset + USB_ENDPOINT_OFFSET_INTERVAL >= length) {
+            continue;
+        }
+
+        uint8_t number = entry[USB_ENDPOINT_OFFSET_ADDRESS] & 0x0F;
+        switch (entry[USB_ENDPOINT_OFFSET_ATTRIBUTES] & USB_ENDPOINT_TYPE_MASK) {
+            case USB_ENDPOINT_TYPE_INTERRUPT:
+                if (fast_endpoints & (1 << number)) {
+                    entry[USB_ENDPOINT_OFFSET_INTERVAL] = usb_high_speed_interval(fast_interval_us);
+                } else {
+                    entry[USB_ENDPOINT_OFFSET_INTERVAL] = usb_high_speed_interval(entry[USB_ENDPOINT_OFFSET_INTERVAL] * 1000UL);
+                }
+                break;
+            case USB_ENDPOINT_TYPE_ISOCHRONOUS: {
+                // Already an exponent, of 1ms frames rather than microframes
+                uint8_t interval                    = entry[USB_ENDPOINT_OFFSET_INTERVAL] + 3;
+                entry[USB_ENDPOINT_OFFSET_INTERVAL] = interval > 16 ? 16 : interval;
+                break;
+            }
+            default:
+                // Control endpoints have no interval, and the bulk NAK rate is left to the controller
+                entry[USB_ENDPOINT_OFFSET_INTERVAL] = 0;
+                break;
+        }
+    }
+}
@@ -0,0 +1,42 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * High-speed USB descriptors
+ *
+ * The configuration descriptor is written for full-speed, where the bInterval of an interrupt endpoint is its polling
+ * period in milliseconds. At high-speed it is instead an exponent of 125us microframes, so that a period of
+ * 2^(bInterval - 1) microframes allows reports at up to 8 kHz. Rather than keeping two copies of every descriptor, the
+ * full-speed one is rewritten in RAM whenever the host asks for the high-speed variant.
+ */
+
+#ifndef USB_POLLING_INTERVAL_US
+#    define USB_POLLING_INTERVAL_US 125
+#endif
+
+#define USB_HIGH_SPEED_MICROFRAME_US 125
+
+/**
+ * @brief Converts a polling period into a high-speed bInterval, rounding down to the nearest supported period
+ *
+ * @param[in] microseconds polling period, at least one microframe
+ * @return bInterval between 1 and 16
+ */
+uint8_t usb_high_speed_interval(uint32_t microseconds);
+
+/**
+ * @brief Rewrites a full-speed configuration descriptor in place for use at high-speed
+ *
+ * Interrupt endpoints whose number is set in `fast_endpoints` are polled every `fast_interval_us`, and all others keep
+ * their full-speed polling period. Isochronous endpoint intervals are converted from frames to microframes.
+ *
+ * @param[in,out] descriptor configuration descriptor, as sent to the host
+ * @param[in] length length of the descriptor
+ * @param[in] fast_endpoints bitmask of endpoint numbers which should be polled at `fast_interval_us`
+ * @param[in] fast_interval_us polling period of the fast endpoints
+ */
+void usb_descriptor_to_high_speed(uint8_t *descriptor, uint16_t length, uint16_t fast_endpoints, uint32_t fast_interval_us);
@@ -33,3 +33,7 @@ __attribute__((weak)) bool usb_vbus_state(void) {
     return true;
 #endif
 }
+
+__attribute__((weak)) bool usb_is_high_speed(void) {
+    return false;
+}
@@ -23,3 +23,5 @@ void usb_disconnect(void);
 bool usb_connected_state(void);
 
 bool usb_vbus_state(void);
+
+bool usb_is_high_speed(void);
@@ -161,10 +161,14 @@ void raw_hid_task(void) {
     }
 
     if (raw_output_received_bytes == RAW_BUFFER_SIZE) {
-        raw_hid_receive(raw_output_buffer, RAW_BUFFER_SIZE);
+        raw_hid_dispatch(raw_output_buffer, RAW_BUFFER_SIZE);
         raw_output_received_bytes = 0;
     }
 }
+
+bool raw_hid_send_ready(void) {
+    return usbConfiguration && usbInterruptIsReady4();
+}
 #endif
 
 /*------------------------------------------------------------------*